@@ -0,0 +1,1110 @@
+/* headless instanced candle benchmark
+
+	Renders a candlestick chart with instancing (the tutorial/instanced_arrays
+	approach, scaled up) into an offscreen render target. Each configuration
+	(number of candles and zoom level) renders a fixed number of frames. For
+	every frame it records the CPU submit time, the GPU time and the uploaded
+	bytes, and writes the samples and percentiles as JSON.
+
+	The history candles live in an immutable instance buffer. The newest
+	MAX_LIVE_CANDLES candles live in a stream buffer which is updated every
+	frame, like a ticking chart. The zoom level is the fraction of candles
+	that are visible: zoom 10 draws the newest tenth of the candles.
+
+	build and run with:
+
+		make bench          GL 4.1 on a headless EGL context (surfaceless on llvmpipe)
+		make bench-dummy    sokol-gfx dummy backend, CPU-only numbers without GPU times
+		make perf-baseline  record the performance gate baseline
+		make perfgate       compare against the baseline, fails on regressions
+
+	command line options (pass via BENCH_ARGS="..."):
+
+		--frames N          measured frames per configuration (default: 60)
+		--warmup N          unmeasured frames before each configuration (default: 5)
+		--candles A,B,...   candle counts (default: 1000,10000,100000,1000000,10000000)
+		--zooms A,B,...     zoom levels (default: 1,10,100), at most 64
+		                    candle count and zoom level combinations
+		--width N           render target width (default: 1280)
+		--height N          render target height (default: 720)
+		--runs N            repeat all configurations N times, the samples of
+		                    all runs are pooled (default: 1)
+		--out PATH          write the JSON to a file instead of stdout
+		--baseline PATH     compare against a JSON file written by an earlier run
+		--threshold PCT     allowed p50 frame time and upload increase (default: 10)
+		--threshold-p99 PCT allowed p99 frame time increase (default: 25)
+		--alpha P           significance level of the U-test (default: 0.01)
+
+	A summary table is printed to stderr.
+
+	PERFORMANCE GATE
+	================
+	With --baseline, each configuration is compared against the
+	configuration with the same candle count and zoom level in the baseline
+	file. Frame times are noisy, so a frame time regression is only reported
+	if the p50 frame time grew beyond the threshold, and a one-sided
+	Mann-Whitney U-test on the frame time samples says that the current
+	frame times are larger than the baseline frame times with significance
+	alpha. The U-test detects a shift of the median, a regression which only
+	affects the slowest frames wouldn't trip it. So the p99 is gated on a
+	separate U-test on the slowest tenth of the frames of either run (the
+	samples at and above its p90), together with the p99 threshold. The tail
+	only has a tenth of the samples, use --runs to get enough of them for a
+	meaningful p99 test. Upload bytes are deterministic and are compared against the
+	threshold directly. A report is printed to stderr, and the process exits
+	with code 1 if any configuration regressed (code 2 if the baseline
+	can't be loaded).
+
+	Running all configurations several times (--runs) interleaves the
+	configurations over time, so slow phases of the machine are spread
+	over all of them.
+*/
+#define SOKOL_IMPL
+#if defined(BENCH_DUMMY_BACKEND)
+#define SOKOL_DUMMY_BACKEND
+#else
+#define SOKOL_GLCORE
+#define SOKOL_FORCE_EGL
+#endif
+
+#if !defined(BENCH_DUMMY_BACKEND)
+#include "header/sokol_app.h"
+#endif
+#include "header/sokol_gfx.h"
+#include "header/sokol_log.h"
+#include "header/sokol_time.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define MAX_CONFIGS (64)
+#define MAX_LIST_ITEMS (16)
+#define MAX_LIVE_CANDLES (256)
+#define NUM_CANDLE_VERTICES (12)
+
+typedef struct {
+	float open, high, low, close;
+} candle_t;
+
+// must match the vs_params uniform array in the vertex shader
+typedef struct {
+	float view[4];		// x scale, x offset, y scale, y offset
+	float widths[4];	// body width, wick width
+} vs_params_t;
+
+typedef struct {
+	double min, mean, p50, p90, p99, max;
+} percentiles_t;
+
+typedef struct {
+	int num_candles;
+	int zoom;
+	int num_visible;
+	int num_frames;
+	double* cpu_ms;				// sg_begin_pass() to sg_commit()
+	double* gpu_ms;				// GL timer query around the pass
+	double* frame_ms;			// whole frame including waiting for the GPU
+	uint64_t* upload_bytes;
+	uint32_t num_draws;
+	uint64_t num_primitives;
+} result_t;
+
+static struct {
+	// options
+	int frames;
+	int warmup;
+	int width;
+	int height;
+	int num_candle_counts;
+	int candle_counts[MAX_LIST_ITEMS];
+	int num_zooms;
+	int zooms[MAX_LIST_ITEMS];
+	const char* out_path;
+	int runs;
+	const char* baseline_path;
+	double threshold;
+	double threshold_p99;
+	double alpha;
+
+	// render state
+	sg_image color_img;
+	sg_view color_view;
+	sg_pipeline pip;
+	sg_buffer corner_buf;
+	sg_pass_action pass_action;
+	#if !defined(BENCH_DUMMY_BACKEND)
+	GLuint gpu_query;
+	#endif
+
+	// the running configuration
+	int num_results;
+	result_t results[MAX_CONFIGS];
+	int cur_result;
+	int cur_run;
+	int cur_frame;
+	int exit_code;
+	bool config_running;
+	bool done;
+	candle_t* candles;
+	int num_history;
+	int num_live;
+	candle_t live[MAX_LIVE_CANDLES];
+	sg_buffer history_buf;
+	sg_buffer live_buf;
+	float y_min, y_max;
+	uint32_t seed;
+} state;
+
+static const char* vs_source_glsl410 =
+	"#version 410\n"
+	"uniform vec4 vs_params[2];\n"
+	"layout(location = 0) in vec3 corner;\n"
+	"layout(location = 1) in vec4 ohlc;\n"
+	"out vec4 color;\n"
+	"void main() {\n"
+	"	bool wick = corner.z > 0.5;\n"
+	"	float lo = wick ? ohlc.z : min(ohlc.x, ohlc.w);\n"
+	"	float hi = wick ? ohlc.y : max(ohlc.x, ohlc.w);\n"
+	"	float w = wick ? vs_params[1].y : vs_params[1].x;\n"
+	"	float x = (float(gl_InstanceID) + corner.x * w) * vs_params[0].x + vs_params[0].y;\n"
+	"	float y = mix(lo, hi, corner.y) * vs_params[0].z + vs_params[0].w;\n"
+	"	gl_Position = vec4(x, y, 0.0, 1.0);\n"
+	"	color = (ohlc.w >= ohlc.x) ? vec4(0.2, 0.8, 0.4, 1.0) : vec4(0.9, 0.25, 0.25, 1.0);\n"
+	"}\n";
+
+static const char* fs_source_glsl410 =
+	"#version 410\n"
+	"in vec4 color;\n"
+	"layout(location = 0) out vec4 frag_color;\n"
+	"void main() {\n"
+	"	frag_color = color;\n"
+	"}\n";
+
+static uint32_t random_u32(void) {
+	state.seed = state.seed * 1664525u + 1013904223u;
+	return state.seed;
+}
+
+// random float in [0, 1)
+static float random_float(void) {
+	return (float)(random_u32() >> 8) / 16777216.0f;
+}
+
+// a random walk of candles starting at the close price of the previous candle
+static candle_t next_candle(float prev_close) {
+	candle_t c;
+	c.open = prev_close;
+	c.close = prev_close + (random_float() - 0.5f) * 2.0f;
+	const float body_hi = (c.open > c.close) ? c.open : c.close;
+	const float body_lo = (c.open < c.close) ? c.open : c.close;
+	c.high = body_hi + random_float();
+	c.low = body_lo - random_float();
+	return c;
+}
+
+static double* alloc_samples(int num) {
+	return (double*) calloc((size_t)num, sizeof(double));
+}
+
+static int compare_double(const void* a, const void* b) {
+	const double da = *(const double*)a;
+	const double db = *(const double*)b;
+	return (da < db) ? -1 : ((da > db) ? 1 : 0);
+}
+
+// nearest-rank percentile of sorted samples
+static double percentile(const double* sorted, int num, double p) {
+	int rank = (int)((p / 100.0) * num + 0.999999);
+	rank = (rank < 1) ? 1 : ((rank > num) ? num : rank);
+	return sorted[rank - 1];
+}
+
+static percentiles_t compute_percentiles(const double* samples, int num) {
+	percentiles_t res = {};
+	if (num == 0) {
+		return res;
+	}
+	double* sorted = alloc_samples(num);
+	memcpy(sorted, samples, (size_t)num * sizeof(double));
+	qsort(sorted, (size_t)num, sizeof(double), compare_double);
+	double sum = 0.0;
+	for (int i = 0; i < num; i++) {
+		sum += sorted[i];
+	}
+	res.min = sorted[0];
+	res.mean = sum / num;
+	res.p50 = percentile(sorted, num, 50.0);
+	res.p90 = percentile(sorted, num, 90.0);
+	res.p99 = percentile(sorted, num, 99.0);
+	res.max = sorted[num - 1];
+	free(sorted);
+	return res;
+}
+
+/*== options =================================================================*/
+
+static int parse_list(const char* str, int* items, int max_items) {
+	int num = 0;
+	while (*str && (num < max_items)) {
+		char* end = 0;
+		const long val = strtol(str, &end, 10);
+		if ((end == str) || (val <= 0)) {
+			return 0;
+		}
+		items[num++] = (int)val;
+		str = (*end == ',') ? (end + 1) : end;
+	}
+	// more than max_items items
+	if (*str) {
+		return 0;
+	}
+	return num;
+}
+
+static bool parse_args(int argc, char* argv[]) {
+	state.frames = 60;
+	state.warmup = 5;
+	state.width = 1280;
+	state.height = 720;
+	state.runs = 1;
+	state.threshold = 10.0;
+	state.threshold_p99 = 25.0;
+	state.alpha = 0.01;
+	state.num_candle_counts = parse_list("1000,10000,100000,1000000,10000000", state.candle_counts, MAX_LIST_ITEMS);
+	state.num_zooms = parse_list("1,10,100", state.zooms, MAX_LIST_ITEMS);
+	for (int i = 1; i < argc; i++) {
+		const char* arg = argv[i];
+		const char* val = (i + 1 < argc) ? argv[i + 1] : 0;
+		if (val == 0) {
+			fprintf(stderr, "missing value for %s\n", arg);
+			return false;
+		}
+		if (0 == strcmp(arg, "--frames")) {
+			state.frames = atoi(val);
+		} else if (0 == strcmp(arg, "--warmup")) {
+			state.warmup = atoi(val);
+		} else if (0 == strcmp(arg, "--candles")) {
+			state.num_candle_counts = parse_list(val, state.candle_counts, MAX_LIST_ITEMS);
+		} else if (0 == strcmp(arg, "--zooms")) {
+			state.num_zooms = parse_list(val, state.zooms, MAX_LIST_ITEMS);
+		} else if (0 == strcmp(arg, "--width")) {
+			state.width = atoi(val);
+		} else if (0 == strcmp(arg, "--height")) {
+			state.height = atoi(val);
+		} else if (0 == strcmp(arg, "--runs")) {
+			state.runs = atoi(val);
+		} else if (0 == strcmp(arg, "--out")) {
+			state.out_path = val;
+		} else if (0 == strcmp(arg, "--baseline")) {
+			state.baseline_path = val;
+		} else if (0 == strcmp(arg, "--threshold")) {
+			state.threshold = atof(val);
+		} else if (0 == strcmp(arg, "--threshold-p99")) {
+			state.threshold_p99 = atof(val);
+		} else if (0 == strcmp(arg, "--alpha")) {
+			state.alpha = atof(val);
+		} else {
+			fprintf(stderr, "unknown option %s\n", arg);
+			return false;
+		}
+		i++;
+	}
+	if ((state.frames <= 0) || (state.warmup < 0) || (state.width <= 0) || (state.height <= 0) ||
+		(state.num_candle_counts == 0) || (state.num_zooms == 0) || (state.runs <= 0) ||
+		(state.threshold < 0.0) || (state.threshold_p99 < 0.0) || (state.alpha <= 0.0) || (state.alpha >= 1.0))
+	{
+		fprintf(stderr, "invalid options\n");
+		return false;
+	}
+	if ((state.num_candle_counts * state.num_zooms) > MAX_CONFIGS) {
+		fprintf(stderr, "too many configurations: %d candle counts x %d zoom levels, at most %d are allowed\n",
+			state.num_candle_counts, state.num_zooms, MAX_CONFIGS);
+		return false;
+	}
+	// one result per candle count and zoom level
+	for (int c = 0; c < state.num_candle_counts; c++) {
+		for (int z = 0; z < state.num_zooms; z++) {
+			result_t* res = &state.results[state.num_results++];
+			res->num_candles = state.candle_counts[c];
+			res->zoom = state.zooms[z];
+			res->num_visible = (res->num_candles / res->zoom > 0) ? (res->num_candles / res->zoom) : 1;
+		}
+	}
+	return true;
+}
+
+/*== rendering ===============================================================*/
+
+static void init(void) {
+	stm_setup();
+	sg_desc desc = {};
+	desc.environment.defaults.color_format = SG_PIXELFORMAT_RGBA8;
+	desc.environment.defaults.depth_format = SG_PIXELFORMAT_NONE;
+	desc.environment.defaults.sample_count = 1;
+	desc.logger.func = slog_func;
+	sg_setup(&desc);
+
+	// offscreen render target, a headless context may not have a default framebuffer
+	sg_image_desc img_desc = {};
+	img_desc.usage.color_attachment = true;
+	img_desc.width = state.width;
+	img_desc.height = state.height;
+	img_desc.pixel_format = SG_PIXELFORMAT_RGBA8;
+	img_desc.label = "bench_color";
+	state.color_img = sg_make_image(&img_desc);
+	sg_view_desc view_desc = {};
+	view_desc.color_attachment.image = state.color_img;
+	state.color_view = sg_make_view(&view_desc);
+
+	// the corners of the candle body (z = 0) and wick (z = 1) quads
+	const float corners[NUM_CANDLE_VERTICES * 3] = {
+		-0.5f, 0.0f, 0.0f,	0.5f, 0.0f, 0.0f,	0.5f, 1.0f, 0.0f,
+		-0.5f, 0.0f, 0.0f,	0.5f, 1.0f, 0.0f,	-0.5f, 1.0f, 0.0f,
+		-0.5f, 0.0f, 1.0f,	0.5f, 0.0f, 1.0f,	0.5f, 1.0f, 1.0f,
+		-0.5f, 0.0f, 1.0f,	0.5f, 1.0f, 1.0f,	-0.5f, 1.0f, 1.0f,
+	};
+	sg_buffer_desc buffer_desc = {
+		.size = sizeof(corners),
+		.data = SG_RANGE(corners),
+		.label = "candle_corners"
+	};
+	state.corner_buf = sg_make_buffer(&buffer_desc);
+
+	sg_shader_desc shd_desc = {};
+	shd_desc.vertex_func.source = vs_source_glsl410;
+	shd_desc.fragment_func.source = fs_source_glsl410;
+	shd_desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+	shd_desc.attrs[0].glsl_name = "corner";
+	shd_desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+	shd_desc.attrs[1].glsl_name = "ohlc";
+	shd_desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+	shd_desc.uniform_blocks[0].size = sizeof(vs_params_t);
+	shd_desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+	shd_desc.uniform_blocks[0].glsl_uniforms[0].array_count = 2;
+	shd_desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
+	shd_desc.label = "candle_shader";
+	sg_shader shd = sg_make_shader(&shd_desc);
+
+	sg_pipeline_desc pipeline_desc = {};
+	pipeline_desc.shader = shd;
+	pipeline_desc.layout.buffers[1].step_func = SG_VERTEXSTEP_PER_INSTANCE;
+	pipeline_desc.layout.attrs[0] = { .buffer_index = 0, .offset = 0, .format = SG_VERTEXFORMAT_FLOAT3 };
+	pipeline_desc.layout.attrs[1] = { .buffer_index = 1, .offset = 0, .format = SG_VERTEXFORMAT_FLOAT4 };
+	pipeline_desc.primitive_type = SG_PRIMITIVETYPE_TRIANGLES;
+	pipeline_desc.label = "candle_pipeline";
+	state.pip = sg_make_pipeline(&pipeline_desc);
+
+	state.pass_action.colors[0].load_action = SG_LOADACTION_CLEAR;
+	state.pass_action.colors[0].clear_value = {0.1f, 0.1f, 0.12f, 1.0f};
+
+	#if !defined(BENCH_DUMMY_BACKEND)
+	glGenQueries(1, &state.gpu_query);
+	#endif
+}
+
+static void begin_config(result_t* res) {
+	// the samples of all runs go into the same arrays
+	if (state.cur_run == 0) {
+		const int max_samples = state.frames * state.runs;
+		res->num_frames = 0;
+		res->cpu_ms = alloc_samples(max_samples);
+		res->gpu_ms = alloc_samples(max_samples);
+		res->frame_ms = alloc_samples(max_samples);
+		res->upload_bytes = (uint64_t*) calloc((size_t)max_samples, sizeof(uint64_t));
+	}
+
+	// the same candles for every run
+	state.seed = 12345;
+	state.num_live = (res->num_candles < MAX_LIVE_CANDLES) ? res->num_candles : MAX_LIVE_CANDLES;
+	state.num_history = res->num_candles - state.num_live;
+	state.candles = (candle_t*) malloc((size_t)res->num_candles * sizeof(candle_t));
+	float close = 100.0f;
+	state.y_min = close;
+	state.y_max = close;
+	for (int i = 0; i < res->num_candles; i++) {
+		state.candles[i] = next_candle(close);
+		close = state.candles[i].close;
+		state.y_min = (state.candles[i].low < state.y_min) ? state.candles[i].low : state.y_min;
+		state.y_max = (state.candles[i].high > state.y_max) ? state.candles[i].high : state.y_max;
+	}
+	memcpy(state.live, &state.candles[state.num_history], (size_t)state.num_live * sizeof(candle_t));
+
+	if (state.num_history > 0) {
+		sg_buffer_desc buffer_desc = {};
+		buffer_desc.size = (size_t)state.num_history * sizeof(candle_t);
+		buffer_desc.data = { state.candles, buffer_desc.size };
+		buffer_desc.label = "history_candles";
+		state.history_buf = sg_make_buffer(&buffer_desc);
+	}
+	sg_buffer_desc buffer_desc = {};
+	buffer_desc.size = sizeof(state.live);
+	buffer_desc.usage.stream_update = true;
+	buffer_desc.label = "live_candles";
+	state.live_buf = sg_make_buffer(&buffer_desc);
+
+	state.cur_frame = 0;
+	state.config_running = true;
+}
+
+static void end_config(void) {
+	sg_destroy_buffer(state.history_buf);
+	sg_destroy_buffer(state.live_buf);
+	state.history_buf = {};
+	state.live_buf = {};
+	free(state.candles);
+	state.candles = 0;
+	state.config_running = false;
+}
+
+// draw num_instances candles starting at 'first' in buf, at x slot 'x_first' of the visible range
+static void draw_candles(const result_t* res, sg_buffer buf, int first, int num_instances, int x_first) {
+	sg_bindings bind = {};
+	bind.vertex_buffers[0] = state.corner_buf;
+	bind.vertex_buffers[1] = buf;
+	bind.vertex_buffer_offsets[1] = first * (int)sizeof(candle_t);
+	sg_apply_bindings(&bind);
+
+	const float x_scale = 2.0f / (float)res->num_visible;
+	const float y_scale = 2.0f / (state.y_max - state.y_min);
+	vs_params_t vs_params = {};
+	vs_params.view[0] = x_scale;
+	vs_params.view[1] = -1.0f + ((float)x_first + 0.5f) * x_scale;
+	vs_params.view[2] = y_scale;
+	vs_params.view[3] = -1.0f - state.y_min * y_scale;
+	vs_params.widths[0] = 0.7f;
+	vs_params.widths[1] = 0.1f;
+	sg_range range = {&vs_params, sizeof(vs_params)};
+	sg_apply_uniforms(0, range);
+	sg_draw(0, NUM_CANDLE_VERTICES, num_instances);
+}
+
+// let the live candles tick, only the newest candle moves
+static void update_live_candles(void) {
+	candle_t* c = &state.live[state.num_live - 1];
+	c->close += (random_float() - 0.5f) * 0.1f;
+	c->high = (c->close > c->high) ? c->close : c->high;
+	c->low = (c->close < c->low) ? c->close : c->low;
+	sg_range range = {state.live, (size_t)state.num_live * sizeof(candle_t)};
+	sg_update_buffer(state.live_buf, range);
+}
+
+static void render_frame(const result_t* res) {
+	const int num_live_visible = (res->num_visible < state.num_live) ? res->num_visible : state.num_live;
+	const int num_history_visible = res->num_visible - num_live_visible;
+
+	sg_pass pass = {};
+	pass.action = state.pass_action;
+	pass.attachments.colors[0] = state.color_view;
+	sg_begin_pass(&pass);
+	sg_apply_pipeline(state.pip);
+	if (num_history_visible > 0) {
+		draw_candles(res, state.history_buf, state.num_history - num_history_visible, num_history_visible, 0);
+	}
+	draw_candles(res, state.live_buf, state.num_live - num_live_visible, num_live_visible, num_history_visible);
+	sg_end_pass();
+}
+
+static void write_percentiles(FILE* fp, const char* name, const double* samples, int num) {
+	const percentiles_t p = compute_percentiles(samples, num);
+	fprintf(fp, "\"%s\": {\"min\": %.6f, \"mean\": %.6f, \"p50\": %.6f, \"p90\": %.6f, \"p99\": %.6f, \"max\": %.6f}",
+		name, p.min, p.mean, p.p50, p.p90, p.p99, p.max);
+}
+
+static void write_samples(FILE* fp, const char* name, const double* samples, int num) {
+	fprintf(fp, "\"%s\": [", name);
+	for (int i = 0; i < num; i++) {
+		fprintf(fp, "%s%.6f", (i > 0) ? ", " : "", samples[i]);
+	}
+	fprintf(fp, "]");
+}
+
+static const char* backend_name(void) {
+	switch (sg_query_backend()) {
+		case SG_BACKEND_GLCORE: return "glcore";
+		case SG_BACKEND_GLES3: return "gles3";
+		case SG_BACKEND_DUMMY: return "dummy";
+		default: return "unknown";
+	}
+}
+
+static void write_json(FILE* fp) {
+	#if defined(BENCH_DUMMY_BACKEND)
+	const char* renderer = "none";
+	const bool has_gpu_times = false;
+	#else
+	const char* renderer = (const char*) glGetString(GL_RENDERER);
+	const bool has_gpu_times = true;
+	#endif
+	fprintf(fp, "{\n");
+	fprintf(fp, "  \"benchmark\": \"instanced_candles\",\n");
+	fprintf(fp, "  \"backend\": \"%s\",\n", backend_name());
+	fprintf(fp, "  \"renderer\": \"%s\",\n", renderer ? renderer : "unknown");
+	fprintf(fp, "  \"width\": %d,\n  \"height\": %d,\n", state.width, state.height);
+	fprintf(fp, "  \"frames\": %d,\n  \"warmup\": %d,\n  \"runs\": %d,\n", state.frames, state.warmup, state.runs);
+	fprintf(fp, "  \"results\": [\n");
+	for (int i = 0; i < state.num_results; i++) {
+		const result_t* res = &state.results[i];
+		const int n = res->num_frames;
+		double* upload = alloc_samples(n);
+		for (int f = 0; f < n; f++) {
+			upload[f] = (double)res->upload_bytes[f];
+		}
+		const percentiles_t frame = compute_percentiles(res->frame_ms, n);
+		const double candles_per_sec = (frame.p50 > 0.0) ? (res->num_visible * 1000.0 / frame.p50) : 0.0;
+		fprintf(fp, "    {\n");
+		fprintf(fp, "      \"candles\": %d, \"zoom\": %d, \"visible\": %d,\n", res->num_candles, res->zoom, res->num_visible);
+		fprintf(fp, "      \"draws_per_frame\": %u, \"primitives_per_frame\": %llu,\n",
+			res->num_draws, (unsigned long long)res->num_primitives);
+		fprintf(fp, "      \"visible_candles_per_sec\": %.0f,\n      ", candles_per_sec);
+		write_percentiles(fp, "cpu_ms", res->cpu_ms, n);
+		fprintf(fp, ",\n      ");
+		if (has_gpu_times) {
+			write_percentiles(fp, "gpu_ms", res->gpu_ms, n);
+		} else {
+			fprintf(fp, "\"gpu_ms\": null");
+		}
+		fprintf(fp, ",\n      ");
+		write_percentiles(fp, "frame_ms", res->frame_ms, n);
+		fprintf(fp, ",\n      ");
+		write_percentiles(fp, "upload_bytes", upload, n);
+		fprintf(fp, ",\n      \"samples\": {");
+		write_samples(fp, "cpu_ms", res->cpu_ms, n);
+		fprintf(fp, ", ");
+		if (has_gpu_times) {
+			write_samples(fp, "gpu_ms", res->gpu_ms, n);
+		} else {
+			fprintf(fp, "\"gpu_ms\": null");
+		}
+		fprintf(fp, ", ");
+		write_samples(fp, "frame_ms", res->frame_ms, n);
+		fprintf(fp, ", ");
+		write_samples(fp, "upload_bytes", upload, n);
+		fprintf(fp, "}\n    }%s\n", (i + 1 < state.num_results) ? "," : "");
+		free(upload);
+	}
+	fprintf(fp, "  ]\n}\n");
+}
+
+static void print_summary(void) {
+	fprintf(stderr, "%10s %6s %10s %9s %9s %9s %9s %9s %9s %12s\n",
+		"candles", "zoom", "visible", "cpu p50", "cpu p99", "gpu p50", "gpu p99", "frame p50", "frame p99", "upload/frame");
+	for (int i = 0; i < state.num_results; i++) {
+		const result_t* res = &state.results[i];
+		const percentiles_t cpu = compute_percentiles(res->cpu_ms, res->num_frames);
+		const percentiles_t gpu = compute_percentiles(res->gpu_ms, res->num_frames);
+		const percentiles_t frame = compute_percentiles(res->frame_ms, res->num_frames);
+		const uint64_t upload = (res->num_frames > 0) ? res->upload_bytes[res->num_frames - 1] : 0;
+		fprintf(stderr, "%10d %6d %10d %9.3f %9.3f %9.3f %9.3f %9.3f %9.3f %12llu\n",
+			res->num_candles, res->zoom, res->num_visible, cpu.p50, cpu.p99, gpu.p50, gpu.p99,
+			frame.p50, frame.p99, (unsigned long long)upload);
+	}
+}
+
+/*== baseline comparison =====================================================*/
+
+// a minimal JSON reader for the baseline files written by write_json()
+typedef enum {
+	JSON_NULL,
+	JSON_BOOL,
+	JSON_NUMBER,
+	JSON_STRING,
+	JSON_ARRAY,
+	JSON_OBJECT,
+} json_type_t;
+
+typedef struct {
+	json_type_t type;
+	double number;
+	const char* key;		// object member name, points into the source text
+	int key_len;
+	int first_child;		// node index or -1
+	int next_sibling;		// node index or -1
+} json_node_t;
+
+static struct {
+	const char* ptr;
+	json_node_t* nodes;
+	int num_nodes;
+	int max_nodes;
+	bool error;
+} json;
+
+static void json_skip_whitespace(void) {
+	while ((*json.ptr == ' ') || (*json.ptr == '\t') || (*json.ptr == '\n') || (*json.ptr == '\r')) {
+		json.ptr++;
+	}
+}
+
+static int json_new_node(json_type_t type) {
+	if (json.num_nodes == json.max_nodes) {
+		json.max_nodes = (json.max_nodes == 0) ? 1024 : (json.max_nodes * 2);
+		json.nodes = (json_node_t*) realloc(json.nodes, (size_t)json.max_nodes * sizeof(json_node_t));
+	}
+	json_node_t* node = &json.nodes[json.num_nodes];
+	memset(node, 0, sizeof(json_node_t));
+	node->type = type;
+	node->first_child = -1;
+	node->next_sibling = -1;
+	return json.num_nodes++;
+}
+
+// skip a string and return its start and length, escapes are not decoded
+static const char* json_string(int* out_len) {
+	if (*json.ptr != '"') {
+		json.error = true;
+		return 0;
+	}
+	const char* start = ++json.ptr;
+	while (*json.ptr && (*json.ptr != '"')) {
+		json.ptr += ((json.ptr[0] == '\\') && json.ptr[1]) ? 2 : 1;
+	}
+	if (*json.ptr != '"') {
+		json.error = true;
+		return 0;
+	}
+	*out_len = (int)(json.ptr - start);
+	json.ptr++;
+	return start;
+}
+
+static int json_value(void);
+
+// parse the members of an array or object, the opening bracket has been consumed
+static void json_children(int parent, char close, bool has_keys) {
+	int prev = -1;
+	json_skip_whitespace();
+	if (*json.ptr == close) {
+		json.ptr++;
+		return;
+	}
+	while (!json.error) {
+		const char* key = 0;
+		int key_len = 0;
+		json_skip_whitespace();
+		if (has_keys) {
+			key = json_string(&key_len);
+			json_skip_whitespace();
+			if (json.error || (*json.ptr++ != ':')) {
+				json.error = true;
+				return;
+			}
+		}
+		const int child = json_value();
+		if (json.error) {
+			return;
+		}
+		json.nodes[child].key = key;
+		json.nodes[child].key_len = key_len;
+		if (prev < 0) {
+			json.nodes[parent].first_child = child;
+		} else {
+			json.nodes[prev].next_sibling = child;
+		}
+		prev = child;
+		json_skip_whitespace();
+		if (*json.ptr == ',') {
+			json.ptr++;
+		} else if (*json.ptr == close) {
+			json.ptr++;
+			return;
+		} else {
+			json.error = true;
+		}
+	}
+}
+
+static int json_value(void) {
+	json_skip_whitespace();
+	const char c = *json.ptr;
+	int node = -1;
+	if (c == '{') {
+		json.ptr++;
+		node = json_new_node(JSON_OBJECT);
+		json_children(node, '}', true);
+	} else if (c == '[') {
+		json.ptr++;
+		node = json_new_node(JSON_ARRAY);
+		json_children(node, ']', false);
+	} else if (c == '"') {
+		int len = 0;
+		json_string(&len);
+		node = json_new_node(JSON_STRING);
+	} else if (0 == strncmp(json.ptr, "null", 4)) {
+		json.ptr += 4;
+		node = json_new_node(JSON_NULL);
+	} else if (0 == strncmp(json.ptr, "true", 4)) {
+		json.ptr += 4;
+		node = json_new_node(JSON_BOOL);
+		json.nodes[node].number = 1.0;
+	} else if (0 == strncmp(json.ptr, "false", 5)) {
+		json.ptr += 5;
+		node = json_new_node(JSON_BOOL);
+	} else {
+		char* end = 0;
+		const double val = strtod(json.ptr, &end);
+		if (end == json.ptr) {
+			json.error = true;
+			return -1;
+		}
+		json.ptr = end;
+		node = json_new_node(JSON_NUMBER);
+		json.nodes[node].number = val;
+	}
+	return node;
+}
+
+static int json_member(int node, const char* key) {
+	if ((node < 0) || (json.nodes[node].type != JSON_OBJECT)) {
+		return -1;
+	}
+	const int key_len = (int)strlen(key);
+	for (int child = json.nodes[node].first_child; child >= 0; child = json.nodes[child].next_sibling) {
+		if ((json.nodes[child].key_len == key_len) && (0 == strncmp(json.nodes[child].key, key, (size_t)key_len))) {
+			return child;
+		}
+	}
+	return -1;
+}
+
+static double json_number(int node) {
+	return ((node >= 0) && (json.nodes[node].type == JSON_NUMBER)) ? json.nodes[node].number : 0.0;
+}
+
+// copy a number array into a new sample array
+static double* json_samples(int node, int* out_num) {
+	*out_num = 0;
+	if ((node < 0) || (json.nodes[node].type != JSON_ARRAY)) {
+		return 0;
+	}
+	int num = 0;
+	for (int child = json.nodes[node].first_child; child >= 0; child = json.nodes[child].next_sibling) {
+		num++;
+	}
+	if (num == 0) {
+		return 0;
+	}
+	double* samples = alloc_samples(num);
+	for (int child = json.nodes[node].first_child; child >= 0; child = json.nodes[child].next_sibling) {
+		samples[(*out_num)++] = json_number(child);
+	}
+	return samples;
+}
+
+static char* load_file(const char* path) {
+	FILE* fp = fopen(path, "rb");
+	if (fp == 0) {
+		return 0;
+	}
+	fseek(fp, 0, SEEK_END);
+	const long size = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+	char* text = 0;
+	if (size > 0) {
+		text = (char*) malloc((size_t)size + 1);
+		if (fread(text, (size_t)size, 1, fp) == 1) {
+			text[size] = 0;
+		} else {
+			free(text);
+			text = 0;
+		}
+	}
+	fclose(fp);
+	return text;
+}
+
+typedef struct {
+	double value;
+	int group;
+} rank_item_t;
+
+static int compare_rank_item(const void* a, const void* b) {
+	return compare_double(&((const rank_item_t*)a)->value, &((const rank_item_t*)b)->value);
+}
+
+/*
+	One-sided Mann-Whitney U-test: the p-value for the hypothesis that the
+	samples in b tend to be larger than the samples in a. Uses the normal
+	approximation with tie and continuity correction, which is accurate
+	enough for the sample counts of a benchmark run.
+*/
+static double mann_whitney_p(const double* a, int num_a, const double* b, int num_b) {
+	const int n = num_a + num_b;
+	if ((num_a == 0) || (num_b == 0)) {
+		return 1.0;
+	}
+	rank_item_t* items = (rank_item_t*) malloc((size_t)n * sizeof(rank_item_t));
+	for (int i = 0; i < num_a; i++) {
+		items[i] = { a[i], 0 };
+	}
+	for (int i = 0; i < num_b; i++) {
+		items[num_a + i] = { b[i], 1 };
+	}
+	qsort(items, (size_t)n, sizeof(rank_item_t), compare_rank_item);
+	// sum of the ranks of b, tied values get the average of their ranks
+	double rank_sum_b = 0.0;
+	double tie_sum = 0.0;
+	for (int i = 0; i < n;) {
+		int j = i + 1;
+		while ((j < n) && (items[j].value == items[i].value)) {
+			j++;
+		}
+		const double rank = 0.5 * (double)(i + 1 + j);
+		for (int k = i; k < j; k++) {
+			if (items[k].group == 1) {
+				rank_sum_b += rank;
+			}
+		}
+		const double t = (double)(j - i);
+		tie_sum += t * t * t - t;
+		i = j;
+	}
+	free(items);
+	const double u_b = rank_sum_b - 0.5 * num_b * (num_b + 1.0);
+	const double mean = 0.5 * num_a * num_b;
+	const double var = (num_a * (double)num_b / 12.0) * ((n + 1.0) - tie_sum / ((double)n * (n - 1.0)));
+	if (var <= 0.0) {
+		return 1.0;
+	}
+	const double z = (u_b - mean - 0.5) / sqrt(var);
+	return 0.5 * erfc(z / sqrt(2.0));
+}
+
+// the slowest tenth of the samples (at and above the p90), for the p99 test
+static double* upper_tail(const double* samples, int num, int* out_num) {
+	*out_num = 0;
+	if (num == 0) {
+		return 0;
+	}
+	double* sorted = alloc_samples(num);
+	memcpy(sorted, samples, (size_t)num * sizeof(double));
+	qsort(sorted, (size_t)num, sizeof(double), compare_double);
+	int first = (int)((90.0 / 100.0) * num + 0.999999) - 1;
+	first = (first < 0) ? 0 : first;
+	*out_num = num - first;
+	memmove(sorted, sorted + first, (size_t)*out_num * sizeof(double));
+	return sorted;
+}
+
+static double percent_change(double base, double cur) {
+	return (base > 0.0) ? (100.0 * (cur - base) / base) : 0.0;
+}
+
+// compare all results against the baseline file and print a report, returns the exit code
+static int compare_baseline(const char* path) {
+	char* text = load_file(path);
+	if (text == 0) {
+		fprintf(stderr, "perf gate: failed to load baseline %s\n", path);
+		return 2;
+	}
+	memset(&json, 0, sizeof(json));
+	json.ptr = text;
+	const int root = json_value();
+	const int base_results = json_member(root, "results");
+	if (json.error || (base_results < 0) || (json.nodes[base_results].type != JSON_ARRAY)) {
+		fprintf(stderr, "perf gate: failed to parse baseline %s\n", path);
+		free(json.nodes);
+		free(text);
+		return 2;
+	}
+
+	fprintf(stderr, "\nperf gate: baseline %s, thresholds p50/upload +%.1f%%, p99 +%.1f%%, alpha %g\n",
+		path, state.threshold, state.threshold_p99, state.alpha);
+	fprintf(stderr, "%10s %6s %26s %26s %18s %9s %9s  %s\n",
+		"candles", "zoom", "frame p50 ms", "frame p99 ms", "upload bytes", "U-test p", "tail p", "result");
+	int num_regressed = 0;
+	int num_compared = 0;
+	for (int i = 0; i < state.num_results; i++) {
+		const result_t* res = &state.results[i];
+		// find the baseline configuration with the same candle count and zoom level
+		int base = -1;
+		for (int node = json.nodes[base_results].first_child; node >= 0; node = json.nodes[node].next_sibling) {
+			if (((int)json_number(json_member(node, "candles")) == res->num_candles) &&
+				((int)json_number(json_member(node, "zoom")) == res->zoom))
+			{
+				base = node;
+				break;
+			}
+		}
+		const int base_samples = json_member(base, "samples");
+		int num_base_frames = 0;
+		int num_base_uploads = 0;
+		double* base_frame_ms = json_samples(json_member(base_samples, "frame_ms"), &num_base_frames);
+		double* base_upload = json_samples(json_member(base_samples, "upload_bytes"), &num_base_uploads);
+		if (num_base_frames == 0) {
+			fprintf(stderr, "%10d %6d %26s %26s %18s %9s %9s  no baseline\n", res->num_candles, res->zoom, "-", "-", "-", "-", "-");
+			free(base_frame_ms);
+			free(base_upload);
+			continue;
+		}
+		num_compared++;
+
+		double* upload = alloc_samples(res->num_frames);
+		for (int f = 0; f < res->num_frames; f++) {
+			upload[f] = (double)res->upload_bytes[f];
+		}
+		const percentiles_t cur_frame = compute_percentiles(res->frame_ms, res->num_frames);
+		const percentiles_t cur_upload = compute_percentiles(upload, res->num_frames);
+		const percentiles_t base_frame = compute_percentiles(base_frame_ms, num_base_frames);
+		const percentiles_t base_upl = compute_percentiles(base_upload, num_base_uploads);
+		const double p = mann_whitney_p(base_frame_ms, num_base_frames, res->frame_ms, res->num_frames);
+		// a tail regression doesn't move the median, so the p99 gets its own test on the slowest frames
+		int num_base_tail = 0;
+		int num_cur_tail = 0;
+		double* base_tail = upper_tail(base_frame_ms, num_base_frames, &num_base_tail);
+		double* cur_tail = upper_tail(res->frame_ms, res->num_frames, &num_cur_tail);
+		const double p_tail = mann_whitney_p(base_tail, num_base_tail, cur_tail, num_cur_tail);
+		free(base_tail);
+		free(cur_tail);
+		const double d50 = percent_change(base_frame.p50, cur_frame.p50);
+		const double d99 = percent_change(base_frame.p99, cur_frame.p99);
+		const double dup = percent_change(base_upl.p50, cur_upload.p50);
+		const bool significant = p < state.alpha;
+		const bool p50_regressed = significant && (d50 > state.threshold);
+		const bool p99_regressed = (p_tail < state.alpha) && (d99 > state.threshold_p99);
+		const bool upload_regressed = (base_upl.p50 > 0.0) ? (dup > state.threshold) : (cur_upload.p50 > 0.0);
+
+		char col_p50[32], col_p99[32], col_upload[32], verdict[64];
+		snprintf(col_p50, sizeof(col_p50), "%.4g->%.4g %+.1f%%", base_frame.p50, cur_frame.p50, d50);
+		snprintf(col_p99, sizeof(col_p99), "%.4g->%.4g %+.1f%%", base_frame.p99, cur_frame.p99, d99);
+		snprintf(col_upload, sizeof(col_upload), "%.0f->%.0f", base_upl.p50, cur_upload.p50);
+		if (p50_regressed || p99_regressed || upload_regressed) {
+			num_regressed++;
+			snprintf(verdict, sizeof(verdict), "REGRESSION:%s%s%s",
+				p50_regressed ? " p50" : "", p99_regressed ? " p99" : "", upload_regressed ? " upload" : "");
+		} else {
+			snprintf(verdict, sizeof(verdict), "ok");
+		}
+		fprintf(stderr, "%10d %6d %26s %26s %18s %9.4f %9.4f  %s\n",
+			res->num_candles, res->zoom, col_p50, col_p99, col_upload, p, p_tail, verdict);
+		free(upload);
+		free(base_frame_ms);
+		free(base_upload);
+	}
+	fprintf(stderr, "perf gate: %d of %d configurations regressed\n", num_regressed, num_compared);
+	free(json.nodes);
+	free(text);
+	return (num_regressed > 0) ? 1 : 0;
+}
+
+static void finish(void) {
+	print_summary();
+	FILE* fp = stdout;
+	if (state.out_path) {
+		fp = fopen(state.out_path, "w");
+		if (fp == 0) {
+			fprintf(stderr, "failed to open %s\n", state.out_path);
+			fp = stdout;
+		}
+	}
+	write_json(fp);
+	if (fp != stdout) {
+		fclose(fp);
+	}
+	if (state.baseline_path) {
+		state.exit_code = compare_baseline(state.baseline_path);
+	}
+	state.done = true;
+}
+
+void frame(void) {
+	if (state.done) {
+		return;
+	}
+	result_t* res = &state.results[state.cur_result];
+	if (!state.config_running) {
+		begin_config(res);
+	}
+
+	const uint64_t start = stm_now();
+	#if !defined(BENCH_DUMMY_BACKEND)
+	glBeginQuery(GL_TIME_ELAPSED, state.gpu_query);
+	#endif
+	update_live_candles();
+	render_frame(res);
+	sg_commit();
+	const double cpu_ms = stm_ms(stm_since(start));
+	double gpu_ms = 0.0;
+	#if !defined(BENCH_DUMMY_BACKEND)
+	glEndQuery(GL_TIME_ELAPSED);
+	// wait for the GPU so that every sample covers exactly one frame
+	glFinish();
+	GLuint64 gpu_ns = 0;
+	glGetQueryObjectui64v(state.gpu_query, GL_QUERY_RESULT, &gpu_ns);
+	gpu_ms = (double)gpu_ns / 1000000.0;
+	#endif
+	const double frame_ms = stm_ms(stm_since(start));
+
+	if (state.cur_frame >= state.warmup) {
+		const sg_frame_stats stats = sg_query_frame_stats();
+		const int i = res->num_frames++;
+		res->cpu_ms[i] = cpu_ms;
+		res->gpu_ms[i] = gpu_ms;
+		res->frame_ms[i] = frame_ms;
+		res->upload_bytes[i] = stats.size_uploaded;
+		res->num_draws = stats.num_draw;
+		res->num_primitives = stats.num_primitives;
+	}
+	state.cur_frame++;
+	if (state.cur_frame == (state.warmup + state.frames)) {
+		end_config();
+		state.cur_result++;
+		if ((state.cur_result == state.num_results) && (++state.cur_run < state.runs)) {
+			state.cur_result = 0;
+		}
+		if (state.cur_result == state.num_results) {
+			finish();
+			#if !defined(BENCH_DUMMY_BACKEND)
+			sapp_request_quit();
+			#endif
+		}
+	}
+}
+
+void cleanup(void) {
+	#if !defined(BENCH_DUMMY_BACKEND)
+	glDeleteQueries(1, &state.gpu_query);
+	#endif
+	for (int i = 0; i < state.num_results; i++) {
+		free(state.results[i].cpu_ms);
+		free(state.results[i].gpu_ms);
+		free(state.results[i].frame_ms);
+		free(state.results[i].upload_bytes);
+	}
+	sg_shutdown();
+	// the exit code of the performance gate
+	if (state.exit_code != 0) {
+		exit(state.exit_code);
+	}
+}
+
+#if defined(BENCH_DUMMY_BACKEND)
+int main(int argc, char *argv[]) {
+	if (!parse_args(argc, argv)) {
+		return 10;
+	}
+	init();
+	while (!state.done) {
+		frame();
+	}
+	cleanup();
+	return 0;
+}
+#else
+sapp_desc sokol_main(int argc, char *argv[]) {
+	if (!parse_args(argc, argv)) {
+		exit(10);
+	}
+	return (sapp_desc) {
+		.init_cb = init,
+		.frame_cb = frame,
+		.cleanup_cb = cleanup,
+		.width = state.width,
+		.height = state.height,
+		.window_title = "Instanced candle benchmark",
+		.headless = true,
+		.logger = {.func = slog_func}
+	};
+}
+#endif
@@ -0,0 +1,305 @@
+/* sokol-gfx tests on the dummy backend
+
+	Runs without a GPU or window system: sokol-gfx is compiled with the
+	dummy backend and command recording (see COMMAND RECORDING in
+	sokol_gfx.h), and with the validation layer in non-fatal mode, so that
+	validation errors can be checked via the logger.
+
+	build and run with:
+
+		make gfx-test
+
+	command line options:
+
+		--golden PATH       the golden command stream of the fixed test frame
+		                    (default: src/gfx_test.golden)
+		--update-golden     record the fixed test frame into the golden file
+		                    instead of comparing against it, only do this if
+		                    the change of the command stream is intended
+
+	The golden file is the raw command stream (see sg_dummy_query_commands()),
+	in native byte order, so it only matches on little-endian machines.
+
+	The process exits with code 1 if any check failed.
+*/
+#define SOKOL_IMPL
+#define SOKOL_DUMMY_BACKEND
+#define SOKOL_DEBUG
+#define SOKOL_VALIDATE_NON_FATAL
+
+#include "header/sokol_gfx.h"
+#include "header/sokol_log.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CHECK(cond) check((cond), #cond, __LINE__)
+
+static struct {
+	// options
+	const char* golden_path;
+	bool update_golden;
+
+	int num_checks;
+	int num_failed;
+	// log items of the errors logged by sokol-gfx since the last reset_log()
+	int num_errors;
+	uint32_t last_error;
+} state;
+
+static void check(bool cond, const char* expr, int line) {
+	state.num_checks++;
+	if (!cond) {
+		state.num_failed++;
+		fprintf(stderr, "FAIL: line %d: %s\n", line, expr);
+	}
+}
+
+static void logger(const char* tag, uint32_t log_level, uint32_t log_item, const char* message, uint32_t line_nr, const char* filename, void* user_data) {
+	// only error-level items, warnings are expected in some tests
+	if (log_level == 1) {
+		state.num_errors++;
+		state.last_error = log_item;
+	}
+	slog_func(tag, log_level, log_item, message, line_nr, filename, user_data);
+}
+
+static void reset_log(void) {
+	state.num_errors = 0;
+	state.last_error = 0;
+}
+
+static void setup(int transient_vertex_buffer_size) {
+	sg_desc desc = {};
+	desc.transient_vertex_buffer_size = transient_vertex_buffer_size;
+	desc.dummy_command_buffer_size = 64 * 1024;
+	desc.logger.func = logger;
+	sg_setup(&desc);
+	reset_log();
+}
+
+// number of recorded commands with the given command code
+static int count_commands(sg_dummy_command cmd) {
+	const sg_dummy_commands cmds = sg_dummy_query_commands();
+	const uint32_t* words = (const uint32_t*) cmds.data.ptr;
+	const size_t num_words = cmds.data.size / sizeof(uint32_t);
+	int num = 0;
+	for (size_t i = 0; i < num_words; i += 1 + (words[i] >> 16)) {
+		if ((words[i] & 0xFFFF) == (uint32_t)cmd) {
+			num++;
+		}
+	}
+	return num;
+}
+
+static sg_pipeline make_pipeline(void) {
+	sg_shader_desc shd_desc = {};
+	shd_desc.vertex_func.source = "vs";
+	shd_desc.fragment_func.source = "fs";
+	sg_pipeline_desc pip_desc = {};
+	pip_desc.shader = sg_make_shader(&shd_desc);
+	pip_desc.layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT3;
+	return sg_make_pipeline(&pip_desc);
+}
+
+static void begin_pass(void) {
+	sg_pass pass = {};
+	pass.swapchain.width = 64;
+	pass.swapchain.height = 64;
+	sg_begin_pass(&pass);
+}
+
+/*== transient buffers =======================================================*/
+
+// draws with ranges from an overflowed transient buffer are skipped without validation errors
+static void test_transient_overflow_skips_draws(void) {
+	setup(64);
+	sg_pipeline pip = make_pipeline();
+	const float verts[12] = {};
+	begin_pass();
+	sg_apply_pipeline(pip);
+	bool overflowed[3];
+	for (int i = 0; i < 3; i++) {
+		const sg_range data = SG_RANGE(verts);
+		const sg_transient_range r = sg_append_transient_vertices(&data);
+		overflowed[i] = r.overflowed;
+		sg_bindings bnd = {};
+		bnd.vertex_buffers[0] = r.buffer;
+		bnd.vertex_buffer_offsets[0] = r.offset;
+		sg_apply_bindings(&bnd);
+		sg_draw(0, 3, 1);
+	}
+	sg_end_pass();
+	CHECK(!overflowed[0] && overflowed[1] && overflowed[2]);
+	CHECK(sg_query_transient_overflow());
+	CHECK(state.num_errors == 0);
+	CHECK(count_commands(SG_DUMMYCOMMAND_DRAW) == 1);
+	sg_commit();
+	sg_shutdown();
+}
+
+// a missing vertex buffer binding still fails validation after a transient buffer overflow
+static void test_transient_overflow_keeps_validation(void) {
+	setup(64);
+	sg_pipeline pip = make_pipeline();
+	const float verts[12] = {};
+	begin_pass();
+	sg_apply_pipeline(pip);
+	for (int i = 0; i < 2; i++) {
+		const sg_range data = SG_RANGE(verts);
+		sg_append_transient_vertices(&data);
+	}
+	CHECK(sg_query_transient_overflow());
+	reset_log();
+	sg_bindings bnd = {};
+	sg_apply_bindings(&bnd);
+	sg_draw(0, 3, 1);
+	sg_end_pass();
+	CHECK(state.num_errors > 0);
+	CHECK(state.last_error == SG_LOGITEM_VALIDATE_ABND_EXPECTED_VBUF);
+	CHECK(count_commands(SG_DUMMYCOMMAND_DRAW) == 0);
+	sg_commit();
+	sg_shutdown();
+}
+
+/*== command recording =======================================================*/
+
+static sg_range load_file(const char* path) {
+	sg_range res = {};
+	FILE* fp = fopen(path, "rb");
+	if (fp == 0) {
+		return res;
+	}
+	fseek(fp, 0, SEEK_END);
+	const long size = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+	if (size > 0) {
+		void* data = malloc((size_t)size);
+		if (fread(data, (size_t)size, 1, fp) == 1) {
+			res.ptr = data;
+			res.size = (size_t)size;
+		} else {
+			free(data);
+		}
+	}
+	fclose(fp);
+	return res;
+}
+
+static bool save_file(const char* path, const sg_range* data) {
+	FILE* fp = fopen(path, "wb");
+	if (fp == 0) {
+		return false;
+	}
+	bool ok = (fwrite(data->ptr, data->size, 1, fp) == 1);
+	ok &= (fclose(fp) == 0);
+	return ok;
+}
+
+/*
+	Creates the resources and renders one fixed frame. Every state change
+	is applied twice, so that the frame stats must count exactly one
+	redundant change of each kind.
+*/
+static void render_fixed_frame(void) {
+	const float verts[] = { 0.0f, 0.5f, 0.5f, 0.5f, -0.5f, 0.5f, -0.5f, -0.5f, 0.5f };
+	sg_buffer_desc buf_desc = {};
+	buf_desc.data = SG_RANGE(verts);
+	const sg_buffer vbuf = sg_make_buffer(&buf_desc);
+	sg_shader_desc shd_desc = {};
+	shd_desc.vertex_func.source = "vs";
+	shd_desc.fragment_func.source = "fs";
+	shd_desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+	shd_desc.uniform_blocks[0].size = 16;
+	sg_pipeline_desc pip_desc = {};
+	pip_desc.shader = sg_make_shader(&shd_desc);
+	pip_desc.layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT3;
+	const sg_pipeline pip = sg_make_pipeline(&pip_desc);
+	sg_bindings bnd = {};
+	bnd.vertex_buffers[0] = vbuf;
+	const float color[4] = { 1.0f, 0.5f, 0.25f, 1.0f };
+	const sg_range ub = SG_RANGE(color);
+
+	begin_pass();
+	for (int i = 0; i < 2; i++) {
+		sg_apply_viewport(0, 0, 64, 64, true);
+	}
+	for (int i = 0; i < 2; i++) {
+		sg_apply_pipeline(pip);
+	}
+	for (int i = 0; i < 2; i++) {
+		sg_apply_bindings(&bnd);
+	}
+	for (int i = 0; i < 2; i++) {
+		sg_apply_uniforms(0, &ub);
+	}
+	sg_draw(0, 3, 1);
+	sg_end_pass();
+	sg_commit();
+}
+
+// the command stream of the fixed frame matches the golden file
+static void test_golden_command_stream(void) {
+	setup(0);
+	sg_enable_frame_stats();
+	render_fixed_frame();
+	const sg_dummy_commands cmds = sg_dummy_query_commands();
+	CHECK(!cmds.overflow);
+	CHECK(count_commands(SG_DUMMYCOMMAND_DRAW) == 1);
+	if (state.update_golden) {
+		const bool saved = save_file(state.golden_path, &cmds.data);
+		CHECK(saved);
+		if (saved) {
+			fprintf(stderr, "wrote %d commands to %s\n", cmds.num_commands, state.golden_path);
+		}
+	} else {
+		const sg_range golden = load_file(state.golden_path);
+		if (golden.ptr == 0) {
+			fprintf(stderr, "failed to load %s\n", state.golden_path);
+		}
+		CHECK(golden.ptr != 0);
+		const int first_diff = sg_dummy_compare_commands(&golden);
+		if (first_diff >= 0) {
+			fprintf(stderr, "command %d differs from %s\n", first_diff, state.golden_path);
+		}
+		CHECK(first_diff == -1);
+		free((void*)golden.ptr);
+	}
+	// the stats of the frame which has just been committed
+	const sg_frame_stats stats = sg_query_frame_stats();
+	CHECK(stats.dummy.num_redundant_viewport == 1);
+	CHECK(stats.dummy.num_redundant_pipeline == 1);
+	CHECK(stats.dummy.num_redundant_vertex_buffer == 1);
+	CHECK(stats.dummy.num_redundant_index_buffer == 0);
+	CHECK(stats.dummy.num_redundant_uniforms == 1);
+	CHECK(state.num_errors == 0);
+	sg_shutdown();
+}
+
+static bool parse_args(int argc, char* argv[]) {
+	state.golden_path = "src/gfx_test.golden";
+	for (int i = 1; i < argc; i++) {
+		const char* arg = argv[i];
+		if (0 == strcmp(arg, "--update-golden")) {
+			state.update_golden = true;
+		} else if ((0 == strcmp(arg, "--golden")) && ((i + 1) < argc)) {
+			state.golden_path = argv[++i];
+		} else {
+			fprintf(stderr, "unknown option %s\n", arg);
+			return false;
+		}
+	}
+	return true;
+}
+
+int main(int argc, char* argv[]) {
+	if (!parse_args(argc, argv)) {
+		return 10;
+	}
+	test_transient_overflow_skips_draws();
+	test_transient_overflow_keeps_validation();
+	test_golden_command_stream();
+	fprintf(stderr, "%d of %d checks failed\n", state.num_failed, state.num_checks);
+	return (state.num_failed > 0) ? 1 : 0;
+}
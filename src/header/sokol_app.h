@@ -279,6 +279,12 @@
             Returns the frame duration in seconds averaged over a number of
             frames to smooth out any jittering spikes.
 
+        int sapp_query_frame_timings(sapp_frame_timing* out_items, int max_items)
+        sapp_frame_timing_stats sapp_query_frame_timing_stats(void)
+            Provide access to detailed per-frame timing information of
+            the most recent frames, and percentile statistics over those
+            frames, see the section FRAME TIMING HISTORY below.
+
         int sapp_color_format(void)
         int sapp_depth_format(void)
             The color and depth-stencil pixelformats of the default framebuffer,
@@ -361,6 +367,18 @@
             Returns the major and minor version of the GL context and
             whether the GL context is a GLES context
 
+        bool sapp_gl_make_upload_context_current(void)
+        void sapp_gl_release_upload_context(void)
+            On Linux with GLX or EGL, and when sapp_desc.gl_upload_context
+            is true, sokol_app.h creates a second GL context which shares
+            GL objects with the main context. Call
+            sapp_gl_make_upload_context_current() on a worker thread to make
+            this context current on that thread (returns false if the upload
+            context isn't available), and sapp_gl_release_upload_context()
+            before the worker thread finishes. Only one thread may use the
+            upload context at a time. See the section BACKGROUND UPLOADS in
+            sokol_gfx.h for what to do with it.
+
         const void* sapp_android_get_native_activity(void);
             On Android, get the native activity ANativeActivity pointer, otherwise
             a null pointer.
@@ -888,6 +906,259 @@
     or the user leaves fullscreen via Esc), this means that the result
     of sapp_is_fullscreen() may change also without calling sapp_toggle_fullscreen()!
 
+    On Linux, the _NET_WM_BYPASS_COMPOSITOR window property is set while the
+    window is in fullscreen mode, this allows compositing window managers
+    to unredirect the window, which saves a copy and usually one frame of
+    latency.
+
+    SWAP INTERVAL
+    =============
+    The sapp_desc.swap_interval item defines the number of display refreshes
+    per presented frame (default is 1, meaning the frame callback will be
+    called at the display refresh rate).
+
+    On Linux with GLX, the swap interval may also be negative to request
+    'adaptive vsync' (via the GLX_EXT_swap_control_tear extension): frames
+    are synchronized with the display refresh as long as the application
+    keeps up, but late frames are presented immediately (with tearing)
+    instead of waiting for the next vertical blank. If the extension
+    isn't supported (and on all other platforms), a negative swap interval
+    is treated like its absolute value.
+
+    On Linux (GLX and EGL), the swap interval can be changed at runtime
+    with:
+
+        sapp_set_swap_interval(int interval)
+
+    ...for instance to temporarily switch off vsync (interval 0) for
+    lowest-latency rendering while the user is dragging with the mouse.
+    The swap interval which is actually in use can be queried with
+    sapp_swap_interval(), this is the absolute value of a requested
+    negative interval when adaptive vsync isn't supported. On other
+    platforms sapp_set_swap_interval() has no effect.
+
+
+    RENDER ON DEMAND
+    ================
+    By default, sokol-app calls the frame callback continuously at the
+    display refresh rate (or as fast as possible without vsync). For
+    applications which show mostly static content this wastes CPU and GPU
+    time. When sapp_desc.render_on_demand is true, the frame callback is
+    only called when:
+
+        - an event has been received from the window system (input events,
+          window resizing, focus changes, exposure, ...)
+        - sapp_request_redraw() has been called
+        - the delay passed to sapp_schedule_redraw() has elapsed
+
+    ...and in between, the application thread sleeps in the OS until one
+    of those things happens. The first frame is always rendered.
+
+    To run an animation for a while, call sapp_request_redraw() from inside
+    the frame callback until the animation is finished. For animations
+    with a low update rate (for instance a blinking text cursor or a
+    once-per-second clock), call sapp_schedule_redraw() with the delay in
+    seconds until the next update instead. Only the earliest scheduled
+    redraw is kept.
+
+    Both functions must be called from the main thread.
+
+    To wake up a sleeping event loop from another thread (for instance
+    when a worker thread has produced new data which needs to be
+    displayed), call:
+
+        sapp_wakeup()
+
+    This is the only sokol-app function which is safe to call from any
+    thread. It interrupts the wait for window system events and causes
+    the frame callback to be called as soon as the main thread is
+    scheduled. Repeated calls before the next frame are coalesced into a
+    single wakeup, so it's fine to call sapp_wakeup() for each produced
+    data item. Calls before the init callback or after the cleanup
+    callback are ignored.
+
+    sapp_wakeup() is currently implemented on Linux (X11) through an
+    eventfd which is polled together with the X11 connection. When
+    render-on-demand is not enabled, the event loop doesn't sleep on
+    window system events and sapp_wakeup() has no effect (the frame
+    callback is called continuously anyway). The same is true on all
+    other platforms.
+
+    Render-on-demand is currently only implemented on Linux (X11), on all
+    other platforms the flag is ignored and the frame callback is called
+    continuously. The value returned by sapp_frame_duration() is only
+    updated from frames which are rendered back-to-back.
+
+    COALESCED MOUSE EVENTS
+    ======================
+    High-rate mice may produce hundreds of mouse move events per frame,
+    which are all forwarded to the event callback. If the application
+    does expensive work per mouse-move event this can easily eat up a
+    big part of the frame budget. By setting sapp_desc.coalesce_mouse_events
+    to true, consecutive events of the same type are merged:
+
+        - consecutive SAPP_EVENTTYPE_MOUSE_MOVE events are merged into a
+          single event with the latest mouse position and modifiers,
+          and the mouse_dx/mouse_dy deltas summed up (this also works
+          with mouse lock)
+        - consecutive SAPP_EVENTTYPE_MOUSE_SCROLL events are merged into
+          a single event with the summed up scroll_x/scroll_y values
+
+    Any other event (for instance a mouse button or key press) ends the
+    current sequence, so that the relative order of events is preserved.
+    The sapp_event.num_coalesced item contains the number of native
+    events which have been merged into the event (when coalescing is not
+    active, num_coalesced is 0).
+
+    Mouse event coalescing is currently only implemented on Linux (X11),
+    on all other platforms the flag is ignored.
+
+    RENDER THREAD
+    =============
+    By default, sokol-app pumps window system events, calls the event
+    callback and calls the frame callback (including the buffer swap)
+    all on the main thread. This means that a blocking buffer swap or a
+    slow frame callback delays input handling, and a burst of window
+    system events delays rendering.
+
+    On Linux with GLX or EGL, setting sapp_desc.render_thread to true
+    moves all user callbacks (init_cb, frame_cb, event_cb and cleanup_cb)
+    together with the GL context to a dedicated render thread:
+
+        - the main thread only waits for, receives and translates X11
+          events, and passes the resulting sapp_event structs to the
+          render thread through a lock-free queue
+        - the render thread calls the event callback for all queued events
+          at the start of each frame, then calls the frame callback and
+          presents the frame
+
+    This means that all sokol-app functions which are called from inside
+    the callbacks are called on the render thread, and also that all
+    sokol-gfx calls happen on the render thread.
+
+    There are a few restrictions in render-thread mode:
+
+        - sapp_consume_event() has no effect
+        - reading the clipboard via sapp_get_clipboard_string() and
+          accessing dropped files is not thread-safe and should be avoided
+        - sapp_desc.render_on_demand is not supported and will be ignored
+        - if the event queue is full (because the render thread is stuck
+          in a very long frame), the main thread waits until there's space
+          in the queue, so that no input is lost
+
+    On all other platforms and with WebGPU the flag is ignored.
+
+    FRAME TIMING HISTORY
+    ====================
+    The averaged value returned by sapp_frame_duration() is useful for
+    animations, but hides frame time spikes. For monitoring frame pacing,
+    sokol-app records timing information for the last 256 frames, which can
+    be inspected with:
+
+        int sapp_query_frame_timings(sapp_frame_timing* out_items, int max_items)
+
+    This copies up to max_items sapp_frame_timing structs of the most recent
+    frames into out_items (oldest frame first, newest frame last) and
+    returns the number of copied items. Note that the timing for the
+    current frame isn't complete until the frame callback has returned,
+    so the newest item is the previous frame. The struct contains:
+
+        - frame_count: the frame counter of the frame
+        - start: the time when the frame started, in seconds
+        - frame_cb_duration: how long the frame callback took, in seconds
+        - swap_done: the time when the buffer swap call returned
+          (0.0 if not available on the platform)
+        - present: the time when the frame was presented on the display
+          (0.0 if not available or not yet known)
+        - missed_vblanks: the number of vertical blanks the frame was late
+        - discontinuity: true if the event loop was idle before this frame
+          (render-on-demand), the time since the previous frame's start
+          isn't a frame duration and no vertical blanks are counted as
+          missed for this frame
+
+    All times are in seconds and measured on the same clock.
+
+    Percentile statistics over the recorded frames can be obtained with:
+
+        sapp_frame_timing_stats sapp_query_frame_timing_stats(void)
+
+    The returned struct contains the number of frames the statistics have been
+    computed from, 50th/95th/99th percentile and maximum of the start-to-start
+    frame duration and frame callback duration, and the total number of
+    missed vertical blanks since application start. Idle intervals in
+    render-on-demand mode (frames with the discontinuity flag) are not
+    part of the frame durations.
+
+    Swap timestamps are currently only recorded on Linux. Presentation times
+    and missed vertical blanks are only available on Linux with GLX and the
+    GLX_OML_sync_control extension, the presentation time of a frame is
+    the time of the vertical blank at which its buffer swap had been observed
+    as completed, so it may be late by up to one refresh interval. The
+    missed-vblank count is only valid when vsync is enabled (swap
+    interval != 0). On the web platform no frame timing history is recorded.
+
+    INPUT LATENCY TRACKING
+    ======================
+    When sapp_desc.input_latency_tracking is true, sokol-app measures the
+    time from an input event (mouse move, mouse button or key event)
+    until the frame which first had a chance to react to that input
+    appears on the display. The latency statistics can be obtained with:
+
+        sapp_input_latency_stats sapp_query_input_latency_stats(void)
+
+    ...and reset (for instance after a warmup phase) with:
+
+        void sapp_reset_input_latency_stats(void)
+
+    The statistics contain a histogram with 1 millisecond buckets,
+    the 50th, 95th and 99th latency percentile and the maximum latency.
+
+    The measurement starts at the window system's timestamp of the
+    earliest input event which was received before a frame, and ends
+    at the presentation time of that frame (see FRAME TIMING HISTORY).
+    If presentation times are not available, the measurement ends when
+    the swap-buffers call returns instead (the present_based item in
+    the stats struct tells which one it is).
+
+    For automated latency regression tests, synthetic input events can be
+    injected with the XTest extension (for instance against an Xvfb server
+    with `xdotool mousemove`), note that Xvfb doesn't support
+    GLX_OML_sync_control, so latencies will be measured until the
+    swap-buffers call returns.
+
+    Input latency tracking is currently only implemented on Linux (X11).
+
+    HEADLESS MODE
+    =============
+    For rendering on servers without a display (for instance to generate
+    image snapshots with the help of sokol_snapshot.h), set
+    sapp_desc.headless to true. In headless mode, sokol-app doesn't
+    connect to an X server and doesn't create a window, instead the GL
+    context is created directly on an EGL display:
+
+        - if available, the Mesa surfaceless platform (EGL_MESA_platform_surfaceless)
+          is used, this works without any GPU with the llvmpipe software rasterizer
+        - otherwise the default EGL display is used
+
+    If the EGL display supports EGL_KHR_surfaceless_context, the context is
+    made current without any surface, this means there's no default
+    framebuffer, and all rendering must happen in offscreen passes into
+    sokol-gfx images. Otherwise an EGL pbuffer surface of size
+    sapp_desc.width * sapp_desc.height is created as default framebuffer
+    (default size is 640 * 480).
+
+    The frame callback is called in a tight loop until the application
+    calls sapp_request_quit() or sapp_quit(), no input events are generated,
+    and sapp_width() / sapp_height() return the size from the sapp_desc
+    struct. Window related functions (like changing the window title,
+    the mouse cursor or the fullscreen state) are silently ignored.
+    sapp_desc.render_thread and sapp_desc.render_on_demand have no effect
+    in headless mode.
+
+    Headless mode is only supported on Linux with EGL, this means that
+    sokol_app.h must be compiled with SOKOL_GLES3, or SOKOL_GLCORE together
+    with SOKOL_FORCE_EGL (and linked with -lEGL). In GLX builds, running
+    headless is a fatal error.
 
     WINDOW ICON SUPPORT
     ===================
@@ -1599,6 +1870,7 @@ typedef struct sapp_event {
     float mouse_dy;                     // relative vertical mouse movement since last frame, always valid
     float scroll_x;                     // horizontal mouse wheel scroll distance, valid in MOUSE_SCROLL events
     float scroll_y;                     // vertical mouse wheel scroll distance, valid in MOUSE_SCROLL events
+    int num_coalesced;                  // number of native events merged into this MOUSE_MOVE or MOUSE_SCROLL event (see sapp_desc.coalesce_mouse_events), otherwise 0
     int num_touches;                    // number of valid items in the touches[] array
     sapp_touchpoint touches[SAPP_MAX_TOUCHPOINTS];  // current touch points, valid in TOUCHES_BEGIN, TOUCHES_MOVED, TOUCHES_ENDED
     int window_width;                   // current window- and framebuffer sizes in pixels, always valid
@@ -1744,6 +2016,14 @@ typedef struct sapp_allocator {
     _SAPP_LOGITEM_XMACRO(LINUX_X11_QUERY_SYSTEM_DPI_FAILED, "failed to query system dpi value, assuming default 96.0") \
     _SAPP_LOGITEM_XMACRO(LINUX_X11_DROPPED_FILE_URI_WRONG_SCHEME, "dropped file URL doesn't start with 'file://'") \
     _SAPP_LOGITEM_XMACRO(LINUX_X11_FAILED_TO_BECOME_OWNER_OF_CLIPBOARD, "X11: Failed to become owner of clipboard selection") \
+    _SAPP_LOGITEM_XMACRO(LINUX_X11_CREATE_WAKEUP_EVENTFD_FAILED, "X11: failed to create eventfd for sapp_wakeup()") \
+    _SAPP_LOGITEM_XMACRO(LINUX_RENDER_THREAD_WGPU_NOT_SUPPORTED, "sapp_desc.render_thread is not supported with WebGPU (ignored)") \
+    _SAPP_LOGITEM_XMACRO(LINUX_RENDER_THREAD_RENDER_ON_DEMAND_NOT_SUPPORTED, "sapp_desc.render_on_demand is not supported together with sapp_desc.render_thread (ignored)") \
+    _SAPP_LOGITEM_XMACRO(LINUX_RENDER_THREAD_CREATE_FAILED, "failed to create render thread, falling back to main thread") \
+    _SAPP_LOGITEM_XMACRO(LINUX_GLX_CREATE_UPLOAD_CONTEXT_FAILED, "failed to create shared GLX context for background uploads") \
+    _SAPP_LOGITEM_XMACRO(LINUX_EGL_CREATE_UPLOAD_CONTEXT_FAILED, "failed to create shared EGL context for background uploads") \
+    _SAPP_LOGITEM_XMACRO(LINUX_EGL_CREATE_PBUFFER_SURFACE_FAILED, "eglCreatePbufferSurface() failed") \
+    _SAPP_LOGITEM_XMACRO(LINUX_HEADLESS_REQUIRES_EGL, "sapp_desc.headless requires EGL (define SOKOL_FORCE_EGL or use SOKOL_GLES3)") \
     _SAPP_LOGITEM_XMACRO(ANDROID_UNSUPPORTED_INPUT_EVENT_INPUT_CB, "unsupported input event encountered in _sapp_android_input_cb()") \
     _SAPP_LOGITEM_XMACRO(ANDROID_UNSUPPORTED_INPUT_EVENT_MAIN_CB, "unsupported input event encountered in _sapp_android_main_cb()") \
     _SAPP_LOGITEM_XMACRO(ANDROID_READ_MSG_FAILED, "failed to read message in _sapp_android_main_cb()") \
@@ -1842,7 +2122,7 @@ typedef struct sapp_desc {
     int width;                          // the preferred width of the window / canvas
     int height;                         // the preferred height of the window / canvas
     int sample_count;                   // MSAA sample count
-    int swap_interval;                  // the preferred swap interval (ignored on some platforms)
+    int swap_interval;                  // the preferred swap interval, negative for adaptive vsync (ignored on some platforms)
     bool high_dpi;                      // whether the rendering canvas is full-resolution on HighDPI displays
     bool fullscreen;                    // whether the window should be created in fullscreen mode
     bool alpha;                         // whether the framebuffer should have an alpha channel (ignored on some platforms)
@@ -1850,6 +2130,12 @@ typedef struct sapp_desc {
     bool enable_clipboard;              // enable clipboard access, default is false
     int clipboard_size;                 // max size of clipboard content in bytes
     bool enable_dragndrop;              // enable file dropping (drag'n'drop), default is false
+    bool render_on_demand;              // only call frame_cb on input, resize or sapp_request_redraw() (Linux only), default is false
+    bool coalesce_mouse_events;         // merge consecutive mouse move and scroll events into one event (Linux only), default is false
+    bool render_thread;                 // call init/frame/event/cleanup callbacks on a separate render thread (Linux with GL only), default is false
+    bool gl_upload_context;             // create a shared GL context for background uploads (Linux with GL only), default is false
+    bool input_latency_tracking;        // measure input-to-present latency (Linux only), default is false
+    bool headless;                      // run without a window on an EGL surfaceless or pbuffer context (Linux with EGL only), default is false
     int max_dropped_files;              // max number of dropped files to process (default: 1)
     int max_dropped_file_path_length;   // max length in bytes of a dropped UTF-8 file path (default: 2048)
     sapp_icon_desc icon;                // the initial window icon to set
@@ -1878,6 +2164,60 @@ typedef struct sapp_desc {
     bool ios_keyboard_resizes_canvas;   // if true, showing the iOS keyboard shrinks the canvas
 } sapp_desc;
 
+/*
+    sapp_frame_timing
+
+    Timing information for a single frame, see sapp_query_frame_timings()
+    and the section FRAME TIMING HISTORY for details.
+*/
+typedef struct sapp_frame_timing {
+    uint64_t frame_count;       // the frame counter of this frame
+    double start;               // time when the frame started, in seconds
+    double frame_cb_duration;   // duration of the frame callback, in seconds
+    double swap_done;           // time when the swap-buffers call returned, 0.0 if not available
+    double present;             // time when the frame was presented, 0.0 if not available
+    int missed_vblanks;         // number of vertical blanks the frame missed (only valid if present > 0.0)
+    bool discontinuity;         // true if the event loop was idle before this frame (render-on-demand)
+} sapp_frame_timing;
+
+typedef struct sapp_frame_percentiles {
+    double p50;
+    double p95;
+    double p99;
+    double max;
+} sapp_frame_percentiles;
+
+/*
+    sapp_frame_timing_stats
+
+    Percentile statistics over the recent frame timing history,
+    returned by sapp_query_frame_timing_stats().
+*/
+typedef struct sapp_frame_timing_stats {
+    int num_frames;                             // number of frames in the statistics
+    sapp_frame_percentiles frame_duration;      // start-to-start frame durations in seconds
+    sapp_frame_percentiles frame_cb_duration;   // frame callback durations in seconds
+    uint64_t missed_vblanks;                    // total number of missed vertical blanks since start
+} sapp_frame_timing_stats;
+
+/*
+    sapp_input_latency_stats
+
+    Input-to-present latency statistics, returned by
+    sapp_query_input_latency_stats(), see the section INPUT LATENCY
+    TRACKING for details.
+*/
+#define SAPP_INPUT_LATENCY_NUM_BUCKETS (128)
+typedef struct sapp_input_latency_stats {
+    int num_samples;            // number of measured frames
+    bool present_based;         // true if measured until frame presentation, false if until swap-buffers returned
+    double p50;                 // latency percentiles in seconds (at 1 millisecond resolution)
+    double p95;
+    double p99;
+    double max;                 // the exact maximum latency in seconds
+    int histogram[SAPP_INPUT_LATENCY_NUM_BUCKETS];  // 1 millisecond buckets, the last bucket counts all larger values
+} sapp_input_latency_stats;
+
 /* HTML5 specific: request and response structs for
    asynchronously loading dropped-file content.
 */
@@ -1970,6 +2310,10 @@ SOKOL_APP_API_DECL bool sapp_keyboard_shown(void);
 SOKOL_APP_API_DECL bool sapp_is_fullscreen(void);
 /* toggle fullscreen mode */
 SOKOL_APP_API_DECL void sapp_toggle_fullscreen(void);
+/* change the swap interval at runtime, negative for adaptive vsync (Linux only) */
+SOKOL_APP_API_DECL void sapp_set_swap_interval(int interval);
+/* get the current swap interval */
+SOKOL_APP_API_DECL int sapp_swap_interval(void);
 /* show or hide the mouse cursor */
 SOKOL_APP_API_DECL void sapp_show_mouse(bool show);
 /* show or hide the mouse cursor */
@@ -2002,6 +2346,22 @@ SOKOL_APP_API_DECL void sapp_consume_event(void);
 SOKOL_APP_API_DECL uint64_t sapp_frame_count(void);
 /* get an averaged/smoothed frame duration in seconds */
 SOKOL_APP_API_DECL double sapp_frame_duration(void);
+/* copy timing information of the most recent frames, returns number of copied items */
+SOKOL_APP_API_DECL int sapp_query_frame_timings(sapp_frame_timing* out_items, int max_items);
+/* get percentile statistics over the recent frame timing history */
+SOKOL_APP_API_DECL sapp_frame_timing_stats sapp_query_frame_timing_stats(void);
+/* get input-to-present latency statistics (see sapp_desc.input_latency_tracking) */
+SOKOL_APP_API_DECL sapp_input_latency_stats sapp_query_input_latency_stats(void);
+/* reset the input-to-present latency statistics */
+SOKOL_APP_API_DECL void sapp_reset_input_latency_stats(void);
+/* return true if the application runs without a window (see sapp_desc.headless) */
+SOKOL_APP_API_DECL bool sapp_headless(void);
+/* in render-on-demand mode: request a frame_cb call in the next loop iteration */
+SOKOL_APP_API_DECL void sapp_request_redraw(void);
+/* in render-on-demand mode: request a frame_cb call after a delay in seconds (for animations) */
+SOKOL_APP_API_DECL void sapp_schedule_redraw(double delay_seconds);
+/* wake up the event loop and request a redraw, may be called from any thread */
+SOKOL_APP_API_DECL void sapp_wakeup(void);
 /* write string into clipboard */
 SOKOL_APP_API_DECL void sapp_set_clipboard_string(const char* str);
 /* read string from clipboard (usually during SAPP_EVENTTYPE_CLIPBOARD_PASTED) */
@@ -2075,6 +2435,10 @@ SOKOL_APP_API_DECL int sapp_gl_get_major_version(void);
 SOKOL_APP_API_DECL int sapp_gl_get_minor_version(void);
 /* GL: return true if the context is GLES */
 SOKOL_APP_API_DECL bool sapp_gl_is_gles(void);
+/* GL: make the shared upload context current on the calling thread (see sapp_desc.gl_upload_context) */
+SOKOL_APP_API_DECL bool sapp_gl_make_upload_context_current(void);
+/* GL: release the shared upload context from the calling thread */
+SOKOL_APP_API_DECL void sapp_gl_release_upload_context(void);
 
 /* X11: get Window */
 SOKOL_APP_API_DECL const void* sapp_x11_get_window(void);
@@ -2360,6 +2724,9 @@ inline void sapp_run(const sapp_desc& desc) { return sapp_run(&desc); }
     #include <pthread.h>    /* only used a linker-guard, search for _sapp_linux_run() and see first comment */
     #include <time.h>
     #include <poll.h>
+    #include <unistd.h>
+    #include <sched.h> /* sched_yield() */
+    #include <sys/eventfd.h> /* sapp_wakeup() */
 #endif
 
 #if defined(_SAPP_APPLE)
@@ -2590,6 +2957,179 @@ _SOKOL_PRIVATE double _sapp_timing_get_avg(_sapp_timing_t* t) {
     return t->avg;
 }
 
+// input-to-present latency tracking
+typedef struct {
+    bool enabled;
+    int64_t pending_ns;     // time of earliest unconsumed input event in nanoseconds, 0 if none (accessed via atomics)
+    bool frame_begun;       // true if the input time of the current frame has been taken
+    double frame_input;     // time of the earliest input event consumed by the current frame, 0.0 if none
+    int num_samples;
+    double max;
+    int histogram[SAPP_INPUT_LATENCY_NUM_BUCKETS];
+} _sapp_input_latency_t;
+
+// called when an input event is received (may be called on a different thread than the frame)
+_SOKOL_PRIVATE void _sapp_input_latency_push(_sapp_input_latency_t* l, double event_time) {
+    int64_t expected = 0;
+    int64_t t = (int64_t)(event_time * 1000000000.0);
+    if (t <= 0) {
+        t = 1;
+    }
+    // only keep the earliest unconsumed event
+    __atomic_compare_exchange_n(&l->pending_ns, &expected, t, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+// called at the start of a frame (with a render thread, before the queued events
+// are dispatched), input events which arrive later are credited to the next frame
+_SOKOL_PRIVATE void _sapp_input_latency_begin_frame(_sapp_input_latency_t* l) {
+    if (!l->enabled || l->frame_begun) {
+        return;
+    }
+    l->frame_begun = true;
+    const int64_t t = __atomic_exchange_n(&l->pending_ns, 0, __ATOMIC_ACQ_REL);
+    l->frame_input = (double)t / 1000000000.0;
+}
+
+// called at the end of a frame, returns the earliest input event time consumed by the frame, or 0.0
+_SOKOL_PRIVATE double _sapp_input_latency_take(_sapp_input_latency_t* l) {
+    const double t = l->frame_input;
+    l->frame_begun = false;
+    l->frame_input = 0.0;
+    return t;
+}
+
+_SOKOL_PRIVATE void _sapp_input_latency_sample(_sapp_input_latency_t* l, double latency) {
+    if (latency < 0.0) {
+        latency = 0.0;
+    }
+    int bucket = (int)(latency * 1000.0);
+    if (bucket >= SAPP_INPUT_LATENCY_NUM_BUCKETS) {
+        bucket = SAPP_INPUT_LATENCY_NUM_BUCKETS - 1;
+    }
+    l->histogram[bucket]++;
+    l->num_samples++;
+    if (latency > l->max) {
+        l->max = latency;
+    }
+}
+
+// per-frame timing history for sapp_query_frame_timings()
+#define _SAPP_FRAME_HISTORY_SIZE (256)
+typedef struct {
+    uint64_t count;             // total number of recorded frames
+    int64_t swap_count;         // total number of buffer swaps
+    int64_t last_msc;           // media stream counter of the last observed presentation
+    uint64_t missed_vblanks;
+    bool discontinuity;         // the next recorded frame follows an idle wait
+    sapp_frame_timing items[_SAPP_FRAME_HISTORY_SIZE];
+    int64_t swap_index[_SAPP_FRAME_HISTORY_SIZE];   // 1-based swap number of a frame, 0 if not swapped
+    double input_time[_SAPP_FRAME_HISTORY_SIZE];    // time of the earliest input event consumed by a frame, 0.0 if none
+    bool present_times;         // true if the platform provides presentation times
+    _sapp_input_latency_t latency;
+} _sapp_frame_history_t;
+
+_SOKOL_PRIVATE sapp_frame_timing* _sapp_frame_history_item(_sapp_frame_history_t* h, uint64_t index) {
+    return &h->items[index % _SAPP_FRAME_HISTORY_SIZE];
+}
+
+_SOKOL_PRIVATE void _sapp_frame_history_record(_sapp_frame_history_t* h, uint64_t frame_count, double start, double frame_cb_duration) {
+    const uint64_t index = h->count++;
+    sapp_frame_timing* item = _sapp_frame_history_item(h, index);
+    memset(item, 0, sizeof(sapp_frame_timing));
+    item->frame_count = frame_count;
+    item->start = start;
+    item->frame_cb_duration = frame_cb_duration;
+    item->discontinuity = h->discontinuity;
+    h->discontinuity = false;
+    h->swap_index[index % _SAPP_FRAME_HISTORY_SIZE] = 0;
+    h->input_time[index % _SAPP_FRAME_HISTORY_SIZE] = _sapp_input_latency_take(&h->latency);
+}
+
+// called when the event loop has been idle (render-on-demand), the next frame's
+// start time and presentation are not comparable to the previous frame
+_SOKOL_PRIVATE void _sapp_frame_history_discontinuity(_sapp_frame_history_t* h) {
+    h->discontinuity = true;
+    h->last_msc = 0;
+}
+
+// called right after the swap-buffers call of the most recently recorded frame has returned
+_SOKOL_PRIVATE void _sapp_frame_history_swap_done(_sapp_frame_history_t* h, double now) {
+    if (h->count > 0) {
+        const uint64_t index = h->count - 1;
+        _sapp_frame_history_item(h, index)->swap_done = now;
+        h->swap_index[index % _SAPP_FRAME_HISTORY_SIZE] = ++h->swap_count;
+        const double input_time = h->input_time[index % _SAPP_FRAME_HISTORY_SIZE];
+        if (!h->present_times && (input_time > 0.0)) {
+            _sapp_input_latency_sample(&h->latency, now - input_time);
+        }
+    }
+}
+
+// called when the window system reports that all swaps up to 'sbc' have completed
+// at the vertical blank 'msc' at time 'present_time'
+_SOKOL_PRIVATE void _sapp_frame_history_presented(_sapp_frame_history_t* h, int64_t sbc, int64_t msc, double present_time, int swap_interval) {
+    // find the newly presented frames (newest to oldest), stop at the first
+    // frame which already has a presentation time
+    const uint64_t num = (h->count < _SAPP_FRAME_HISTORY_SIZE) ? h->count : _SAPP_FRAME_HISTORY_SIZE;
+    int num_presented = 0;
+    bool after_idle = false;
+    sapp_frame_timing* newest = 0;
+    for (uint64_t i = 0; i < num; i++) {
+        const uint64_t index = h->count - 1 - i;
+        sapp_frame_timing* item = _sapp_frame_history_item(h, index);
+        const int64_t swap_index = h->swap_index[index % _SAPP_FRAME_HISTORY_SIZE];
+        if (item->present > 0.0) {
+            break;
+        }
+        if ((swap_index == 0) || (swap_index > sbc)) {
+            continue;
+        }
+        item->present = present_time;
+        const double input_time = h->input_time[index % _SAPP_FRAME_HISTORY_SIZE];
+        if (input_time > 0.0) {
+            _sapp_input_latency_sample(&h->latency, present_time - input_time);
+        }
+        if (0 == newest) {
+            newest = item;
+        }
+        // the vblanks between an idle frame and its predecessor are idle time, not misses
+        after_idle |= item->discontinuity;
+        num_presented++;
+    }
+    if (newest) {
+        if ((h->last_msc > 0) && (swap_interval != 0) && !after_idle) {
+            const int64_t expected = (int64_t)num_presented * (swap_interval < 0 ? -swap_interval : swap_interval);
+            const int64_t missed = (msc - h->last_msc) - expected;
+            if (missed > 0) {
+                newest->missed_vblanks = (int)missed;
+                h->missed_vblanks += (uint64_t)missed;
+            }
+        }
+        h->last_msc = msc;
+    }
+}
+
+_SOKOL_PRIVATE int _sapp_frame_history_cmp(const void* a, const void* b) {
+    const double da = *(const double*)a;
+    const double db = *(const double*)b;
+    return (da < db) ? -1 : ((da > db) ? 1 : 0);
+}
+
+// compute percentiles over an array of values (the array will be sorted in place)
+_SOKOL_PRIVATE sapp_frame_percentiles _sapp_frame_percentiles(double* vals, int num) {
+    sapp_frame_percentiles res;
+    memset(&res, 0, sizeof(res));
+    if (num > 0) {
+        qsort(vals, (size_t)num, sizeof(double), _sapp_frame_history_cmp);
+        // nearest-rank method
+        res.p50 = vals[((num * 50) + 99) / 100 - 1];
+        res.p95 = vals[((num * 95) + 99) / 100 - 1];
+        res.p99 = vals[((num * 99) + 99) / 100 - 1];
+        res.max = vals[num - 1];
+    }
+    return res;
+}
+
 // ███████ ████████ ██████  ██    ██  ██████ ████████ ███████
 // ██         ██    ██   ██ ██    ██ ██         ██    ██
 // ███████    ██    ██████  ██    ██ ██         ██    ███████
@@ -2926,6 +3466,7 @@ typedef const char* (*PFNGLXQUERYEXTENSIONSSTRINGPROC)(Display*,int);
 typedef GLXFBConfig* (*PFNGLXGETFBCONFIGSPROC)(Display*,int,int*);
 typedef __GLXextproc (* PFNGLXGETPROCADDRESSPROC)(const char *procName);
 typedef void (*PFNGLXSWAPINTERVALEXTPROC)(Display*,GLXDrawable,int);
+typedef Bool (*PFNGLXGETSYNCVALUESOMLPROC)(Display*,GLXDrawable,int64_t*,int64_t*,int64_t*);
 typedef XVisualInfo* (*PFNGLXGETVISUALFROMFBCONFIGPROC)(Display*,GLXFBConfig);
 typedef GLXWindow (*PFNGLXCREATEWINDOWPROC)(Display*,GLXFBConfig,Window,const int*);
 typedef void (*PFNGLXDESTROYWINDOWPROC)(Display*,GLXWindow);
@@ -2958,6 +3499,15 @@ typedef struct {
     Atom text_uri_list;
 } _sapp_xdnd_t;
 
+typedef struct {
+    bool enabled;
+    sapp_event_type type;   // SAPP_EVENTTYPE_INVALID if no event is pending
+    int count;
+    uint32_t mods;
+    float dx, dy;
+    float scroll_x, scroll_y;
+} _sapp_x11_coalesce_t;
+
 typedef struct {
     uint8_t mouse_buttons;
     Display* display;
@@ -2982,13 +3532,37 @@ typedef struct {
     Atom NET_WM_ICON;
     Atom NET_WM_STATE;
     Atom NET_WM_STATE_FULLSCREEN;
+    Atom NET_WM_BYPASS_COMPOSITOR;
     _sapp_xi_t xi;
     _sapp_xdnd_t xdnd;
     // XLib manual says keycodes are in the range [8, 255] inclusive.
     // https://tronche.com/gui/x/xlib/input/keyboard-encoding.html
     bool key_repeat[_SAPP_X11_MAX_X11_KEYCODES];
+    int wakeup_fd;      // eventfd for sapp_wakeup(), -1 if not available
+    int wakeup_valid;   // 1 while wakeup_fd may be written, only accessed via atomic builtins
+    int wakeup_users;   // threads currently inside _sapp_x11_wakeup(), only accessed via atomic builtins
+    int wakeup_pending; // only accessed via atomic builtins
+    _sapp_x11_coalesce_t coalesce;
 } _sapp_x11_t;
 
+#define _SAPP_RTHREAD_EVENT_QUEUE_SIZE (256)    // must be a power of 2
+
+typedef struct {
+    bool enabled;
+    bool running;
+    pthread_t main_thread;
+    pthread_t thread;
+    uint32_t head;      // only written by the main thread, via atomic builtins
+    uint32_t tail;      // only written by the render thread, via atomic builtins
+    sapp_event events[_SAPP_RTHREAD_EVENT_QUEUE_SIZE];
+    int mouse_lock_request; // -1 if none, otherwise 0 or 1, only accessed via atomic builtins
+    // render thread copy of the mouse state from the last dispatched event
+    float mouse_x;
+    float mouse_y;
+    float mouse_dx;
+    float mouse_dy;
+} _sapp_rthread_t;
+
 #if defined(_SAPP_GLX)
 
 typedef struct {
@@ -2998,6 +3572,7 @@ typedef struct {
     int event_base;
     int error_base;
     GLXContext ctx;
+    GLXContext upload_ctx;  // optional shared context for background uploads
     GLXWindow window;
 
     // GLX 1.3 functions
@@ -3018,6 +3593,7 @@ typedef struct {
     PFNGLXGETPROCADDRESSPROC GetProcAddress;
     PFNGLXGETPROCADDRESSPROC GetProcAddressARB;
     PFNGLXSWAPINTERVALEXTPROC SwapIntervalEXT;
+    PFNGLXGETSYNCVALUESOMLPROC GetSyncValuesOML;
     PFNGLXSWAPINTERVALMESAPROC SwapIntervalMESA;
     PFNGLXCREATECONTEXTATTRIBSARBPROC CreateContextAttribsARB;
 
@@ -3027,6 +3603,8 @@ typedef struct {
     // extension availability
     bool EXT_swap_control;
     bool MESA_swap_control;
+    bool EXT_swap_control_tear;
+    bool OML_sync_control;
     bool ARB_multisample;
     bool ARB_create_context;
     bool ARB_create_context_profile;
@@ -3037,6 +3615,7 @@ typedef struct {
 typedef struct {
     EGLDisplay display;
     EGLContext context;
+    EGLContext upload_context;  // optional shared context for background uploads
     EGLSurface surface;
 } _sapp_egl_t;
 #endif // _SAPP_EGL
@@ -3063,6 +3642,12 @@ typedef struct {
     char* buffer;
 } _sapp_drop_t;
 
+typedef struct {
+    bool enabled;
+    bool requested;
+    double scheduled_time;  // absolute time of a scheduled redraw (see _sapp_timestamp_now()), 0.0 if none
+} _sapp_redraw_t;
+
 typedef struct {
     float x, y;
     float dx, dy;
@@ -3075,6 +3660,7 @@ typedef struct {
 typedef struct {
     sapp_desc desc;
     bool valid;
+    bool headless;
     bool fullscreen;
     bool first_frame;
     bool init_called;
@@ -3093,10 +3679,12 @@ typedef struct {
     float dpi_scale;
     uint64_t frame_count;
     _sapp_timing_t timing;
+    _sapp_frame_history_t frame_history;
     sapp_event event;
     _sapp_mouse_t mouse;
     _sapp_clipboard_t clipboard;
     _sapp_drop_t drop;
+    _sapp_redraw_t redraw;
     sapp_icon_desc default_icon_desc;
     uint32_t* default_icon_pixels;
     #if defined(SOKOL_WGPU)
@@ -3119,6 +3707,7 @@ typedef struct {
         _sapp_android_t android;
     #elif defined(_SAPP_LINUX)
         _sapp_x11_t x11;
+        _sapp_rthread_t rthread;
         #if defined(_SAPP_GLX)
             _sapp_glx_t glx;
         #elif defined(_SAPP_EGL)
@@ -3226,6 +3815,10 @@ _SOKOL_PRIVATE void _sapp_free(void* ptr) {
 //
 // >>helpers
 
+_SOKOL_PRIVATE int _sapp_absi(int i) {
+    return (i < 0) ? -i : i;
+}
+
 // round float to int and at least 1
 _SOKOL_PRIVATE int _sapp_roundf_gzero(float f) {
     int val = (int)roundf(f);
@@ -3265,7 +3858,59 @@ _SOKOL_PRIVATE void _sapp_call_cleanup(void) {
     }
 }
 
+#if defined(_SAPP_LINUX)
+// single-producer/single-consumer event queue from the main thread to the render thread
+_SOKOL_PRIVATE bool _sapp_rthread_forward_event(const sapp_event* e) {
+    if (!_sapp.rthread.running || !pthread_equal(pthread_self(), _sapp.rthread.main_thread)) {
+        return false;
+    }
+    const uint32_t head = _sapp.rthread.head;
+    while ((head - __atomic_load_n(&_sapp.rthread.tail, __ATOMIC_ACQUIRE)) >= _SAPP_RTHREAD_EVENT_QUEUE_SIZE) {
+        // queue is full, wait for the render thread
+        if (__atomic_load_n(&_sapp.quit_ordered, __ATOMIC_ACQUIRE)) {
+            return true;
+        }
+        sched_yield();
+    }
+    _sapp.rthread.events[head & (_SAPP_RTHREAD_EVENT_QUEUE_SIZE - 1)] = *e;
+    __atomic_store_n(&_sapp.rthread.head, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+_SOKOL_PRIVATE bool _sapp_call_event(const sapp_event* e);
+
+// called on the render thread to dispatch all events queued by the main thread
+_SOKOL_PRIVATE void _sapp_rthread_dispatch_events(void) {
+    const uint32_t head = __atomic_load_n(&_sapp.rthread.head, __ATOMIC_ACQUIRE);
+    uint32_t tail = _sapp.rthread.tail;
+    while (tail != head) {
+        sapp_event e = _sapp.rthread.events[tail & (_SAPP_RTHREAD_EVENT_QUEUE_SIZE - 1)];
+        // fill in the render thread owned fields, and keep a copy of the mouse
+        // state for events which originate on the render thread
+        e.frame_count = _sapp.frame_count;
+        e.window_width = _sapp.window_width;
+        e.window_height = _sapp.window_height;
+        e.framebuffer_width = _sapp.framebuffer_width;
+        e.framebuffer_height = _sapp.framebuffer_height;
+        _sapp.rthread.mouse_x = e.mouse_x;
+        _sapp.rthread.mouse_y = e.mouse_y;
+        _sapp.rthread.mouse_dx = e.mouse_dx;
+        _sapp.rthread.mouse_dy = e.mouse_dy;
+        if (_sapp.init_called) {
+            _sapp_call_event(&e);
+        }
+        tail++;
+        __atomic_store_n(&_sapp.rthread.tail, tail, __ATOMIC_RELEASE);
+    }
+}
+#endif
+
 _SOKOL_PRIVATE bool _sapp_call_event(const sapp_event* e) {
+    #if defined(_SAPP_LINUX)
+    if (_sapp_rthread_forward_event(e)) {
+        return false;
+    }
+    #endif
     if (!_sapp.cleanup_called) {
         if (_sapp.desc.event_cb) {
             _sapp.desc.event_cb(e);
@@ -3363,7 +4008,6 @@ _SOKOL_PRIVATE void _sapp_init_state(const sapp_desc* desc) {
     SOKOL_ASSERT(desc->width >= 0);
     SOKOL_ASSERT(desc->height >= 0);
     SOKOL_ASSERT(desc->sample_count >= 0);
-    SOKOL_ASSERT(desc->swap_interval >= 0);
     SOKOL_ASSERT(desc->clipboard_size >= 0);
     SOKOL_ASSERT(desc->max_dropped_files >= 0);
     SOKOL_ASSERT(desc->max_dropped_file_path_length >= 0);
@@ -3377,6 +4021,10 @@ _SOKOL_PRIVATE void _sapp_init_state(const sapp_desc* desc) {
     _sapp.framebuffer_height = _sapp.window_height;
     _sapp.sample_count = _sapp.desc.sample_count;
     _sapp.swap_interval = _sapp.desc.swap_interval;
+    #if !defined(_SAPP_LINUX)
+    // negative (adaptive) swap intervals are only supported on Linux
+    _sapp.swap_interval = _sapp_absi(_sapp.swap_interval);
+    #endif
     _sapp_strcpy(_sapp.desc.html5_canvas_selector, _sapp.html5_canvas_selector, sizeof(_sapp.html5_canvas_selector));
     _sapp.desc.html5_canvas_selector = _sapp.html5_canvas_selector;
     _sapp.html5_ask_leave_site = _sapp.desc.html5_ask_leave_site;
@@ -3398,6 +4046,10 @@ _SOKOL_PRIVATE void _sapp_init_state(const sapp_desc* desc) {
     _sapp.fullscreen = _sapp.desc.fullscreen;
     _sapp.mouse.shown = true;
     _sapp_timing_init(&_sapp.timing);
+    #if defined(_SAPP_LINUX)
+    _sapp.redraw.enabled = _sapp.desc.render_on_demand;
+    _sapp.redraw.requested = true;
+    #endif
 }
 
 _SOKOL_PRIVATE void _sapp_discard_state(void) {
@@ -3418,22 +4070,56 @@ _SOKOL_PRIVATE void _sapp_discard_state(void) {
     _SAPP_CLEAR_ARC_STRUCT(_sapp_t, _sapp);
 }
 
+_SOKOL_PRIVATE void _sapp_init_event_struct(sapp_event* e, sapp_event_type type) {
+    _sapp_clear(e, sizeof(sapp_event));
+    e->type = type;
+    e->mouse_button = SAPP_MOUSEBUTTON_INVALID;
+    #if defined(_SAPP_LINUX)
+    if (_sapp.rthread.running) {
+        // the main thread owns the mouse state, the render thread owns the
+        // frame count and window size, the fields owned by the other thread
+        // are filled in from the event queue in _sapp_rthread_dispatch_events()
+        if (pthread_equal(pthread_self(), _sapp.rthread.main_thread)) {
+            e->mouse_x = _sapp.mouse.x;
+            e->mouse_y = _sapp.mouse.y;
+            e->mouse_dx = _sapp.mouse.dx;
+            e->mouse_dy = _sapp.mouse.dy;
+        } else {
+            e->frame_count = _sapp.frame_count;
+            e->window_width = _sapp.window_width;
+            e->window_height = _sapp.window_height;
+            e->framebuffer_width = _sapp.framebuffer_width;
+            e->framebuffer_height = _sapp.framebuffer_height;
+            e->mouse_x = _sapp.rthread.mouse_x;
+            e->mouse_y = _sapp.rthread.mouse_y;
+            e->mouse_dx = _sapp.rthread.mouse_dx;
+            e->mouse_dy = _sapp.rthread.mouse_dy;
+        }
+        return;
+    }
+    #endif
+    e->frame_count = _sapp.frame_count;
+    e->window_width = _sapp.window_width;
+    e->window_height = _sapp.window_height;
+    e->framebuffer_width = _sapp.framebuffer_width;
+    e->framebuffer_height = _sapp.framebuffer_height;
+    e->mouse_x = _sapp.mouse.x;
+    e->mouse_y = _sapp.mouse.y;
+    e->mouse_dx = _sapp.mouse.dx;
+    e->mouse_dy = _sapp.mouse.dy;
+}
+
 _SOKOL_PRIVATE void _sapp_init_event(sapp_event_type type) {
-    _sapp_clear(&_sapp.event, sizeof(_sapp.event));
-    _sapp.event.type = type;
-    _sapp.event.frame_count = _sapp.frame_count;
-    _sapp.event.mouse_button = SAPP_MOUSEBUTTON_INVALID;
-    _sapp.event.window_width = _sapp.window_width;
-    _sapp.event.window_height = _sapp.window_height;
-    _sapp.event.framebuffer_width = _sapp.framebuffer_width;
-    _sapp.event.framebuffer_height = _sapp.framebuffer_height;
-    _sapp.event.mouse_x = _sapp.mouse.x;
-    _sapp.event.mouse_y = _sapp.mouse.y;
-    _sapp.event.mouse_dx = _sapp.mouse.dx;
-    _sapp.event.mouse_dy = _sapp.mouse.dy;
+    _sapp_init_event_struct(&_sapp.event, type);
 }
 
 _SOKOL_PRIVATE bool _sapp_events_enabled(void) {
+    #if defined(_SAPP_LINUX)
+    if (_sapp.rthread.running && pthread_equal(pthread_self(), _sapp.rthread.main_thread)) {
+        // init_called belongs to the render thread, which checks it when dispatching
+        return _sapp.desc.event_cb || _sapp.desc.event_userdata_cb;
+    }
+    #endif
     /* only send events when an event callback is set, and the init function was called */
     return (_sapp.desc.event_cb || _sapp.desc.event_userdata_cb) && _sapp.init_called;
 }
@@ -3454,11 +4140,19 @@ _SOKOL_PRIVATE void _sapp_clear_drop_buffer(void) {
 }
 
 _SOKOL_PRIVATE void _sapp_frame(void) {
+    #if !defined(_SAPP_EMSCRIPTEN)
+    const double start = _sapp_timestamp_now(&_sapp.timing.timestamp);
+    _sapp_input_latency_begin_frame(&_sapp.frame_history.latency);
+    #endif
     if (_sapp.first_frame) {
         _sapp.first_frame = false;
         _sapp_call_init();
     }
     _sapp_call_frame();
+    #if !defined(_SAPP_EMSCRIPTEN)
+    const double frame_cb_duration = _sapp_timestamp_now(&_sapp.timing.timestamp) - start;
+    _sapp_frame_history_record(&_sapp.frame_history, _sapp.frame_count, start, frame_cb_duration);
+    #endif
     _sapp.frame_count++;
 }
 
@@ -10526,6 +11220,7 @@ _SOKOL_PRIVATE void _sapp_x11_init_extensions(void) {
     _sapp.x11.NET_WM_ICON             = XInternAtom(_sapp.x11.display, "_NET_WM_ICON", False);
     _sapp.x11.NET_WM_STATE            = XInternAtom(_sapp.x11.display, "_NET_WM_STATE", False);
     _sapp.x11.NET_WM_STATE_FULLSCREEN = XInternAtom(_sapp.x11.display, "_NET_WM_STATE_FULLSCREEN", False);
+    _sapp.x11.NET_WM_BYPASS_COMPOSITOR = XInternAtom(_sapp.x11.display, "_NET_WM_BYPASS_COMPOSITOR", False);
     _sapp.x11.CLIPBOARD = XInternAtom(_sapp.x11.display, "CLIPBOARD", False);
     _sapp.x11.TARGETS   = XInternAtom(_sapp.x11.display, "TARGETS", False);
     if (_sapp.drop.enabled) {
@@ -11031,11 +11726,17 @@ _SOKOL_PRIVATE void _sapp_glx_init(void) {
     if (_sapp_glx_extsupported("GLX_EXT_swap_control", exts)) {
         _sapp.glx.SwapIntervalEXT = (PFNGLXSWAPINTERVALEXTPROC) _sapp_glx_getprocaddr("glXSwapIntervalEXT");
         _sapp.glx.EXT_swap_control = 0 != _sapp.glx.SwapIntervalEXT;
+        _sapp.glx.EXT_swap_control_tear = _sapp.glx.EXT_swap_control && _sapp_glx_extsupported("GLX_EXT_swap_control_tear", exts);
     }
     if (_sapp_glx_extsupported("GLX_MESA_swap_control", exts)) {
         _sapp.glx.SwapIntervalMESA = (PFNGLXSWAPINTERVALMESAPROC) _sapp_glx_getprocaddr("glXSwapIntervalMESA");
         _sapp.glx.MESA_swap_control = 0 != _sapp.glx.SwapIntervalMESA;
     }
+    if (_sapp_glx_extsupported("GLX_OML_sync_control", exts)) {
+        _sapp.glx.GetSyncValuesOML = (PFNGLXGETSYNCVALUESOMLPROC) _sapp_glx_getprocaddr("glXGetSyncValuesOML");
+        _sapp.glx.OML_sync_control = 0 != _sapp.glx.GetSyncValuesOML;
+        _sapp.frame_history.present_times = _sapp.glx.OML_sync_control;
+    }
     _sapp.glx.ARB_multisample = _sapp_glx_extsupported("GLX_ARB_multisample", exts);
     if (_sapp_glx_extsupported("GLX_ARB_create_context", exts)) {
         _sapp.glx.CreateContextAttribsARB = (PFNGLXCREATECONTEXTATTRIBSARBPROC) _sapp_glx_getprocaddr("glXCreateContextAttribsARB");
@@ -11162,6 +11863,13 @@ _SOKOL_PRIVATE void _sapp_glx_create_context(void) {
     if (!_sapp.glx.ctx) {
         _SAPP_PANIC(LINUX_GLX_CREATE_CONTEXT_FAILED);
     }
+    if (_sapp.desc.gl_upload_context) {
+        // NOTE: the upload context is made current without a drawable, which is allowed for GL 3.0+ contexts
+        _sapp.glx.upload_ctx = _sapp.glx.CreateContextAttribsARB(_sapp.x11.display, native, _sapp.glx.ctx, True, attribs);
+        if (!_sapp.glx.upload_ctx) {
+            _SAPP_WARN(LINUX_GLX_CREATE_UPLOAD_CONTEXT_FAILED);
+        }
+    }
     _sapp_x11_release_error_handler();
     _sapp.glx.window = _sapp.glx.CreateWindow(_sapp.x11.display, native, _sapp.x11.window, NULL);
     if (!_sapp.glx.window) {
@@ -11171,6 +11879,10 @@ _SOKOL_PRIVATE void _sapp_glx_create_context(void) {
 }
 
 _SOKOL_PRIVATE void _sapp_glx_destroy_context(void) {
+    if (_sapp.glx.upload_ctx) {
+        _sapp.glx.DestroyContext(_sapp.x11.display, _sapp.glx.upload_ctx);
+        _sapp.glx.upload_ctx = 0;
+    }
     if (_sapp.glx.window) {
         _sapp.glx.DestroyWindow(_sapp.x11.display, _sapp.glx.window);
         _sapp.glx.window = 0;
@@ -11185,12 +11897,33 @@ _SOKOL_PRIVATE void _sapp_glx_swap_buffers(void) {
     _sapp.glx.SwapBuffers(_sapp.x11.display, _sapp.glx.window);
 }
 
-_SOKOL_PRIVATE void _sapp_glx_swapinterval(int interval) {
+// query the swap completion via GLX_OML_sync_control and record presentation times
+_SOKOL_PRIVATE void _sapp_glx_update_present_times(void) {
+    if (!_sapp.glx.OML_sync_control) {
+        return;
+    }
+    int64_t ust = 0, msc = 0, sbc = 0;
+    if (!_sapp.glx.GetSyncValuesOML(_sapp.x11.display, _sapp.glx.window, &ust, &msc, &sbc)) {
+        return;
+    }
+    // NOTE: UST is in microseconds on CLOCK_MONOTONIC (at least with Mesa and NVIDIA),
+    // so it can be converted into the timebase of _sapp.timing.timestamp
+    const double present_time = ((double)ust / 1000000.0) - ((double)_sapp.timing.timestamp.posix.start / 1000000000.0);
+    _sapp_frame_history_presented(&_sapp.frame_history, sbc, msc, present_time, _sapp.swap_interval);
+}
+
+// returns the swap interval which is actually used
+_SOKOL_PRIVATE int _sapp_glx_swapinterval(int interval) {
+    // negative intervals (adaptive vsync) require GLX_EXT_swap_control_tear
+    if ((interval < 0) && !_sapp.glx.EXT_swap_control_tear) {
+        interval = -interval;
+    }
     if (_sapp.glx.EXT_swap_control) {
         _sapp.glx.SwapIntervalEXT(_sapp.x11.display, _sapp.glx.window, interval);
     } else if (_sapp.glx.MESA_swap_control) {
         _sapp.glx.SwapIntervalMESA(interval);
     }
+    return interval;
 }
 
 #endif // _SAPP_GLX
@@ -11228,10 +11961,21 @@ _SOKOL_PRIVATE bool _sapp_x11_wait_for_event(int event_type, double timeout_sec,
     return true;
 }
 
+_SOKOL_PRIVATE bool _sapp_rthread_is_current(void) {
+    return _sapp.rthread.running && !pthread_equal(pthread_self(), _sapp.rthread.main_thread);
+}
+
 _SOKOL_PRIVATE void _sapp_x11_app_event(sapp_event_type type) {
     if (_sapp_events_enabled()) {
-        _sapp_init_event(type);
-        _sapp_call_event(&_sapp.event);
+        if (_sapp_rthread_is_current()) {
+            // don't clobber _sapp.event, which belongs to the main thread
+            sapp_event e;
+            _sapp_init_event_struct(&e, type);
+            _sapp_call_event(&e);
+        } else {
+            _sapp_init_event(type);
+            _sapp_call_event(&_sapp.event);
+        }
     }
 }
 
@@ -11263,6 +12007,13 @@ _SOKOL_PRIVATE void _sapp_x11_update_dimensions_from_window_size(void) {
 
 _SOKOL_PRIVATE void _sapp_x11_set_fullscreen(bool enable) {
     /* NOTE: this function must be called after XMapWindow (which happens in _sapp_x11_show_window()) */
+    if (_sapp.x11.NET_WM_BYPASS_COMPOSITOR) {
+        // 1: ask the compositor to unredirect the window, 0: no preference
+        const CARD32 bypass = enable ? 1 : 0;
+        XChangeProperty(_sapp.x11.display, _sapp.x11.window,
+                        _sapp.x11.NET_WM_BYPASS_COMPOSITOR, XA_CARDINAL, 32,
+                        PropModeReplace, (unsigned char*)&bypass, 1);
+    }
     if (_sapp.x11.NET_WM_STATE && _sapp.x11.NET_WM_STATE_FULLSCREEN) {
         if (enable) {
             const int _NET_WM_STATE_ADD = 1;
@@ -11400,8 +12151,9 @@ _SOKOL_PRIVATE void _sapp_x11_lock_mouse(bool lock) {
     }
     _sapp.mouse.dx = 0.0f;
     _sapp.mouse.dy = 0.0f;
-    _sapp.mouse.locked = lock;
-    if (_sapp.mouse.locked) {
+    // atomic because sapp_mouse_locked() may be called on the render thread
+    __atomic_store_n(&_sapp.mouse.locked, lock, __ATOMIC_RELEASE);
+    if (lock) {
         if (_sapp.x11.xi.available) {
             XIEventMask em;
             unsigned char mask[XIMaskLen(XI_RawMotion)] = { 0 }; // XIMaskLen is a macro
@@ -11775,8 +12527,70 @@ _SOKOL_PRIVATE void _sapp_x11_mouse_event(sapp_event_type type, sapp_mousebutton
     }
 }
 
-_SOKOL_PRIVATE void _sapp_x11_scroll_event(float x, float y, uint32_t mods) {
+// send a pending coalesced mouse move or scroll event
+_SOKOL_PRIVATE void _sapp_x11_flush_coalesced_event(void) {
+    _sapp_x11_coalesce_t* c = &_sapp.x11.coalesce;
+    if (c->type == SAPP_EVENTTYPE_INVALID) {
+        return;
+    }
     if (_sapp_events_enabled()) {
+        if (c->type == SAPP_EVENTTYPE_MOUSE_MOVE) {
+            _sapp.mouse.dx = c->dx;
+            _sapp.mouse.dy = c->dy;
+        }
+        _sapp_init_event(c->type);
+        _sapp.event.modifiers = c->mods;
+        _sapp.event.num_coalesced = c->count;
+        if (c->type == SAPP_EVENTTYPE_MOUSE_SCROLL) {
+            _sapp.event.scroll_x = c->scroll_x;
+            _sapp.event.scroll_y = c->scroll_y;
+        }
+        _sapp_call_event(&_sapp.event);
+    }
+    c->type = SAPP_EVENTTYPE_INVALID;
+    c->count = 0;
+    c->dx = c->dy = 0.0f;
+    c->scroll_x = c->scroll_y = 0.0f;
+}
+
+// merge a mouse move (x, y is the mouse delta) or scroll event (x, y is the scroll delta)
+_SOKOL_PRIVATE void _sapp_x11_coalesce_event(sapp_event_type type, float x, float y, uint32_t mods) {
+    _sapp_x11_coalesce_t* c = &_sapp.x11.coalesce;
+    if (c->type != type) {
+        _sapp_x11_flush_coalesced_event();
+        c->type = type;
+    }
+    c->count++;
+    c->mods = mods;
+    if (type == SAPP_EVENTTYPE_MOUSE_MOVE) {
+        c->dx += x;
+        c->dy += y;
+    } else {
+        c->scroll_x += x;
+        c->scroll_y += y;
+    }
+}
+
+// check if an X11 event may be merged into a pending coalesced event
+_SOKOL_PRIVATE bool _sapp_x11_is_coalescable_event(const XEvent* event) {
+    switch (event->type) {
+        case MotionNotify:
+            return true;
+        case GenericEvent:
+            return (event->xcookie.extension == _sapp.x11.xi.major_opcode) && (event->xcookie.evtype == XI_RawMotion);
+        case ButtonPress:
+        case ButtonRelease:
+            // mouse wheel 'buttons'
+            return (event->xbutton.button >= 4) && (event->xbutton.button <= 7);
+        default:
+            return false;
+    }
+}
+
+_SOKOL_PRIVATE void _sapp_x11_scroll_event(float x, float y, uint32_t mods) {
+    if (_sapp.x11.coalesce.enabled) {
+        _sapp_x11_coalesce_event(SAPP_EVENTTYPE_MOUSE_SCROLL, x, y, mods);
+    } else if (_sapp_events_enabled()) {
         _sapp_init_event(SAPP_EVENTTYPE_MOUSE_SCROLL);
         _sapp.event.modifiers = mods;
         _sapp.event.scroll_x = x;
@@ -11942,22 +12756,48 @@ _SOKOL_PRIVATE bool _sapp_x11_parse_dropped_files_list(const char* src) {
     }
 }
 
+// record the time of an input event for input-to-present latency tracking
+_SOKOL_PRIVATE void _sapp_x11_track_input_latency(Time server_time) {
+    const double now = _sapp_timestamp_now(&_sapp.timing.timestamp);
+    // X server timestamps are in milliseconds on CLOCK_MONOTONIC and wrap around
+    // at 32 bits, so compute the age of the event and subtract it from 'now',
+    // if the clocks don't seem to match, fall back to the time the event was received
+    struct timespec tspec;
+    clock_gettime(_SAPP_CLOCK_MONOTONIC, &tspec);
+    const uint32_t now_ms = (uint32_t)((uint64_t)tspec.tv_sec * 1000 + (uint64_t)tspec.tv_nsec / 1000000);
+    const uint32_t age_ms = now_ms - (uint32_t)server_time;
+    double event_time = now;
+    if (age_ms < 1000) {
+        event_time = now - ((double)age_ms / 1000.0);
+    }
+    _sapp_input_latency_push(&_sapp.frame_history.latency, event_time);
+}
+
 _SOKOL_PRIVATE void _sapp_x11_on_genericevent(XEvent* event) {
     if (_sapp.mouse.locked && _sapp.x11.xi.available) {
         if (event->xcookie.extension == _sapp.x11.xi.major_opcode) {
             if (XGetEventData(_sapp.x11.display, &event->xcookie)) {
                 if (event->xcookie.evtype == XI_RawMotion) {
                     XIRawEvent* re = (XIRawEvent*) event->xcookie.data;
+                    if (_sapp.frame_history.latency.enabled) {
+                        _sapp_x11_track_input_latency(re->time);
+                    }
                     if (re->valuators.mask_len) {
                         const double* values = re->raw_values;
+                        float dx = 0.0f;
+                        float dy = 0.0f;
                         if (XIMaskIsSet(re->valuators.mask, 0)) {
-                            _sapp.mouse.dx = (float) *values;
+                            dx = _sapp.mouse.dx = (float) *values;
                             values++;
                         }
                         if (XIMaskIsSet(re->valuators.mask, 1)) {
-                            _sapp.mouse.dy = (float) *values;
+                            dy = _sapp.mouse.dy = (float) *values;
+                        }
+                        if (_sapp.x11.coalesce.enabled) {
+                            _sapp_x11_coalesce_event(SAPP_EVENTTYPE_MOUSE_MOVE, dx, dy, _sapp_x11_mods(event->xmotion.state));
+                        } else {
+                            _sapp_x11_mouse_event(SAPP_EVENTTYPE_MOUSE_MOVE, SAPP_MOUSEBUTTON_INVALID, _sapp_x11_mods(event->xmotion.state));
                         }
-                        _sapp_x11_mouse_event(SAPP_EVENTTYPE_MOUSE_MOVE, SAPP_MOUSEBUTTON_INVALID, _sapp_x11_mods(event->xmotion.state));
                     }
                 }
                 XFreeEventData(_sapp.x11.display, &event->xcookie);
@@ -12065,7 +12905,11 @@ _SOKOL_PRIVATE void _sapp_x11_on_leavenotify(XEvent* event) {
 _SOKOL_PRIVATE void _sapp_x11_on_motionnotify(XEvent* event) {
     if (!_sapp.mouse.locked) {
         _sapp_x11_mouse_update(event->xmotion.x, event->xmotion.y, false);
-        _sapp_x11_mouse_event(SAPP_EVENTTYPE_MOUSE_MOVE, SAPP_MOUSEBUTTON_INVALID, _sapp_x11_mods(event->xmotion.state));
+        if (_sapp.x11.coalesce.enabled) {
+            _sapp_x11_coalesce_event(SAPP_EVENTTYPE_MOUSE_MOVE, _sapp.mouse.dx, _sapp.mouse.dy, _sapp_x11_mods(event->xmotion.state));
+        } else {
+            _sapp_x11_mouse_event(SAPP_EVENTTYPE_MOUSE_MOVE, SAPP_MOUSEBUTTON_INVALID, _sapp_x11_mods(event->xmotion.state));
+        }
     }
 }
 
@@ -12131,7 +12975,8 @@ _SOKOL_PRIVATE void _sapp_x11_on_clientmessage(XEvent* event) {
     if (event->xclient.message_type == _sapp.x11.WM_PROTOCOLS) {
         const Atom protocol = (Atom)event->xclient.data.l[0];
         if (protocol == _sapp.x11.WM_DELETE_WINDOW) {
-            _sapp.quit_requested = true;
+            // atomic because the render thread may handle the quit request
+            __atomic_store_n(&_sapp.quit_requested, true, __ATOMIC_SEQ_CST);
         }
     } else if (event->xclient.message_type == _sapp.x11.xdnd.XdndEnter) {
         const bool is_list = 0 != (event->xclient.data.l[1] & 1);
@@ -12255,6 +13100,27 @@ _SOKOL_PRIVATE void _sapp_x11_on_selectionrequest(XEvent* event) {
 }
 
 _SOKOL_PRIVATE void _sapp_x11_process_event(XEvent* event) {
+    if (_sapp.x11.coalesce.enabled && !_sapp_x11_is_coalescable_event(event)) {
+        // preserve the order of a pending coalesced event relative to other events
+        _sapp_x11_flush_coalesced_event();
+    }
+    if (_sapp.frame_history.latency.enabled) {
+        switch (event->type) {
+            case KeyPress:
+            case KeyRelease:
+                _sapp_x11_track_input_latency(event->xkey.time);
+                break;
+            case ButtonPress:
+            case ButtonRelease:
+                _sapp_x11_track_input_latency(event->xbutton.time);
+                break;
+            case MotionNotify:
+                _sapp_x11_track_input_latency(event->xmotion.time);
+                break;
+            default:
+                break;
+        }
+    }
     switch (event->type) {
         case GenericEvent:
             _sapp_x11_on_genericevent(event);
@@ -12306,7 +13172,12 @@ _SOKOL_PRIVATE void _sapp_x11_process_event(XEvent* event) {
 
 #if defined(_SAPP_EGL)
 
-_SOKOL_PRIVATE void _sapp_egl_init(void) {
+#ifndef EGL_PLATFORM_SURFACELESS_MESA
+#define EGL_PLATFORM_SURFACELESS_MESA 0x31DD
+#endif
+typedef EGLDisplay (*_sapp_egl_get_platform_display_t)(EGLenum platform, void* native_display, const EGLint* attrib_list);
+
+_SOKOL_PRIVATE void _sapp_egl_bind_api(void) {
     #if defined(SOKOL_GLCORE)
         if (!eglBindAPI(EGL_OPENGL_API)) {
             _SAPP_PANIC(LINUX_EGL_BIND_OPENGL_API_FAILED);
@@ -12316,6 +13187,51 @@ _SOKOL_PRIVATE void _sapp_egl_init(void) {
             _SAPP_PANIC(LINUX_EGL_BIND_OPENGL_ES_API_FAILED);
         }
     #endif
+}
+
+_SOKOL_PRIVATE bool _sapp_egl_has_extension(EGLDisplay display, const char* ext) {
+    const char* exts = eglQueryString(display, EGL_EXTENSIONS);
+    if (0 == exts) {
+        return false;
+    }
+    const size_t len = strlen(ext);
+    const char* p = exts;
+    while ((p = strstr(p, ext)) != 0) {
+        if (((p == exts) || (p[-1] == ' ')) && ((p[len] == ' ') || (p[len] == 0))) {
+            return true;
+        }
+        p += len;
+    }
+    return false;
+}
+
+// create the main context and the optional upload context
+_SOKOL_PRIVATE void _sapp_egl_create_contexts(EGLConfig config) {
+    EGLint ctx_attrs[] = {
+        EGL_CONTEXT_MAJOR_VERSION, _sapp.desc.gl_major_version,
+        EGL_CONTEXT_MINOR_VERSION, _sapp.desc.gl_minor_version,
+        #if defined(SOKOL_GLCORE)
+            EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        #endif
+        EGL_NONE,
+    };
+
+    _sapp.egl.context = eglCreateContext(_sapp.egl.display, config, EGL_NO_CONTEXT, ctx_attrs);
+    if (EGL_NO_CONTEXT == _sapp.egl.context) {
+        _SAPP_PANIC(LINUX_EGL_CREATE_CONTEXT_FAILED);
+    }
+    _sapp.egl.upload_context = EGL_NO_CONTEXT;
+    if (_sapp.desc.gl_upload_context) {
+        // NOTE: the upload context is made current without a surface (EGL_KHR_surfaceless_context)
+        _sapp.egl.upload_context = eglCreateContext(_sapp.egl.display, config, _sapp.egl.context, ctx_attrs);
+        if (EGL_NO_CONTEXT == _sapp.egl.upload_context) {
+            _SAPP_WARN(LINUX_EGL_CREATE_UPLOAD_CONTEXT_FAILED);
+        }
+    }
+}
+
+_SOKOL_PRIVATE void _sapp_egl_init(void) {
+    _sapp_egl_bind_api();
 
     _sapp.egl.display = eglGetDisplay((EGLNativeDisplayType)_sapp.x11.display);
     if (EGL_NO_DISPLAY == _sapp.egl.display) {
@@ -12393,32 +13309,92 @@ _SOKOL_PRIVATE void _sapp_egl_init(void) {
         _SAPP_PANIC(LINUX_EGL_CREATE_WINDOW_SURFACE_FAILED);
     }
 
-    EGLint ctx_attrs[] = {
-        EGL_CONTEXT_MAJOR_VERSION, _sapp.desc.gl_major_version,
-        EGL_CONTEXT_MINOR_VERSION, _sapp.desc.gl_minor_version,
+    _sapp_egl_create_contexts(config);
+
+    if (!eglMakeCurrent(_sapp.egl.display, _sapp.egl.surface, _sapp.egl.surface, _sapp.egl.context)) {
+        _SAPP_PANIC(LINUX_EGL_MAKE_CURRENT_FAILED);
+    }
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, (GLint*)&_sapp.gl.framebuffer);
+
+    // NOTE: EGL has no adaptive vsync, negative intervals would be clamped to 0
+    _sapp.swap_interval = _sapp_absi(_sapp.swap_interval);
+    eglSwapInterval(_sapp.egl.display, _sapp.swap_interval);
+}
+
+// create a GL context without window system, see sapp_desc.headless
+_SOKOL_PRIVATE void _sapp_egl_init_headless(void) {
+    _sapp_egl_bind_api();
+
+    _sapp.egl.display = EGL_NO_DISPLAY;
+    if (_sapp_egl_has_extension(EGL_NO_DISPLAY, "EGL_MESA_platform_surfaceless")) {
+        _sapp_egl_get_platform_display_t get_platform_display = (_sapp_egl_get_platform_display_t) eglGetProcAddress("eglGetPlatformDisplayEXT");
+        if (get_platform_display) {
+            _sapp.egl.display = get_platform_display(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+        }
+    }
+    if (EGL_NO_DISPLAY == _sapp.egl.display) {
+        _sapp.egl.display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    }
+    if (EGL_NO_DISPLAY == _sapp.egl.display) {
+        _SAPP_PANIC(LINUX_EGL_GET_DISPLAY_FAILED);
+    }
+
+    EGLint major, minor;
+    if (!eglInitialize(_sapp.egl.display, &major, &minor)) {
+        _SAPP_PANIC(LINUX_EGL_INITIALIZE_FAILED);
+    }
+    const bool surfaceless = _sapp_egl_has_extension(_sapp.egl.display, "EGL_KHR_surfaceless_context");
+
+    EGLint alpha_size = _sapp.desc.alpha ? 8 : 0;
+    const EGLint config_attrs[] = {
+        // a pbuffer surface is only needed without EGL_KHR_surfaceless_context
+        EGL_SURFACE_TYPE, surfaceless ? 0 : EGL_PBUFFER_BIT,
         #if defined(SOKOL_GLCORE)
-            EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+            EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        #elif defined(SOKOL_GLES3)
+            EGL_RENDERABLE_TYPE, EGL_OPENGL_ES3_BIT,
         #endif
+        EGL_RED_SIZE, 8,
+        EGL_GREEN_SIZE, 8,
+        EGL_BLUE_SIZE, 8,
+        EGL_ALPHA_SIZE, alpha_size,
         EGL_NONE,
     };
+    EGLConfig config;
+    EGLint config_count;
+    if (!eglChooseConfig(_sapp.egl.display, config_attrs, &config, 1, &config_count) || config_count == 0) {
+        _SAPP_PANIC(LINUX_EGL_NO_CONFIGS);
+    }
 
-    _sapp.egl.context = eglCreateContext(_sapp.egl.display, config, EGL_NO_CONTEXT, ctx_attrs);
-    if (EGL_NO_CONTEXT == _sapp.egl.context) {
-        _SAPP_PANIC(LINUX_EGL_CREATE_CONTEXT_FAILED);
+    _sapp.egl.surface = EGL_NO_SURFACE;
+    if (!surfaceless) {
+        const EGLint pbuffer_attrs[] = {
+            EGL_WIDTH, _sapp.framebuffer_width,
+            EGL_HEIGHT, _sapp.framebuffer_height,
+            EGL_NONE,
+        };
+        _sapp.egl.surface = eglCreatePbufferSurface(_sapp.egl.display, config, pbuffer_attrs);
+        if (EGL_NO_SURFACE == _sapp.egl.surface) {
+            _SAPP_PANIC(LINUX_EGL_CREATE_PBUFFER_SURFACE_FAILED);
+        }
     }
 
+    _sapp_egl_create_contexts(config);
+
     if (!eglMakeCurrent(_sapp.egl.display, _sapp.egl.surface, _sapp.egl.surface, _sapp.egl.context)) {
         _SAPP_PANIC(LINUX_EGL_MAKE_CURRENT_FAILED);
     }
-    glGetIntegerv(GL_FRAMEBUFFER_BINDING, (GLint*)&_sapp.gl.framebuffer);
-
-    eglSwapInterval(_sapp.egl.display, _sapp.swap_interval);
+    _sapp.gl.framebuffer = 0;
 }
 
 _SOKOL_PRIVATE void _sapp_egl_destroy(void) {
     if (_sapp.egl.display != EGL_NO_DISPLAY) {
         eglMakeCurrent(_sapp.egl.display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
 
+        if (_sapp.egl.upload_context != EGL_NO_CONTEXT) {
+            eglDestroyContext(_sapp.egl.display, _sapp.egl.upload_context);
+            _sapp.egl.upload_context = EGL_NO_CONTEXT;
+        }
         if (_sapp.egl.context != EGL_NO_CONTEXT) {
             eglDestroyContext(_sapp.egl.display, _sapp.egl.context);
             _sapp.egl.context = EGL_NO_CONTEXT;
@@ -12447,7 +13423,259 @@ _SOKOL_PRIVATE void _sapp_linux_frame(void) {
         #elif defined(_SAPP_EGL)
             eglSwapBuffers(_sapp.egl.display, _sapp.egl.surface);
         #endif
+        _sapp_frame_history_swap_done(&_sapp.frame_history, _sapp_timestamp_now(&_sapp.timing.timestamp));
+        #if defined(_SAPP_GLX)
+            _sapp_glx_update_present_times();
+        #endif
+    #endif
+}
+
+_SOKOL_PRIVATE void _sapp_x11_init_wakeup(void) {
+    _sapp.x11.wakeup_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (_sapp.x11.wakeup_fd < 0) {
+        _SAPP_WARN(LINUX_X11_CREATE_WAKEUP_EVENTFD_FAILED);
+        return;
+    }
+    // only now may other threads write to the eventfd (the zero-initialized
+    // wakeup_fd before this point would be stdin)
+    __atomic_store_n(&_sapp.x11.wakeup_valid, 1, __ATOMIC_SEQ_CST);
+}
+
+_SOKOL_PRIVATE void _sapp_x11_discard_wakeup(void) {
+    if (_sapp.x11.wakeup_fd >= 0) {
+        // stop new wakeups, then wait for threads which are still inside
+        // write() before the eventfd can be closed
+        __atomic_store_n(&_sapp.x11.wakeup_valid, 0, __ATOMIC_SEQ_CST);
+        while (__atomic_load_n(&_sapp.x11.wakeup_users, __ATOMIC_SEQ_CST) > 0) {
+            sched_yield();
+        }
+        close(_sapp.x11.wakeup_fd);
+        _sapp.x11.wakeup_fd = -1;
+    }
+}
+
+// called from any thread, only the first wakeup per frame writes to the eventfd
+_SOKOL_PRIVATE void _sapp_x11_wakeup(void) {
+    __atomic_add_fetch(&_sapp.x11.wakeup_users, 1, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&_sapp.x11.wakeup_valid, __ATOMIC_SEQ_CST)) {
+        if (0 == __atomic_exchange_n(&_sapp.x11.wakeup_pending, 1, __ATOMIC_SEQ_CST)) {
+            const uint64_t one = 1;
+            ssize_t res = write(_sapp.x11.wakeup_fd, &one, sizeof(one));
+            _SOKOL_UNUSED(res);
+        }
+    }
+    __atomic_sub_fetch(&_sapp.x11.wakeup_users, 1, __ATOMIC_SEQ_CST);
+}
+
+// called on the main thread, returns true if sapp_wakeup() had been called
+_SOKOL_PRIVATE bool _sapp_x11_consume_wakeup(void) {
+    if (0 == __atomic_exchange_n(&_sapp.x11.wakeup_pending, 0, __ATOMIC_SEQ_CST)) {
+        return false;
+    }
+    // drain the eventfd counter, a wakeup which happens between clearing
+    // the flag and reading the counter is caught by the flag in the next
+    // iteration (and reading the eventfd is non-blocking)
+    uint64_t count = 0;
+    ssize_t res = read(_sapp.x11.wakeup_fd, &count, sizeof(count));
+    _SOKOL_UNUSED(res);
+    return true;
+}
+
+// check and clear a scheduled redraw which is due
+_SOKOL_PRIVATE bool _sapp_redraw_schedule_due(void) {
+    if ((_sapp.redraw.scheduled_time > 0.0) && (_sapp_timestamp_now(&_sapp.timing.timestamp) >= _sapp.redraw.scheduled_time)) {
+        _sapp.redraw.scheduled_time = 0.0;
+        return true;
+    }
+    return false;
+}
+
+// in render-on-demand mode, sleep on the X11 connection until an event arrives,
+// or the next scheduled redraw is due, returns true if the thread actually slept
+_SOKOL_PRIVATE bool _sapp_x11_wait_for_redraw(void) {
+    if (_sapp.redraw.requested || _sapp.quit_requested || (XPending(_sapp.x11.display) > 0)) {
+        return false;
+    }
+    if (__atomic_load_n(&_sapp.x11.wakeup_pending, __ATOMIC_SEQ_CST)) {
+        return false;
+    }
+    int timeout_ms = -1;
+    if (_sapp.redraw.scheduled_time > 0.0) {
+        const double remaining = _sapp.redraw.scheduled_time - _sapp_timestamp_now(&_sapp.timing.timestamp);
+        if (remaining <= 0.0) {
+            return false;
+        }
+        // round up so that the scheduled time has passed when waking up
+        timeout_ms = (int)(remaining * 1000.0) + 1;
+    }
+    struct pollfd fds[2] = {
+        { ConnectionNumber(_sapp.x11.display), POLLIN, 0 },
+        { _sapp.x11.wakeup_fd, POLLIN, 0 },     // ignored by poll() if -1
+    };
+    poll(fds, 2, timeout_ms);
+    return true;
+}
+
+_SOKOL_PRIVATE void _sapp_x11_quit_check(void) {
+    // handle quit-requested, either from window or from sapp_request_quit()
+    if (__atomic_load_n(&_sapp.quit_requested, __ATOMIC_SEQ_CST) && !_sapp.quit_ordered) {
+        // give user code a chance to intervene
+        _sapp_x11_app_event(SAPP_EVENTTYPE_QUIT_REQUESTED);
+        /* if user code hasn't intervened, quit the app */
+        if (__atomic_load_n(&_sapp.quit_requested, __ATOMIC_SEQ_CST)) {
+            __atomic_store_n(&_sapp.quit_ordered, true, __ATOMIC_RELEASE);
+        }
+    }
+}
+
+// the default event- and render-loop when everything runs on the main thread
+_SOKOL_PRIVATE void _sapp_x11_main_loop(void) {
+    while (!_sapp.quit_ordered) {
+        if (_sapp.redraw.enabled) {
+            if (_sapp_x11_wait_for_redraw()) {
+                // don't count the idle time as frame duration
+                _sapp_timing_discontinuity(&_sapp.timing);
+                _sapp_frame_history_discontinuity(&_sapp.frame_history);
+            }
+        }
+        int count = XPending(_sapp.x11.display);
+        bool redraw = _sapp_x11_consume_wakeup();
+        redraw |= !_sapp.redraw.enabled || _sapp.redraw.requested || (count > 0) || _sapp_redraw_schedule_due();
+        while (count--) {
+            XEvent event;
+            XNextEvent(_sapp.x11.display, &event);
+            _sapp_x11_process_event(&event);
+        }
+        _sapp_x11_flush_coalesced_event();
+        if (redraw) {
+            _sapp.redraw.requested = false;
+            _sapp_timing_measure(&_sapp.timing);
+            _sapp_linux_frame();
+        }
+        XFlush(_sapp.x11.display);
+        _sapp_x11_quit_check();
+    }
+}
+
+_SOKOL_PRIVATE void _sapp_linux_make_current(bool current) {
+    #if defined(_SAPP_GLX)
+        if (current) {
+            _sapp_glx_make_current();
+        } else {
+            _sapp.glx.MakeCurrent(_sapp.x11.display, None, NULL);
+        }
+    #elif defined(_SAPP_EGL)
+        if (current) {
+            eglMakeCurrent(_sapp.egl.display, _sapp.egl.surface, _sapp.egl.surface, _sapp.egl.context);
+        } else {
+            eglMakeCurrent(_sapp.egl.display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        }
+    #else
+        _SOKOL_UNUSED(current);
+    #endif
+}
+
+// the render thread owns the GL context and calls all user callbacks
+_SOKOL_PRIVATE void* _sapp_rthread_func(void* arg) {
+    _SOKOL_UNUSED(arg);
+    _sapp_linux_make_current(true);
+    while (!_sapp.quit_ordered) {
+        _sapp_input_latency_begin_frame(&_sapp.frame_history.latency);
+        _sapp_rthread_dispatch_events();
+        _sapp_timing_measure(&_sapp.timing);
+        _sapp_linux_frame();
+        _sapp_x11_quit_check();
+    }
+    _sapp_call_cleanup();
+    _sapp_linux_make_current(false);
+    // wake up the main thread so that it notices quit_ordered
+    _sapp_x11_wakeup();
+    return 0;
+}
+
+// the main thread only pumps X11 events while the render thread is running
+_SOKOL_PRIVATE void _sapp_rthread_event_loop(void) {
+    while (!__atomic_load_n(&_sapp.quit_ordered, __ATOMIC_ACQUIRE)) {
+        // a wakeup which raced with the last _sapp_x11_consume_wakeup() may have
+        // left the pending flag set with an already drained eventfd, so never
+        // block while the flag is set
+        if ((0 == XPending(_sapp.x11.display)) && !__atomic_load_n(&_sapp.x11.wakeup_pending, __ATOMIC_SEQ_CST)) {
+            struct pollfd fds[2] = {
+                { ConnectionNumber(_sapp.x11.display), POLLIN, 0 },
+                { _sapp.x11.wakeup_fd, POLLIN, 0 },
+            };
+            poll(fds, 2, -1);
+        }
+        _sapp_x11_consume_wakeup();
+        const int lock_request = __atomic_exchange_n(&_sapp.rthread.mouse_lock_request, -1, __ATOMIC_SEQ_CST);
+        if (lock_request >= 0) {
+            _sapp_x11_lock_mouse(lock_request != 0);
+        }
+        if (__atomic_load_n(&_sapp.quit_ordered, __ATOMIC_ACQUIRE)) {
+            break;
+        }
+        int count = XPending(_sapp.x11.display);
+        while (count--) {
+            XEvent event;
+            XNextEvent(_sapp.x11.display, &event);
+            _sapp_x11_process_event(&event);
+        }
+        _sapp_x11_flush_coalesced_event();
+        XFlush(_sapp.x11.display);
+    }
+}
+
+// start the render thread and run the main thread event loop until
+// the application quits, returns false if the render thread couldn't be started
+_SOKOL_PRIVATE bool _sapp_rthread_start(void) {
+    _sapp_linux_make_current(false);
+    // NOTE: threads are told apart by comparing with the main thread id,
+    // since the render thread might generate events before pthread_create() returns
+    _sapp.rthread.main_thread = pthread_self();
+    _sapp.rthread.mouse_lock_request = -1;
+    _sapp.rthread.mouse_x = _sapp.mouse.x;
+    _sapp.rthread.mouse_y = _sapp.mouse.y;
+    _sapp.rthread.running = true;
+    if (0 != pthread_create(&_sapp.rthread.thread, NULL, _sapp_rthread_func, NULL)) {
+        _SAPP_WARN(LINUX_RENDER_THREAD_CREATE_FAILED);
+        _sapp.rthread.running = false;
+        _sapp_linux_make_current(true);
+        return false;
+    }
+    _sapp_rthread_event_loop();
+    pthread_join(_sapp.rthread.thread, NULL);
+    _sapp.rthread.running = false;
+    return true;
+}
+
+// the render loop in headless mode, there are no events to process
+_SOKOL_PRIVATE void _sapp_headless_main_loop(void) {
+    while (!_sapp.quit_ordered) {
+        _sapp_timing_measure(&_sapp.timing);
+        _sapp_frame();
+        _sapp_x11_quit_check();
+    }
+}
+
+_SOKOL_PRIVATE void _sapp_linux_run_headless(void) {
+    #if defined(_SAPP_EGL)
+        if (0 == _sapp.window_width) {
+            _sapp.window_width = 640;
+        }
+        if (0 == _sapp.window_height) {
+            _sapp.window_height = 480;
+        }
+        _sapp.framebuffer_width = _sapp.window_width;
+        _sapp.framebuffer_height = _sapp.window_height;
+        _sapp_egl_init_headless();
+        _sapp.valid = true;
+        _sapp_headless_main_loop();
+        _sapp_call_cleanup();
+        _sapp_egl_destroy();
+    #else
+        _SAPP_PANIC(LINUX_HEADLESS_REQUIRES_EGL);
     #endif
+    _sapp_discard_state();
 }
 
 _SOKOL_PRIVATE void _sapp_linux_run(const sapp_desc* desc) {
@@ -12461,6 +13689,25 @@ _SOKOL_PRIVATE void _sapp_linux_run(const sapp_desc* desc) {
 
     _sapp_init_state(desc);
     _sapp.x11.window_state = NormalState;
+    _sapp.x11.wakeup_fd = -1;
+    _sapp.x11.coalesce.enabled = desc->coalesce_mouse_events;
+    _sapp.rthread.enabled = desc->render_thread;
+    _sapp.frame_history.latency.enabled = desc->input_latency_tracking;
+    _sapp.headless = desc->headless;
+    if (_sapp.headless) {
+        _sapp_linux_run_headless();
+        return;
+    }
+    #if defined(SOKOL_WGPU)
+    if (_sapp.rthread.enabled) {
+        _SAPP_WARN(LINUX_RENDER_THREAD_WGPU_NOT_SUPPORTED);
+        _sapp.rthread.enabled = false;
+    }
+    #endif
+    if (_sapp.rthread.enabled && _sapp.redraw.enabled) {
+        _SAPP_WARN(LINUX_RENDER_THREAD_RENDER_ON_DEMAND_NOT_SUPPORTED);
+        _sapp.redraw.enabled = false;
+    }
 
     XInitThreads();
     XrmInitialize();
@@ -12484,7 +13731,7 @@ _SOKOL_PRIVATE void _sapp_linux_run(const sapp_desc* desc) {
         _sapp_glx_choose_visual(&visual, &depth);
         _sapp_x11_create_window(visual, depth);
         _sapp_glx_create_context();
-        _sapp_glx_swapinterval(_sapp.swap_interval);
+        _sapp.swap_interval = _sapp_glx_swapinterval(_sapp.swap_interval);
     #elif defined(_SAPP_EGL)
         _sapp_egl_init();
     #elif defined(SOKOL_WGPU)
@@ -12497,29 +13744,14 @@ _SOKOL_PRIVATE void _sapp_linux_run(const sapp_desc* desc) {
     if (_sapp.fullscreen) {
         _sapp_x11_set_fullscreen(true);
     }
+    _sapp_x11_init_wakeup();
 
     XFlush(_sapp.x11.display);
-    while (!_sapp.quit_ordered) {
-        _sapp_timing_measure(&_sapp.timing);
-        int count = XPending(_sapp.x11.display);
-        while (count--) {
-            XEvent event;
-            XNextEvent(_sapp.x11.display, &event);
-            _sapp_x11_process_event(&event);
-        }
-        _sapp_linux_frame();
-        XFlush(_sapp.x11.display);
-        // handle quit-requested, either from window or from sapp_request_quit()
-        if (_sapp.quit_requested && !_sapp.quit_ordered) {
-            // give user code a chance to intervene
-            _sapp_x11_app_event(SAPP_EVENTTYPE_QUIT_REQUESTED);
-            /* if user code hasn't intervened, quit the app */
-            if (_sapp.quit_requested) {
-                _sapp.quit_ordered = true;
-            }
-        }
+    if (!(_sapp.rthread.enabled && _sapp_rthread_start())) {
+        _sapp_x11_main_loop();
     }
     _sapp_call_cleanup();
+    _sapp_x11_discard_wakeup();
     #if defined(_SAPP_GLX)
         _sapp_glx_destroy_context();
     #elif defined(_SAPP_EGL)
@@ -12602,6 +13834,90 @@ SOKOL_API_IMPL double sapp_frame_duration(void) {
     return _sapp_timing_get_avg(&_sapp.timing);
 }
 
+SOKOL_API_IMPL int sapp_query_frame_timings(sapp_frame_timing* out_items, int max_items) {
+    SOKOL_ASSERT(out_items && (max_items >= 0));
+    const _sapp_frame_history_t* h = &_sapp.frame_history;
+    uint64_t num = (h->count < _SAPP_FRAME_HISTORY_SIZE) ? h->count : _SAPP_FRAME_HISTORY_SIZE;
+    if (num > (uint64_t)max_items) {
+        num = (uint64_t)max_items;
+    }
+    const uint64_t first = h->count - num;
+    for (uint64_t i = 0; i < num; i++) {
+        out_items[i] = h->items[(first + i) % _SAPP_FRAME_HISTORY_SIZE];
+    }
+    return (int)num;
+}
+
+SOKOL_API_IMPL sapp_frame_timing_stats sapp_query_frame_timing_stats(void) {
+    sapp_frame_timing_stats res;
+    _sapp_clear(&res, sizeof(res));
+    sapp_frame_timing items[_SAPP_FRAME_HISTORY_SIZE];
+    const int num = sapp_query_frame_timings(items, _SAPP_FRAME_HISTORY_SIZE);
+    double vals[_SAPP_FRAME_HISTORY_SIZE];
+    for (int i = 0; i < num; i++) {
+        vals[i] = items[i].frame_cb_duration;
+    }
+    res.frame_cb_duration = _sapp_frame_percentiles(vals, num);
+    // frame durations are computed from consecutive frame start times,
+    // skipping the idle intervals before frames after a discontinuity
+    int num_durs = 0;
+    for (int i = 1; i < num; i++) {
+        if ((items[i].frame_count == (items[i-1].frame_count + 1)) && !items[i].discontinuity) {
+            vals[num_durs++] = items[i].start - items[i-1].start;
+        }
+    }
+    res.frame_duration = _sapp_frame_percentiles(vals, num_durs);
+    res.num_frames = num;
+    res.missed_vblanks = _sapp.frame_history.missed_vblanks;
+    return res;
+}
+
+SOKOL_API_IMPL sapp_input_latency_stats sapp_query_input_latency_stats(void) {
+    sapp_input_latency_stats res;
+    _sapp_clear(&res, sizeof(res));
+    const _sapp_input_latency_t* l = &_sapp.frame_history.latency;
+    res.num_samples = l->num_samples;
+    res.present_based = _sapp.frame_history.present_times;
+    res.max = l->max;
+    for (int i = 0; i < SAPP_INPUT_LATENCY_NUM_BUCKETS; i++) {
+        res.histogram[i] = l->histogram[i];
+    }
+    if (l->num_samples > 0) {
+        // nearest-rank percentiles from the histogram, reported as the upper bucket bound
+        const int ranks[3] = {
+            (l->num_samples * 50 + 99) / 100,
+            (l->num_samples * 95 + 99) / 100,
+            (l->num_samples * 99 + 99) / 100,
+        };
+        double* results[3] = { &res.p50, &res.p95, &res.p99 };
+        for (int r = 0; r < 3; r++) {
+            int accum = 0;
+            for (int i = 0; i < SAPP_INPUT_LATENCY_NUM_BUCKETS; i++) {
+                accum += l->histogram[i];
+                if (accum >= ranks[r]) {
+                    *results[r] = (double)(i + 1) / 1000.0;
+                    break;
+                }
+            }
+            if (*results[r] > res.max) {
+                *results[r] = res.max;
+            }
+        }
+    }
+    return res;
+}
+
+SOKOL_API_IMPL void sapp_reset_input_latency_stats(void) {
+    _sapp_input_latency_t* l = &_sapp.frame_history.latency;
+    l->num_samples = 0;
+    l->max = 0.0;
+    _sapp_clear(l->histogram, sizeof(l->histogram));
+}
+
+SOKOL_API_IMPL bool sapp_headless(void) {
+    return _sapp.headless;
+}
+
 SOKOL_API_IMPL int sapp_width(void) {
     return (_sapp.framebuffer_width > 0) ? _sapp.framebuffer_width : 1;
 }
@@ -12692,13 +14008,45 @@ SOKOL_API_IMPL bool sapp_is_fullscreen(void) {
     return _sapp.fullscreen;
 }
 
+SOKOL_API_IMPL void sapp_set_swap_interval(int interval) {
+    SOKOL_ASSERT(_sapp.valid);
+    #if defined(_SAPP_LINUX)
+        #if defined(_SAPP_GLX)
+            // a negative interval without adaptive vsync support becomes positive
+            if ((interval < 0) && !_sapp.glx.EXT_swap_control_tear) {
+                interval = -interval;
+            }
+        #elif defined(_SAPP_EGL)
+            interval = _sapp_absi(interval);
+        #endif
+        if (interval == _sapp.swap_interval) {
+            return;
+        }
+        // NOTE: must be called on the thread which has the GL context current
+        #if defined(_SAPP_GLX)
+            _sapp.swap_interval = _sapp_glx_swapinterval(interval);
+        #elif defined(_SAPP_EGL)
+            _sapp.swap_interval = interval;
+            eglSwapInterval(_sapp.egl.display, interval);
+        #endif
+    #else
+        _SOKOL_UNUSED(interval);
+    #endif
+}
+
+SOKOL_API_IMPL int sapp_swap_interval(void) {
+    return _sapp.swap_interval;
+}
+
 SOKOL_API_IMPL void sapp_toggle_fullscreen(void) {
     #if defined(_SAPP_MACOS)
     _sapp_macos_toggle_fullscreen();
     #elif defined(_SAPP_WIN32)
     _sapp_win32_toggle_fullscreen();
     #elif defined(_SAPP_LINUX)
-    _sapp_x11_toggle_fullscreen();
+    if (!_sapp.headless) {
+        _sapp_x11_toggle_fullscreen();
+    }
     #elif defined(_SAPP_EMSCRIPTEN)
     _sapp_emsc_toggle_fullscreen();
     #endif
@@ -12710,7 +14058,9 @@ _SOKOL_PRIVATE void _sapp_update_cursor(sapp_mouse_cursor cursor, bool shown) {
     #elif defined(_SAPP_WIN32)
     _sapp_win32_update_cursor(cursor, shown, false);
     #elif defined(_SAPP_LINUX)
-    _sapp_x11_update_cursor(cursor, shown);
+    if (!_sapp.headless) {
+        _sapp_x11_update_cursor(cursor, shown);
+    }
     #elif defined(_SAPP_EMSCRIPTEN)
     _sapp_emsc_update_cursor(cursor, shown);
     #endif
@@ -12737,14 +14087,24 @@ SOKOL_API_IMPL void sapp_lock_mouse(bool lock) {
     #elif defined(_SAPP_WIN32)
     _sapp_win32_lock_mouse(lock);
     #elif defined(_SAPP_LINUX)
-    _sapp_x11_lock_mouse(lock);
+    if (_sapp_rthread_is_current()) {
+        // the mouse state belongs to the main thread, which applies the request
+        __atomic_store_n(&_sapp.rthread.mouse_lock_request, lock ? 1 : 0, __ATOMIC_SEQ_CST);
+        _sapp_x11_wakeup();
+    } else if (!_sapp.headless) {
+        _sapp_x11_lock_mouse(lock);
+    }
     #else
     _sapp.mouse.locked = lock;
     #endif
 }
 
 SOKOL_API_IMPL bool sapp_mouse_locked(void) {
+    #if defined(_SAPP_LINUX)
+    return __atomic_load_n(&_sapp.mouse.locked, __ATOMIC_ACQUIRE);
+    #else
     return _sapp.mouse.locked;
+    #endif
 }
 
 SOKOL_API_IMPL void sapp_set_mouse_cursor(sapp_mouse_cursor cursor) {
@@ -12778,7 +14138,7 @@ SOKOL_API_IMPL sapp_mouse_cursor sapp_bind_mouse_cursor_image(sapp_mouse_cursor
     #elif defined(_SAPP_WIN32)
     res = _sapp_win32_make_custom_mouse_cursor(cursor, desc);
     #elif defined(_SAPP_LINUX)
-    res = _sapp_x11_make_custom_mouse_cursor(cursor, desc);
+    res = !_sapp.headless && _sapp_x11_make_custom_mouse_cursor(cursor, desc);
     #else
     _SOKOL_UNUSED(desc);
     #endif
@@ -12808,21 +14168,53 @@ SOKOL_APP_API_DECL void sapp_unbind_mouse_cursor_image(sapp_mouse_cursor cursor)
         #elif defined(_SAPP_WIN32)
         _sapp_win32_destroy_custom_mouse_cursor(cursor);
         #elif defined(_SAPP_LINUX)
-        _sapp_x11_destroy_custom_mouse_cursor(cursor);
+        if (!_sapp.headless) {
+            _sapp_x11_destroy_custom_mouse_cursor(cursor);
+        }
         #endif
     }
 }
 
 SOKOL_API_IMPL void sapp_request_quit(void) {
+    #if defined(_SAPP_LINUX)
+    __atomic_store_n(&_sapp.quit_requested, true, __ATOMIC_SEQ_CST);
+    #else
     _sapp.quit_requested = true;
+    #endif
+}
+
+SOKOL_API_IMPL void sapp_request_redraw(void) {
+    _sapp.redraw.requested = true;
+}
+
+SOKOL_API_IMPL void sapp_schedule_redraw(double delay_seconds) {
+    SOKOL_ASSERT(delay_seconds >= 0.0);
+    const double t = _sapp_timestamp_now(&_sapp.timing.timestamp) + delay_seconds;
+    if ((_sapp.redraw.scheduled_time == 0.0) || (t < _sapp.redraw.scheduled_time)) {
+        _sapp.redraw.scheduled_time = t;
+    }
+}
+
+SOKOL_API_IMPL void sapp_wakeup(void) {
+    #if defined(_SAPP_LINUX)
+    _sapp_x11_wakeup();
+    #endif
 }
 
 SOKOL_API_IMPL void sapp_cancel_quit(void) {
+    #if defined(_SAPP_LINUX)
+    __atomic_store_n(&_sapp.quit_requested, false, __ATOMIC_SEQ_CST);
+    #else
     _sapp.quit_requested = false;
+    #endif
 }
 
 SOKOL_API_IMPL void sapp_quit(void) {
+    #if defined(_SAPP_LINUX)
+    __atomic_store_n(&_sapp.quit_ordered, true, __ATOMIC_RELEASE);
+    #else
     _sapp.quit_ordered = true;
+    #endif
 }
 
 SOKOL_API_IMPL void sapp_consume_event(void) {
@@ -12842,7 +14234,9 @@ SOKOL_API_IMPL void sapp_set_clipboard_string(const char* str) {
     #elif defined(_SAPP_WIN32)
         _sapp_win32_set_clipboard_string(str);
     #elif defined(_SAPP_LINUX)
-        _sapp_x11_set_clipboard_string(str);
+        if (!_sapp.headless) {
+            _sapp_x11_set_clipboard_string(str);
+        }
     #else
         /* not implemented */
     #endif
@@ -12860,7 +14254,7 @@ SOKOL_API_IMPL const char* sapp_get_clipboard_string(void) {
     #elif defined(_SAPP_WIN32)
         return _sapp_win32_get_clipboard_string();
     #elif defined(_SAPP_LINUX)
-        return _sapp_x11_get_clipboard_string();
+        return _sapp.headless ? _sapp.clipboard.buffer : _sapp_x11_get_clipboard_string();
     #else
         /* not implemented */
         return _sapp.clipboard.buffer;
@@ -12875,7 +14269,9 @@ SOKOL_API_IMPL void sapp_set_window_title(const char* title) {
     #elif defined(_SAPP_WIN32)
         _sapp_win32_update_window_title();
     #elif defined(_SAPP_LINUX)
-        _sapp_x11_update_window_title();
+        if (!_sapp.headless) {
+            _sapp_x11_update_window_title();
+        }
     #endif
 }
 
@@ -12901,7 +14297,9 @@ SOKOL_API_IMPL void sapp_set_icon(const sapp_icon_desc* desc) {
     #elif defined(_SAPP_WIN32)
         _sapp_win32_set_icon(desc, num_images);
     #elif defined(_SAPP_LINUX)
-        _sapp_x11_set_icon(desc, num_images);
+        if (!_sapp.headless) {
+            _sapp_x11_set_icon(desc, num_images);
+        }
     #elif defined(_SAPP_EMSCRIPTEN)
         _sapp_emsc_set_icon(desc, num_images);
     #endif
@@ -13209,6 +14607,33 @@ SOKOL_API_IMPL bool sapp_gl_is_gles(void) {
     #endif
 }
 
+SOKOL_API_IMPL bool sapp_gl_make_upload_context_current(void) {
+    SOKOL_ASSERT(_sapp.valid);
+    #if defined(_SAPP_GLX)
+        if (_sapp.glx.upload_ctx) {
+            return _sapp.glx.MakeCurrent(_sapp.x11.display, None, _sapp.glx.upload_ctx);
+        }
+    #elif defined(_SAPP_EGL)
+        if (_sapp.egl.upload_context != EGL_NO_CONTEXT) {
+            return eglMakeCurrent(_sapp.egl.display, EGL_NO_SURFACE, EGL_NO_SURFACE, _sapp.egl.upload_context);
+        }
+    #endif
+    return false;
+}
+
+SOKOL_API_IMPL void sapp_gl_release_upload_context(void) {
+    SOKOL_ASSERT(_sapp.valid);
+    #if defined(_SAPP_GLX)
+        if (_sapp.glx.upload_ctx) {
+            _sapp.glx.MakeCurrent(_sapp.x11.display, None, NULL);
+        }
+    #elif defined(_SAPP_EGL)
+        if (_sapp.egl.upload_context != EGL_NO_CONTEXT) {
+            eglMakeCurrent(_sapp.egl.display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        }
+    #endif
+}
+
 SOKOL_API_IMPL const void* sapp_x11_get_window(void) {
     #if defined(_SAPP_LINUX)
         return (void*)_sapp.x11.window;
@@ -34,7 +34,8 @@
 
     The dummy backend replaces the platform-specific backend code with empty
     stub functions. This is useful for writing tests that need to run on the
-    command line.
+    command line. Optionally, the dummy backend can record all backend calls
+    into a binary command stream (see COMMAND RECORDING).
 
     Optionally provide the following defines with your own implementations:
 
@@ -47,6 +48,9 @@
     SOKOL_EXTERNAL_GL_LOADER    - indicates that you're using your own GL loader, in this case
                                   sokol_gfx.h will not include any platform GL headers and disable
                                   the integrated Win32 GL loader
+    SOKOL_GFX_THREAD_LOCAL      - keep the sokol-gfx state in thread-local storage, this allows
+                                  one independent sokol-gfx instance per thread (search below
+                                  for THREAD-LOCAL INSTANCES)
 
     If sokol_gfx.h is compiled as a DLL, define the following before
     including the declaration or implementation:
@@ -345,6 +349,43 @@
         is associated with one draw call, but will be problematic when
         a single indexed draw call spans several appended chunks of indices.
 
+    --- to push many small chunks of per-frame vertex- or index-data without
+        creating one dynamic buffer per chunk, call:
+
+            sg_transient_range sg_append_transient_vertices(const sg_range* data)
+            sg_transient_range sg_append_transient_indices(const sg_range* data)
+
+        The transient buffers are two stream-update buffers owned by sokol-gfx
+        (one for vertex-, one for index-data) which are created in sg_setup()
+        when sg_desc.transient_vertex_buffer_size and/or
+        sg_desc.transient_index_buffer_size is > 0. Each call sub-allocates
+        a 4-byte aligned chunk from the current frame's region and returns
+        the buffer handle and byte offset, which are directly plugged into
+        the sg_bindings struct:
+
+        sg_transient_range vtx = sg_append_transient_vertices(&SG_RANGE(verts));
+        sg_transient_range idx = sg_append_transient_indices(&SG_RANGE(indices));
+        sg_apply_bindings(&(sg_bindings){
+            .vertex_buffers[0] = vtx.buffer,
+            .vertex_buffer_offsets[0] = vtx.offset,
+            .index_buffer = idx.buffer,
+            .index_buffer_offset = idx.offset,
+        });
+
+        The transient buffers are rewound at the start of each frame, there is
+        no upper limit on the number of calls per frame except the configured
+        buffer size. If a chunk doesn't fit into the remaining space, the
+        returned range has the .overflowed flag set, and its buffer and offset
+        mark the range as overflowed when plugged into sg_bindings. An
+        sg_apply_bindings() call with such a range skips validation, and the
+        following draw calls are silently dropped until the next
+        sg_apply_bindings(). Bindings which don't contain an overflowed range
+        are validated as usual. Check for this situation with:
+
+            bool sg_query_transient_overflow(void)
+
+        ...and increase the transient buffer sizes accordingly.
+
     --- to check at runtime for optional features, limits and pixelformat support,
         call:
 
@@ -423,6 +464,14 @@
             sg_disable_frame_stats()
             sg_frame_stats_enabled()
 
+        ...and the stats of the last SG_MAX_FRAME_STATS_HISTORY (256) frames via:
+
+            int sg_query_frame_stats_history(sg_frame_stats* stats, int max_frames)
+
+        ...this copies up to max_frames of the most recent frame stats into
+        the stats array (oldest frame first) and returns the number of copied
+        frame stats. Frames where stats collection was disabled are skipped.
+
     --- you can ask at runtime what backend sokol_gfx.h has been compiled for:
 
             sg_backend sg_query_backend(void)
@@ -1815,7 +1864,243 @@
     images and views, but not for samplers, shaders or pipelines. Most notably, trying
     to create a pipeline object with a shader that's not in VALID state will
     trigger a validation layer error, or if the validation layer is disabled,
-    result in a pipeline object in FAILED state.
+    result in a pipeline object in FAILED state (the exception is a shader
+    which is still being compiled asynchronously, see below).
+
+
+    ASYNCHRONOUS SHADER COMPILATION
+    ===============================
+    On GL, compiling and linking shaders is usually the most expensive part of
+    application startup. To spread this cost, shaders can be created with the
+    following functions instead of sg_make_shader() / sg_init_shader():
+
+        sg_shader sg_make_shader_async(const sg_shader_desc* desc)
+        void sg_init_shader_async(sg_shader shd, const sg_shader_desc* desc)
+
+    Those kick off shader compilation and linking but don't wait for the result,
+    the returned shader stays in ALLOC state until the GL driver has finished
+    building the program. Outstanding shader builds are polled in sg_commit(),
+    and finished shaders are moved into VALID or FAILED state.
+
+    Pipeline objects can be created right away with a shader that's still being
+    compiled, such a pipeline will also stay in ALLOC state, and will be
+    initialized as soon as its shader has finished compiling. Calling
+    sg_apply_pipeline() with such a pending pipeline is not an error, instead
+    all following sg_apply_bindings(), sg_apply_uniforms() and draw calls
+    will be silently skipped until the next sg_apply_pipeline() or the end
+    of the render pass (so the object simply 'pops in' once it's ready).
+
+    If the GL driver supports GL_KHR_parallel_shader_compile or
+    GL_ARB_parallel_shader_compile, shaders are compiled on driver threads
+    and any number of shaders may finish per frame. Without the extension,
+    at most one pending shader is finished per sg_commit() (which blocks until
+    that shader has been compiled), so that the startup cost is spread over
+    several frames instead of a single long stall.
+
+    On all other backends, the async functions are equivalent with
+    sg_make_shader() / sg_init_shader().
+
+    You can query the number of shaders which are still pending with:
+
+        int sg_query_num_pending_shaders(void)
+
+    IMPORTANT: the shader desc struct is copied, but not the data it
+    points to, all strings and bytecode blobs referenced by the desc must
+    remain valid until the shader has left the ALLOC state.
+
+
+    BACKGROUND UPLOADS
+    ==================
+    On GL, creating and filling big immutable buffers and images with
+    sg_make_buffer() / sg_make_image() may cause frame hitches because the
+    data is copied by the driver on the rendering thread. If the window
+    system glue can provide a second GL context which shares GL objects with
+    the context sokol-gfx is using (for instance sokol_app.h with
+    sapp_desc.gl_upload_context), the GL object creation and data upload can
+    be moved to a worker thread which has that shared context current:
+
+        bool sg_gl_upload_buffer(sg_buffer_desc* desc)
+        bool sg_gl_upload_image(sg_image_desc* desc)
+
+    Both functions only work for immutable resources which are initialized
+    with data, and they may *only* be called on a thread which has the
+    shared upload context current. They don't touch any sokol-gfx state, so
+    it's safe to call them while sokol-gfx is used on the render thread.
+
+    The functions create a GL object, upload the data from the desc, insert
+    a GL fence, and write the GL object and fence into the desc struct
+    (desc->gl_buffers[0] or desc->gl_textures[0], and desc->gl_sync). The
+    data range(s) in the desc are cleared, since the GL object already
+    contains the data. The desc struct is then passed to the render thread,
+    where it is used to create the actual sokol-gfx resource with
+    sg_make_buffer() or sg_make_image(). Before the GL object is used for
+    the first time, the render thread GL context waits for the fence on the
+    GPU (so the render thread is never blocked on the CPU).
+
+    Unlike 'regular' injected GL objects, sokol-gfx takes ownership of
+    GL objects which come with a gl_sync fence and will delete them when
+    the resource is destroyed. This is also true when sg_make_buffer() or
+    sg_make_image() fails (for instance because of a validation error or
+    an exhausted resource pool), in that case the GL object and fence are
+    deleted right away.
+
+    The data pointed to by the desc is no longer needed after the upload
+    function has returned. If the upload function returns false, nothing
+    has been created and the desc is unchanged.
+
+    On non-GL backends the functions return false.
+
+
+    ASYNC READBACK
+    ==============
+    On GL, the content of an image (usually the color attachment of an
+    offscreen pass) can be copied back into CPU memory without stalling
+    the CPU until the GPU has finished rendering. The readback goes through
+    a pixel buffer object which is owned by a caller-provided
+    sg_gl_readback struct:
+
+        sg_gl_readback rb = {0};
+
+    Outside of a pass, start the readback with:
+
+        bool sg_gl_begin_readback(sg_gl_readback* rb, sg_image img)
+
+    This records a copy of the image content into the pixel buffer object
+    and inserts a GL fence. The image must be a 2D image with sample count 1
+    and pixel format SG_PIXELFORMAT_RGBA8 or SG_PIXELFORMAT_SRGB8A8 (for
+    MSAA rendering, read back the resolve image).
+
+    Later (usually one or more frames later), poll whether the data has
+    arrived with:
+
+        bool sg_gl_readback_ready(sg_gl_readback* rb)
+
+    ...and copy the pixel data into your own memory with:
+
+        bool sg_gl_end_readback(sg_gl_readback* rb, sg_range dst)
+
+    sg_gl_end_readback() waits for the readback to finish if it hasn't
+    finished yet. The pixel data is written tightly packed (width * 4 bytes
+    per row) in top-to-bottom row order (the first row is the top row of
+    the rendered image). The required size is rb->width * rb->height * 4.
+
+    The pixel buffer object is kept alive in the sg_gl_readback struct and
+    is reused by the next sg_gl_begin_readback() call, so a small number of
+    readback structs can be cycled for a whole batch of snapshots. Release
+    the pixel buffer object with:
+
+        void sg_gl_discard_readback(sg_gl_readback* rb)
+
+    On non-GL backends and on WebGL2 (which has neither glMapBufferRange()
+    nor blocking fence waits) the readback functions return false, on
+    WebGL2 sg_gl_begin_readback() also logs an error.
+
+
+    THREAD-LOCAL INSTANCES
+    ======================
+    By default, sokol-gfx keeps all its state in a single global variable,
+    which means that there can only be one sokol-gfx instance per process,
+    and it must only be used from one thread.
+
+    When the implementation is compiled with SOKOL_GFX_THREAD_LOCAL defined,
+    the sokol-gfx state is kept in thread-local storage instead, and each
+    thread which calls sg_setup() gets its own, completely independent
+    sokol-gfx instance. For instance, on a server, each worker thread
+    can have its own GL context current (e.g. an EGL surfaceless context)
+    and render with its own sokol-gfx instance in parallel to the other
+    worker threads (see ssnap_run_workers() in sokol_snapshot.h).
+
+    The usual rules still apply per instance: all sokol-gfx functions must
+    be called on the thread which called sg_setup(), and sokol-gfx resource
+    handles are only valid for the instance which created them.
+
+    In this mode, sg_gl_upload_buffer() and sg_gl_upload_image() cannot be
+    used, since they are called on a different thread than the one
+    which owns the sokol-gfx instance.
+
+
+    COMMAND RECORDING
+    =================
+    With SOKOL_DUMMY_BACKEND, sokol-gfx can record every call into the
+    backend as a compact binary command stream. This allows to check the
+    sequence of backend calls produced by rendering code in tests which run
+    without a GPU, and to count redundant state changes. To enable command
+    recording, set the size of the command buffer in bytes in sg_setup():
+
+        sg_setup(&(sg_desc){
+            .dummy_command_buffer_size = 1024 * 1024,
+            // ...
+        });
+
+    Only calls which reach the backend are recorded, e.g. calls which
+    are rejected by the validation layer, or draw calls which are skipped
+    because of invalid bindings are not recorded. The recorded commands
+    accumulate until sg_dummy_reset_commands() is called:
+
+        sg_dummy_commands sg_dummy_query_commands(void)
+        void sg_dummy_reset_commands(void)
+
+    sg_dummy_query_commands() returns the recorded command stream (as a
+    pointer into the command buffer, this is only valid until the next
+    sokol-gfx call), the number of recorded commands, and an overflow
+    flag. When the command buffer is full, recording stops (so that the
+    recorded commands are always a complete prefix of the actual backend
+    calls), the overflow flag is set and a warning is logged.
+
+    The command stream is an array of uint32_t words in native byte order.
+    Each command starts with a header word which has the command code
+    (sg_dummy_command) in the lower 16 bits and the number of following
+    argument words in the upper 16 bits. All resource objects are recorded
+    as their handle id. Uploaded data and uniform data isn't recorded,
+    only its size and a 32-bit hash. The argument words of each command are:
+
+        CREATE_BUFFER:      buf_id, size
+        CREATE_IMAGE:       img_id, type, pixel_format, width, height, num_slices,
+                            num_mipmaps, sample_count
+        CREATE_SAMPLER:     smp_id
+        CREATE_SHADER:      shd_id
+        CREATE_PIPELINE:    pip_id, shd_id
+        CREATE_VIEW:        view_id, view_type, buf_id or img_id
+        DISCARD_*:          id of the discarded object
+        BEGIN_PASS:         compute, width, height, ds_view_id, num_color_views,
+                            (color_view_id, resolve_view_id) * num_color_views
+        END_PASS:           -
+        COMMIT:             -
+        APPLY_VIEWPORT:     x, y, width, height, origin_top_left
+        APPLY_SCISSOR_RECT: x, y, width, height, origin_top_left
+        APPLY_PIPELINE:     pip_id
+        APPLY_BINDINGS:     vb_mask, view_mask, smp_mask, ib_id, ib_offset,
+                            (vb_id, vb_offset) for each bit in vb_mask,
+                            view_id for each bit in view_mask,
+                            smp_id for each bit in smp_mask
+        APPLY_UNIFORMS:     ub_slot, size, hash
+        DRAW:               base_element, num_elements, num_instances,
+                            base_vertex, base_instance
+        DISPATCH:           num_groups_x, num_groups_y, num_groups_z
+        UPDATE_BUFFER:      buf_id, size, hash
+        APPEND_BUFFER:      buf_id, size, hash, new_frame
+        UPDATE_IMAGE:       img_id, size, hash
+
+    Since resource handle ids are assigned deterministically, running the
+    same rendering code twice produces the same command stream, so that the
+    command stream can be written to a 'golden file', and later runs
+    can be compared against the golden file with:
+
+        int sg_dummy_compare_commands(const sg_range* expected)
+
+    ...which returns the index of the first command which differs from the
+    expected command stream, or -1 if the recorded commands are identical.
+
+    While command recording is enabled, the dummy backend also tracks the
+    applied state like a real backend's state cache would (the tracked
+    state is reset at the start of each pass), and counts the redundant
+    state changes in the frame stats (see sg_frame_stats_dummy). A
+    'redundant' state change sets a viewport, scissor rect, pipeline,
+    binding slot, or uniform block to the same value it already had.
+
+    Without command recording, the dummy backend remains a set of empty
+    functions, so that the cost of the sokol-gfx frontend (validation,
+    resource pool lookups and frame stats) can be measured in isolation.
 
 
     WEBGPU CAVEATS
@@ -2030,6 +2315,7 @@ enum {
     SG_MAX_PORTABLE_TEXTURE_BINDINGS_PER_STAGE = 16,
     SG_MAX_PORTABLE_STORAGEBUFFER_BINDINGS_PER_STAGE = 8,   // assuming sg_features.compute = true
     SG_MAX_PORTABLE_STORAGEIMAGE_BINDINGS_PER_STAGE = 4,    // assuming sg_features.compute = true
+    SG_MAX_FRAME_STATS_HISTORY = 256,
 };
 
 /*
@@ -3216,6 +3502,7 @@ typedef struct sg_buffer_desc {
     const char* label;
     // optionally inject backend-specific resources
     uint32_t gl_buffers[SG_NUM_INFLIGHT_FRAMES];
+    const void* gl_sync;    // GL sync object from sg_gl_upload_buffer()
     const void* mtl_buffers[SG_NUM_INFLIGHT_FRAMES];
     const void* d3d11_buffer;
     const void* wgpu_buffer;
@@ -3386,6 +3673,7 @@ typedef struct sg_image_desc {
     // optionally inject backend-specific resources
     uint32_t gl_textures[SG_NUM_INFLIGHT_FRAMES];
     uint32_t gl_texture_target;
+    const void* gl_sync;    // GL sync object from sg_gl_upload_image()
     const void* mtl_textures[SG_NUM_INFLIGHT_FRAMES];
     const void* d3d11_texture;
     const void* wgpu_texture;
@@ -4084,6 +4372,27 @@ typedef struct sg_view_info {
     Allows to track generic and backend-specific stats about a
     render frame. Obtained by calling sg_query_frame_stats(). The returned
     struct contains information about the *previous* frame.
+
+    Besides the number of calls, the following items describe the volume
+    of work submitted in a frame:
+
+    .size_uploaded          - the sum of the size_update_buffer, size_append_buffer
+                              and size_update_image items
+    .num_elements           - the number of vertices or indices submitted in draw calls
+    .num_instances          - the number of instances submitted in draw calls
+    .num_primitives         - the number of points, lines or triangles drawn
+                              (including all instances)
+    .num_pipeline_switches  - number of sg_apply_pipeline() calls with a different
+                              pipeline than the previous call in the same pass
+    .num_bindings_switches  - number of sg_apply_bindings() calls with different
+                              bindings than the previous call in the same pass
+    .max_pipeline_switches_per_pass
+    .max_bindings_switches_per_pass
+                            - the max number of pipeline and bindings switches
+                              in a single pass
+
+    The frame stats of the last SG_MAX_FRAME_STATS_HISTORY frames can be
+    obtained with sg_query_frame_stats_history().
 */
 typedef struct sg_frame_stats_gl {
     uint32_t num_bind_buffer;
@@ -4234,6 +4543,19 @@ typedef struct sg_frame_stats_wgpu {
     sg_frame_stats_wgpu_bindings bindings;
 } sg_frame_stats_wgpu;
 
+typedef struct sg_frame_stats_dummy {
+    uint32_t num_commands;
+    uint32_t size_commands;
+    uint32_t num_redundant_viewport;
+    uint32_t num_redundant_scissor_rect;
+    uint32_t num_redundant_pipeline;
+    uint32_t num_redundant_vertex_buffer;
+    uint32_t num_redundant_index_buffer;
+    uint32_t num_redundant_view;
+    uint32_t num_redundant_sampler;
+    uint32_t num_redundant_uniforms;
+} sg_frame_stats_dummy;
+
 typedef struct sg_resource_stats {
     uint32_t total_alive;   // number of live objects in pool
     uint32_t total_free;    // number of free objects in pool
@@ -4264,6 +4586,15 @@ typedef struct sg_frame_stats {
     uint32_t size_append_buffer;
     uint32_t size_update_image;
 
+    uint64_t size_uploaded;
+    uint64_t num_elements;
+    uint64_t num_instances;
+    uint64_t num_primitives;
+    uint32_t num_pipeline_switches;
+    uint32_t num_bindings_switches;
+    uint32_t max_pipeline_switches_per_pass;
+    uint32_t max_bindings_switches_per_pass;
+
     sg_resource_stats buffers;
     sg_resource_stats images;
     sg_resource_stats samplers;
@@ -4275,6 +4606,7 @@ typedef struct sg_frame_stats {
     sg_frame_stats_d3d11 d3d11;
     sg_frame_stats_metal metal;
     sg_frame_stats_wgpu wgpu;
+    sg_frame_stats_dummy dummy;
 } sg_frame_stats;
 
 /*
@@ -4294,6 +4626,8 @@ typedef struct sg_frame_stats {
     _SG_LOGITEM_XMACRO(GL_STORAGEIMAGE_GLSL_BINDING_OUT_OF_RANGE, "GLSL storage image bindslot is out of range (sg.limits.max_storage_image_bindings_per_stage) (gl)") \
     _SG_LOGITEM_XMACRO(GL_SHADER_COMPILATION_FAILED, "shader compilation failed (gl)") \
     _SG_LOGITEM_XMACRO(GL_SHADER_LINKING_FAILED, "shader linking failed (gl)") \
+    _SG_LOGITEM_XMACRO(GL_PROGRAM_BINARY_NOT_SUPPORTED, "sg_desc.gl_program_cache_dir is set, but the GL driver doesn't support program binaries (gl)") \
+    _SG_LOGITEM_XMACRO(GL_PROGRAM_CACHE_STORE_FAILED, "failed to write program binary to sg_desc.gl_program_cache_dir (gl)") \
     _SG_LOGITEM_XMACRO(GL_VERTEX_ATTRIBUTE_NOT_FOUND_IN_SHADER, "vertex attribute not found in shader; NOTE: may be caused by GL driver's GLSL compiler removing unused globals") \
     _SG_LOGITEM_XMACRO(GL_UNIFORMBLOCK_NAME_NOT_FOUND_IN_SHADER, "uniform block name not found in shader; NOTE: may be caused by GL driver's GLSL compiler removing unused globals") \
     _SG_LOGITEM_XMACRO(GL_IMAGE_SAMPLER_NAME_NOT_FOUND_IN_SHADER, "image-sampler name not found in shader; NOTE: may be caused by GL driver's GLSL compiler removing unused globals") \
@@ -4303,6 +4637,12 @@ typedef struct sg_frame_stats {
     _SG_LOGITEM_XMACRO(GL_FRAMEBUFFER_STATUS_UNSUPPORTED, "framebuffer completeness check failed with GL_FRAMEBUFFER_UNSUPPORTED (gl)") \
     _SG_LOGITEM_XMACRO(GL_FRAMEBUFFER_STATUS_INCOMPLETE_MULTISAMPLE, "framebuffer completeness check failed with GL_FRAMEBUFFER_INCOMPLETE_MULTISAMPLE (gl)") \
     _SG_LOGITEM_XMACRO(GL_FRAMEBUFFER_STATUS_UNKNOWN, "framebuffer completeness check failed (unknown reason) (gl)") \
+    _SG_LOGITEM_XMACRO(GL_UPLOAD_INVALID_DESC, "sg_gl_upload_buffer/image(): only immutable, non-injected resources with data can be uploaded (gl)") \
+    _SG_LOGITEM_XMACRO(GL_READBACK_INVALID_IMAGE, "sg_gl_begin_readback(): only valid 2D images with sample count 1 and pixel format RGBA8 or SRGB8A8 can be read back (gl)") \
+    _SG_LOGITEM_XMACRO(GL_READBACK_IN_PASS, "sg_gl_begin_readback(): cannot be called inside a pass (gl)") \
+    _SG_LOGITEM_XMACRO(GL_READBACK_BUSY, "sg_gl_begin_readback(): readback object already has a readback in flight (gl)") \
+    _SG_LOGITEM_XMACRO(GL_READBACK_NOT_SUPPORTED, "sg_gl_begin_readback(): async readback is not supported on WebGL2 (gl)") \
+    _SG_LOGITEM_XMACRO(GL_READBACK_DST_TOO_SMALL, "sg_gl_end_readback(): destination range too small for readback data (gl)") \
     _SG_LOGITEM_XMACRO(D3D11_FEATURE_LEVEL_0_DETECTED, "D3D11 Feature Level 0 device detected, this restricts the number of UAV slots to 8! (d3d11)") \
     _SG_LOGITEM_XMACRO(D3D11_CREATE_BUFFER_FAILED, "CreateBuffer() failed (d3d11)") \
     _SG_LOGITEM_XMACRO(D3D11_CREATE_BUFFER_SRV_FAILED, "CreateShaderResourceView() failed for storage buffer (d3d11)") \
@@ -4338,6 +4678,7 @@ typedef struct sg_frame_stats {
     _SG_LOGITEM_XMACRO(D3D11_MAP_FOR_APPEND_BUFFER_FAILED, "Map() failed when appending to buffer (d3d11)") \
     _SG_LOGITEM_XMACRO(D3D11_MAP_FOR_UPDATE_IMAGE_FAILED, "Map() failed when updating image (d3d11)") \
     _SG_LOGITEM_XMACRO(METAL_CREATE_BUFFER_FAILED, "failed to create buffer object (metal)") \
+    _SG_LOGITEM_XMACRO(METAL_GROWABLE_POOLS_NOT_SUPPORTED, "sg_desc.growable_pools is not supported, pools remain fixed-size (metal)") \
     _SG_LOGITEM_XMACRO(METAL_TEXTURE_FORMAT_NOT_SUPPORTED, "pixel format not supported for texture (metal)") \
     _SG_LOGITEM_XMACRO(METAL_CREATE_TEXTURE_FAILED, "failed to create texture object (metal)") \
     _SG_LOGITEM_XMACRO(METAL_CREATE_SAMPLER_FAILED, "failed to create sampler object (metal)") \
@@ -4373,8 +4714,12 @@ typedef struct sg_frame_stats {
     _SG_LOGITEM_XMACRO(WGPU_CREATE_PIPELINE_LAYOUT_FAILED, "wgpuDeviceCreatePipelineLayout() failed") \
     _SG_LOGITEM_XMACRO(WGPU_CREATE_RENDER_PIPELINE_FAILED, "wgpuDeviceCreateRenderPipeline() failed") \
     _SG_LOGITEM_XMACRO(WGPU_CREATE_COMPUTE_PIPELINE_FAILED, "wgpuDeviceCreateComputePipeline() failed") \
+    _SG_LOGITEM_XMACRO(DUMMY_COMMAND_BUFFER_FULL, "command buffer full, recording stopped (increase sg_desc.dummy_command_buffer_size) (dummy)") \
     _SG_LOGITEM_XMACRO(IDENTICAL_COMMIT_LISTENER, "attempting to add identical commit listener") \
     _SG_LOGITEM_XMACRO(COMMIT_LISTENER_ARRAY_FULL, "commit listener array full") \
+    _SG_LOGITEM_XMACRO(TRANSIENT_BUFFER_NOT_CONFIGURED, "transient buffer size is 0 (set sg_desc.transient_vertex_buffer_size / .transient_index_buffer_size)") \
+    _SG_LOGITEM_XMACRO(TRANSIENT_BUFFER_CREATION_FAILED, "failed to create transient buffer (buffer pool exhausted?)") \
+    _SG_LOGITEM_XMACRO(TRANSIENT_BUFFER_OVERFLOW, "transient buffer overflow (increase sg_desc.transient_vertex_buffer_size / .transient_index_buffer_size)") \
     _SG_LOGITEM_XMACRO(TRACE_HOOKS_NOT_ENABLED, "sg_install_trace_hooks() called, but SOKOL_TRACE_HOOKS is not defined") \
     _SG_LOGITEM_XMACRO(DEALLOC_BUFFER_INVALID_STATE, "sg_dealloc_buffer(): buffer must be in ALLOC state") \
     _SG_LOGITEM_XMACRO(DEALLOC_IMAGE_INVALID_STATE, "sg_dealloc_image(): image must be in alloc state") \
@@ -4726,11 +5071,17 @@ typedef enum sg_log_item {
     .pipeline_pool_size             64
     .view_pool_size                 256
     .uniform_buffer_size            4 MB (4*1024*1024)
+    .transient_vertex_buffer_size   0 (transient vertex buffer disabled)
+    .transient_index_buffer_size    0 (transient index buffer disabled)
     .max_commit_listeners           1024
     .disable_validation             false
+    .disable_validation_cache       false
+    .dedup_pipelines_and_samplers   false
+    .growable_pools                 false
     .mtl_force_managed_storage_mode false
     .wgpu_disable_bindgroups_cache  false
     .wgpu_bindgroups_cache_size     1024
+    .dummy_command_buffer_size      0 (command recording disabled)
 
     .allocator.alloc_fn     0 (in this case, malloc() will be called)
     .allocator.free_fn      0 (in this case, free() will be called)
@@ -4743,6 +5094,58 @@ typedef enum sg_log_item {
     .environment.defaults.depth_format: SG_PIXELFORMAT_DEPTH_STENCIL
     .environment.defaults.sample_count: 1
 
+    .transient_vertex_buffer_size
+    .transient_index_buffer_size
+        the per-frame capacity in bytes of the internal transient vertex-
+        and index-buffers used by sg_append_transient_vertices() and
+        sg_append_transient_indices(), each transient buffer occupies
+        one slot in the buffer pool
+
+    .growable_pools
+        if true, a resource pool which runs out of free slots grows by 50%
+        (up to the maximum of 65535 items) instead of failing the allocation,
+        the .*_pool_size items then just define the initial pool sizes.
+        Existing resource handles remain valid when a pool grows, resource
+        objects are stored in fixed-size chunks which never move, so the
+        handle lookup remains a constant-time operation. Not supported
+        on the Metal backend (a warning is logged and the pools remain
+        fixed-size).
+
+    .disable_validation_cache
+        in debug mode, the validation layer remembers which combinations
+        of pipeline and resource bindings have passed the checks in
+        sg_apply_pipeline() and sg_apply_bindings() in the current pass,
+        and skips the checks when the same combination is applied again,
+        until a resource object is created, destroyed or changes its state,
+        or a buffer overflows in sg_append_buffer(). Set this to true to run
+        the full checks on each call (for instance when debugging the
+        validation layer itself). Without SOKOL_DEBUG, there's no validation
+        layer and this item is ignored.
+
+    .dedup_pipelines_and_samplers
+        if true, sg_make_pipeline() and sg_make_sampler() return the existing
+        handle when called with a desc struct that's identical to a live
+        pipeline or sampler created by the same function (the .label item
+        is ignored), instead of creating a new object. Shared objects are
+        reference counted, sg_destroy_pipeline() and sg_destroy_sampler()
+        only destroy the object when the last reference is released. Note
+        that the lower-level sg_uninit_*(), sg_dealloc_*() and sg_init_*()
+        functions bypass the reference count and affect all users of a
+        shared object.
+
+    GL specific:
+        .gl_program_cache_dir
+            path to an existing directory for the on-disk program binary
+            cache (default: 0, program binary cache disabled). When set,
+            linked GL programs are stored via glGetProgramBinary() in files
+            named after a hash of the shader sources and the GL_VENDOR,
+            GL_RENDERER and GL_VERSION strings, and subsequent
+            sg_make_shader() calls with identical sources restore the program
+            with glProgramBinary() instead of compiling and linking the GLSL
+            source. Stale or corrupt cache files are silently ignored and
+            overwritten. Not supported on WebGL2, or if the GL driver
+            doesn't report any program binary formats.
+
     Metal specific:
         (NOTE: All Objective-C object references are transferred through
         a bridged cast (__bridge const void*) to sokol_gfx, which will use an
@@ -4794,6 +5197,12 @@ typedef enum sg_log_item {
         .environment.wgpu.device
             a WGPUDevice handle
 
+    Dummy backend specific:
+        .dummy_command_buffer_size
+            the size in bytes of the buffer which records the backend
+            calls, command recording is disabled when this is zero
+            (see the documentation section COMMAND RECORDING)
+
     When using sokol_gfx.h and sokol_app.h together, consider using the
     helper function sglue_environment() in the sokol_glue.h header to
     initialize the sg_desc.environment nested struct. sglue_environment() returns
@@ -4877,6 +5286,24 @@ typedef struct sg_logger {
     void* user_data;
 } sg_logger;
 
+/*
+    sg_transient_range
+
+    Returned by sg_append_transient_vertices() and sg_append_transient_indices(),
+    contains the internal transient buffer handle and the byte offset of the
+    appended data, to be plugged into sg_bindings.vertex_buffers[] and
+    sg_bindings.vertex_buffer_offsets[] (or .index_buffer and .index_buffer_offset).
+
+    If the data didn't fit into the transient buffer, .overflowed will be
+    true, and .offset will be -1. Draw calls which use such a range
+    are skipped.
+*/
+typedef struct sg_transient_range {
+    sg_buffer buffer;
+    int offset;
+    bool overflowed;
+} sg_transient_range;
+
 typedef struct sg_desc {
     uint32_t _start_canary;
     int buffer_pool_size;
@@ -4886,14 +5313,21 @@ typedef struct sg_desc {
     int pipeline_pool_size;
     int view_pool_size;
     int uniform_buffer_size;
+    int transient_vertex_buffer_size;
+    int transient_index_buffer_size;
     int max_commit_listeners;
     bool disable_validation;            // disable validation layer even in debug mode, useful for tests
+    bool disable_validation_cache;      // always run the full sg_apply_pipeline() and sg_apply_bindings() validation in debug mode
     bool enforce_portable_limits;       // if true, enforce portable resource binding limits (SG_MAX_PORTABLE_*)
+    bool dedup_pipelines_and_samplers;  // if true, identical pipeline and sampler desc structs share one ref-counted object
+    bool growable_pools;                // if true, exhausted resource pools grow instead of failing allocation (not on Metal)
+    const char* gl_program_cache_dir;   // GL only: directory for the on-disk program binary cache (default: 0, disabled)
     bool d3d11_shader_debugging;        // if true, HLSL shaders are compiled with D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION
     bool mtl_force_managed_storage_mode; // for debugging: use Metal managed storage mode for resources even with UMA
     bool mtl_use_command_buffer_with_retained_references;    // Metal: use a managed MTLCommandBuffer which ref-counts used resources
     bool wgpu_disable_bindgroups_cache;  // set to true to disable the WebGPU backend BindGroup cache
     int wgpu_bindgroups_cache_size;      // number of slots in the WebGPU bindgroup cache (must be 2^N)
+    int dummy_command_buffer_size;      // dummy backend only: if > 0, record backend calls into a command buffer of this size
     sg_allocator allocator;
     sg_logger logger; // optional log function override
     sg_environment environment;
@@ -4929,6 +5363,9 @@ SOKOL_GFX_API_DECL void sg_update_image(sg_image img, const sg_image_data* data)
 SOKOL_GFX_API_DECL int sg_append_buffer(sg_buffer buf, const sg_range* data);
 SOKOL_GFX_API_DECL bool sg_query_buffer_overflow(sg_buffer buf);
 SOKOL_GFX_API_DECL bool sg_query_buffer_will_overflow(sg_buffer buf, size_t size);
+SOKOL_GFX_API_DECL sg_transient_range sg_append_transient_vertices(const sg_range* data);
+SOKOL_GFX_API_DECL sg_transient_range sg_append_transient_indices(const sg_range* data);
+SOKOL_GFX_API_DECL bool sg_query_transient_overflow(void);
 
 // render and compute functions
 SOKOL_GFX_API_DECL void sg_begin_pass(const sg_pass* pass);
@@ -5028,11 +5465,17 @@ SOKOL_GFX_API_DECL void sg_fail_shader(sg_shader shd);
 SOKOL_GFX_API_DECL void sg_fail_pipeline(sg_pipeline pip);
 SOKOL_GFX_API_DECL void sg_fail_view(sg_view view);
 
+// asynchronous shader compilation
+SOKOL_GFX_API_DECL sg_shader sg_make_shader_async(const sg_shader_desc* desc);
+SOKOL_GFX_API_DECL void sg_init_shader_async(sg_shader shd, const sg_shader_desc* desc);
+SOKOL_GFX_API_DECL int sg_query_num_pending_shaders(void);
+
 // frame stats
 SOKOL_GFX_API_DECL void sg_enable_frame_stats(void);
 SOKOL_GFX_API_DECL void sg_disable_frame_stats(void);
 SOKOL_GFX_API_DECL bool sg_frame_stats_enabled(void);
 SOKOL_GFX_API_DECL sg_frame_stats sg_query_frame_stats(void);
+SOKOL_GFX_API_DECL int sg_query_frame_stats_history(sg_frame_stats* stats, int max_frames);
 
 /* Backend-specific structs and functions, these may come in handy for mixing
    sokol-gfx rendering with 'native backend' rendering functions.
@@ -5152,6 +5595,70 @@ typedef struct sg_gl_view_info {
     uint32_t msaa_resolve_frame_buffer;
 } sg_gl_view_info;
 
+/*
+    sg_gl_readback
+
+    Caller-owned state of an asynchronous GL image readback, see
+    the section ASYNC READBACK for details. Zero-initialize before the
+    first use.
+*/
+typedef struct sg_gl_readback {
+    uint32_t pbo;           // GL pixel buffer object, reused between readbacks
+    size_t pbo_size;
+    const void* sync;       // GLsync fence of the readback in flight, or 0
+    int width;
+    int height;
+} sg_gl_readback;
+
+/*
+    sg_dummy_command
+
+    The command codes in the command stream recorded by the dummy
+    backend, see the section COMMAND RECORDING for details.
+*/
+typedef enum sg_dummy_command {
+    SG_DUMMYCOMMAND_INVALID,
+    SG_DUMMYCOMMAND_CREATE_BUFFER,
+    SG_DUMMYCOMMAND_CREATE_IMAGE,
+    SG_DUMMYCOMMAND_CREATE_SAMPLER,
+    SG_DUMMYCOMMAND_CREATE_SHADER,
+    SG_DUMMYCOMMAND_CREATE_PIPELINE,
+    SG_DUMMYCOMMAND_CREATE_VIEW,
+    SG_DUMMYCOMMAND_DISCARD_BUFFER,
+    SG_DUMMYCOMMAND_DISCARD_IMAGE,
+    SG_DUMMYCOMMAND_DISCARD_SAMPLER,
+    SG_DUMMYCOMMAND_DISCARD_SHADER,
+    SG_DUMMYCOMMAND_DISCARD_PIPELINE,
+    SG_DUMMYCOMMAND_DISCARD_VIEW,
+    SG_DUMMYCOMMAND_BEGIN_PASS,
+    SG_DUMMYCOMMAND_END_PASS,
+    SG_DUMMYCOMMAND_COMMIT,
+    SG_DUMMYCOMMAND_APPLY_VIEWPORT,
+    SG_DUMMYCOMMAND_APPLY_SCISSOR_RECT,
+    SG_DUMMYCOMMAND_APPLY_PIPELINE,
+    SG_DUMMYCOMMAND_APPLY_BINDINGS,
+    SG_DUMMYCOMMAND_APPLY_UNIFORMS,
+    SG_DUMMYCOMMAND_DRAW,
+    SG_DUMMYCOMMAND_DISPATCH,
+    SG_DUMMYCOMMAND_UPDATE_BUFFER,
+    SG_DUMMYCOMMAND_APPEND_BUFFER,
+    SG_DUMMYCOMMAND_UPDATE_IMAGE,
+    _SG_DUMMYCOMMAND_NUM,
+    _SG_DUMMYCOMMAND_FORCE_U32 = 0x7FFFFFFF
+} sg_dummy_command;
+
+/*
+    sg_dummy_commands
+
+    The command stream recorded by the dummy backend, returned
+    by sg_dummy_query_commands().
+*/
+typedef struct sg_dummy_commands {
+    sg_range data;          // the recorded uint32_t command words
+    int num_commands;       // number of recorded commands
+    bool overflow;          // true if the command buffer was full and recording has stopped
+} sg_dummy_commands;
+
 // D3D11: return ID3D11Device
 SOKOL_GFX_API_DECL const void* sg_d3d11_device(void);
 // D3D11: return ID3D11DeviceContext
@@ -5219,6 +5726,25 @@ SOKOL_GFX_API_DECL sg_gl_sampler_info sg_gl_query_sampler_info(sg_sampler smp);
 SOKOL_GFX_API_DECL sg_gl_shader_info sg_gl_query_shader_info(sg_shader shd);
 // GL: get internal view resource objects
 SOKOL_GFX_API_DECL sg_gl_view_info sg_gl_query_view_info(sg_view view);
+// GL: create and fill an immutable buffer on a shared GL context (see BACKGROUND UPLOADS)
+SOKOL_GFX_API_DECL bool sg_gl_upload_buffer(sg_buffer_desc* desc);
+// GL: create and fill an immutable image on a shared GL context (see BACKGROUND UPLOADS)
+SOKOL_GFX_API_DECL bool sg_gl_upload_image(sg_image_desc* desc);
+// GL: start an asynchronous image readback (see ASYNC READBACK)
+SOKOL_GFX_API_DECL bool sg_gl_begin_readback(sg_gl_readback* rb, sg_image img);
+// GL: check if an asynchronous image readback has finished
+SOKOL_GFX_API_DECL bool sg_gl_readback_ready(sg_gl_readback* rb);
+// GL: copy the result of an asynchronous image readback, waits if not finished yet
+SOKOL_GFX_API_DECL bool sg_gl_end_readback(sg_gl_readback* rb, sg_range dst);
+// GL: release the GL resources owned by a readback struct
+SOKOL_GFX_API_DECL void sg_gl_discard_readback(sg_gl_readback* rb);
+
+// Dummy: get the backend commands recorded since the last reset (see COMMAND RECORDING)
+SOKOL_GFX_API_DECL sg_dummy_commands sg_dummy_query_commands(void);
+// Dummy: clear the recorded backend commands
+SOKOL_GFX_API_DECL void sg_dummy_reset_commands(void);
+// Dummy: compare the recorded commands with an expected command stream, returns index of first mismatch or -1
+SOKOL_GFX_API_DECL int sg_dummy_compare_commands(const sg_range* expected);
 
 #ifdef __cplusplus
 } // extern "C"
@@ -5251,9 +5777,14 @@ inline void sg_init_sampler(sg_sampler smp, const sg_sampler_desc& desc) { retur
 inline void sg_init_shader(sg_shader shd, const sg_shader_desc& desc) { return sg_init_shader(shd, &desc); }
 inline void sg_init_pipeline(sg_pipeline pip, const sg_pipeline_desc& desc) { return sg_init_pipeline(pip, &desc); }
 inline void sg_init_view(sg_view view, const sg_view_desc& desc) { return sg_init_view(view, &desc); }
+inline sg_shader sg_make_shader_async(const sg_shader_desc& desc) { return sg_make_shader_async(&desc); }
+inline void sg_init_shader_async(sg_shader shd, const sg_shader_desc& desc) { return sg_init_shader_async(shd, &desc); }
 
 inline void sg_update_buffer(sg_buffer buf_id, const sg_range& data) { return sg_update_buffer(buf_id, &data); }
 inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_append_buffer(buf_id, &data); }
+inline sg_transient_range sg_append_transient_vertices(const sg_range& data) { return sg_append_transient_vertices(&data); }
+inline sg_transient_range sg_append_transient_indices(const sg_range& data) { return sg_append_transient_indices(&data); }
+inline int sg_dummy_compare_commands(const sg_range& expected) { return sg_dummy_compare_commands(&expected); }
 #endif
 #endif // SOKOL_GFX_INCLUDED
 
@@ -5448,17 +5979,22 @@ inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_
         #if defined(GL_VERSION_3_2) || defined(_SOKOL_USE_WIN32_GL_LOADER)
             #define _SOKOL_GL_HAS_BASEVERTEX (1)
         #endif
+        #if defined(GL_VERSION_4_1) || defined(_SOKOL_USE_WIN32_GL_LOADER)
+            #define _SOKOL_GL_HAS_PROGRAM_BINARY (1)
+        #endif
     #elif defined(__APPLE__)
         #if defined(TARGET_OS_IPHONE) && !TARGET_OS_IPHONE
             #define _SOKOL_GL_HAS_BASEVERTEX (1)
         #else
             #define _SOKOL_GL_HAS_TEXSTORAGE (1)
         #endif
+        #define _SOKOL_GL_HAS_PROGRAM_BINARY (1)
     #elif defined(__EMSCRIPTEN__)
         #define _SOKOL_GL_HAS_TEXSTORAGE (1)
     #elif defined(__ANDROID__)
         #define _SOKOL_GL_HAS_COMPUTE (1)
         #define _SOKOL_GL_HAS_TEXSTORAGE (1)
+        #define _SOKOL_GL_HAS_PROGRAM_BINARY (1)
     #elif defined(__linux__) || defined(__unix__)
         #if defined(SOKOL_GLCORE)
             #if defined(GL_VERSION_4_3)
@@ -5472,10 +6008,28 @@ inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_
             #if defined(GL_VERSION_3_2)
                 #define _SOKOL_GL_HAS_BASEVERTEX (1)
             #endif
+            #if defined(GL_VERSION_4_1)
+                #define _SOKOL_GL_HAS_PROGRAM_BINARY (1)
+            #endif
         #else
             #define _SOKOL_GL_HAS_COMPUTE (1)
             #define _SOKOL_GL_HAS_TEXSTORAGE (1)
             #define _SOKOL_GL_HAS_BASEVERTEX (1)
+            #define _SOKOL_GL_HAS_PROGRAM_BINARY (1)
+        #endif
+    #endif
+    #if defined(_SOKOL_GL_HAS_PROGRAM_BINARY)
+        #include <stdio.h>  // fopen, fread, fwrite, rename (program binary cache)
+        #if defined(_WIN32)
+            #ifndef WIN32_LEAN_AND_MEAN
+            #define WIN32_LEAN_AND_MEAN
+            #endif
+            #ifndef NOMINMAX
+            #define NOMINMAX
+            #endif
+            #include <windows.h>    // GetCurrentProcessId, MoveFileExA
+        #else
+            #include <unistd.h>     // getpid
         #endif
     #endif
 
@@ -5513,6 +6067,7 @@ inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_
         typedef int64_t  GLint64;
         typedef float  GLfloat;
         typedef int  GLint;
+        typedef struct __GLsync* GLsync;
         #define GL_INT_2_10_10_10_REV 0x8D9F
         #define GL_R32F 0x822E
         #define GL_PROGRAM_POINT_SIZE 0x8642
@@ -5843,6 +6398,54 @@ inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_
     #ifndef GL_COMPUTE_SHADER
     #define GL_COMPUTE_SHADER 0x91B9
     #endif
+    #ifndef GL_VENDOR
+    #define GL_VENDOR 0x1F00
+    #endif
+    #ifndef GL_RENDERER
+    #define GL_RENDERER 0x1F01
+    #endif
+    #ifndef GL_VERSION
+    #define GL_VERSION 0x1F02
+    #endif
+    #ifndef GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+    #define GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0x8257
+    #endif
+    #ifndef GL_PROGRAM_BINARY_LENGTH
+    #define GL_PROGRAM_BINARY_LENGTH 0x8741
+    #endif
+    #ifndef GL_NUM_PROGRAM_BINARY_FORMATS
+    #define GL_NUM_PROGRAM_BINARY_FORMATS 0x87FE
+    #endif
+    #ifndef GL_COMPLETION_STATUS_KHR
+    #define GL_COMPLETION_STATUS_KHR 0x91B1
+    #endif
+    #ifndef GL_SYNC_GPU_COMMANDS_COMPLETE
+    #define GL_SYNC_GPU_COMMANDS_COMPLETE 0x9117
+    #endif
+    #ifndef GL_TIMEOUT_IGNORED
+    #define GL_TIMEOUT_IGNORED 0xFFFFFFFFFFFFFFFFull
+    #endif
+    #ifndef GL_SYNC_FLUSH_COMMANDS_BIT
+    #define GL_SYNC_FLUSH_COMMANDS_BIT 0x00000001
+    #endif
+    #ifndef GL_ALREADY_SIGNALED
+    #define GL_ALREADY_SIGNALED 0x911A
+    #endif
+    #ifndef GL_CONDITION_SATISFIED
+    #define GL_CONDITION_SATISFIED 0x911C
+    #endif
+    #ifndef GL_PIXEL_PACK_BUFFER
+    #define GL_PIXEL_PACK_BUFFER 0x88EB
+    #endif
+    #ifndef GL_STREAM_READ
+    #define GL_STREAM_READ 0x88E1
+    #endif
+    #ifndef GL_MAP_READ_BIT
+    #define GL_MAP_READ_BIT 0x0001
+    #endif
+    #ifndef GL_PACK_ALIGNMENT
+    #define GL_PACK_ALIGNMENT 0x0D05
+    #endif
     #ifndef _SG_GL_CHECK_ERROR
         #if defined(__EMSCRIPTEN__)
             // generally turn off glGetError() on WASM, it's a too big performance hit
@@ -5948,6 +6551,9 @@ enum {
     _SG_SLOT_SHIFT = 16,
     _SG_SLOT_MASK = (1<<_SG_SLOT_SHIFT)-1,
     _SG_MAX_POOL_SIZE = (1<<_SG_SLOT_SHIFT),
+    _SG_POOL_CHUNK_SHIFT = 6,
+    _SG_POOL_CHUNK_SIZE = (1<<_SG_POOL_CHUNK_SHIFT),
+    _SG_POOL_CHUNK_MASK = _SG_POOL_CHUNK_SIZE-1,
     _SG_DEFAULT_BUFFER_POOL_SIZE = 128,
     _SG_DEFAULT_IMAGE_POOL_SIZE = 128,
     _SG_DEFAULT_SAMPLER_POOL_SIZE = 64,
@@ -5957,6 +6563,8 @@ enum {
     _SG_DEFAULT_UB_SIZE = 4 * 1024 * 1024,
     _SG_DEFAULT_MAX_COMMIT_LISTENERS = 1024,
     _SG_DEFAULT_WGPU_BINDGROUP_CACHE_SIZE = 1024,
+    _SG_VALIDATE_CACHE_NUM_PIPELINES = 64,     // must be 2^N
+    _SG_VALIDATE_CACHE_NUM_BINDINGS = 256,     // must be 2^N
     _SG_MAX_STORAGEBUFFER_BINDINGS_PER_STAGE = SG_MAX_VIEW_BINDSLOTS,
     _SG_MAX_STORAGEIMAGE_BINDINGS_PER_STAGE = SG_MAX_VIEW_BINDSLOTS,
     _SG_MAX_TEXTURE_BINDINGS_PER_STAGE = SG_MAX_VIEW_BINDSLOTS,
@@ -6066,6 +6674,7 @@ typedef struct {
     int sample_count;
     sg_color blend_color;
     bool alpha_to_coverage_enabled;
+    uint64_t state_hash;    // hash over the render state, see _sg_pipeline_state_hash()
 } _sg_pipeline_common_t;
 
 typedef struct {
@@ -6124,6 +6733,34 @@ typedef struct _sg_view_s {
 } _sg_dummy_view_t;
 typedef _sg_dummy_view_t _sg_view_t;
 
+// applied state for counting redundant state changes, reset at the start of a pass
+typedef struct {
+    bool viewport_valid;
+    bool scissor_rect_valid;
+    int viewport[5];
+    int scissor_rect[5];
+    uint32_t pip_id;
+    uint32_t vb_ids[SG_MAX_VERTEXBUFFER_BINDSLOTS];
+    int vb_offsets[SG_MAX_VERTEXBUFFER_BINDSLOTS];
+    uint32_t ib_id;
+    int ib_offset;
+    uint32_t view_ids[SG_MAX_VIEW_BINDSLOTS];
+    uint32_t smp_ids[SG_MAX_SAMPLER_BINDSLOTS];
+    bool ub_valid[SG_MAX_UNIFORMBLOCK_BINDSLOTS];
+    uint32_t ub_sizes[SG_MAX_UNIFORMBLOCK_BINDSLOTS];
+    uint32_t ub_hashes[SG_MAX_UNIFORMBLOCK_BINDSLOTS];
+} _sg_dummy_state_cache_t;
+
+typedef struct {
+    bool recording;         // true if sg_desc.dummy_command_buffer_size > 0
+    bool overflow;
+    uint32_t* cmds;         // the recorded command words
+    int capacity;           // capacity of the command buffer in uint32_t words
+    int pos;                // write position in uint32_t words
+    int num_commands;
+    _sg_dummy_state_cache_t cache;
+} _sg_dummy_backend_t;
+
 #elif defined(_SOKOL_ANY_GL)
 
 typedef enum {
@@ -6196,6 +6833,11 @@ typedef struct _sg_shader_s {
         uint8_t sbuf_binding[SG_MAX_VIEW_BINDSLOTS];
         uint8_t simg_binding[SG_MAX_VIEW_BINDSLOTS];
         int8_t tex_slot[SG_MAX_TEXTURE_SAMPLER_PAIRS]; // GL texture unit index
+        struct {
+            GLuint shaders[2];      // shader stage objects between compile and link status check
+            bool from_cache;        // true if program was restored from program binary cache
+            uint64_t cache_key;
+        } build;
     } gl;
 } _sg_gl_shader_t;
 typedef _sg_gl_shader_t _sg_shader_t;
@@ -6282,6 +6924,7 @@ typedef struct {
     GLenum cur_index_type;
     GLenum cur_active_texture;
     _sg_sref_t cur_pip;
+    uint64_t cur_pip_state_hash;
 } _sg_gl_cache_t;
 
 typedef struct {
@@ -6290,10 +6933,19 @@ typedef struct {
     GLuint fb;      // global mutated framebuffer
     _sg_gl_cache_t cache;
     bool ext_anisotropic;
+    bool ext_parallel_shader_compile;
+    uint32_t sync_build_frame_index;    // frame index of last blocking async shader finish
     GLint max_anisotropy;
     sg_store_action color_store_actions[SG_MAX_COLOR_ATTACHMENTS];
     sg_store_action depth_store_action;
     sg_store_action stencil_store_action;
+    #if defined(_SOKOL_GL_HAS_PROGRAM_BINARY)
+    struct {
+        bool enabled;
+        uint64_t driver_hash;   // hash over GL_VENDOR, GL_RENDERER and GL_VERSION
+        char* dir;
+    } program_cache;
+    #endif
     #if _SOKOL_USE_WIN32_GL_LOADER
     HINSTANCE opengl32_dll;
     #endif
@@ -6759,12 +7411,14 @@ typedef struct _sg_pools_s {
     _sg_pool_t shader_pool;
     _sg_pool_t pipeline_pool;
     _sg_pool_t view_pool;
-    _sg_buffer_t* buffers;
-    _sg_image_t* images;
-    _sg_sampler_t* samplers;
-    _sg_shader_t* shaders;
-    _sg_pipeline_t* pipelines;
-    _sg_view_t* views;
+    // resource items are stored in fixed-size chunks so that item
+    // pointers remain stable when a pool grows, see _sg_buffer_at_index()
+    void** buffer_chunks;
+    void** image_chunks;
+    void** sampler_chunks;
+    void** shader_chunks;
+    void** pipeline_chunks;
+    void** view_chunks;
 } _sg_pools_t;
 
 typedef struct {
@@ -6773,6 +7427,67 @@ typedef struct {
     sg_commit_listener* items;
 } _sg_commit_listeners_t;
 
+// shaders which are still compiling asynchronously, and pipelines waiting for
+// them, the desc arrays are indexed by pool slot index
+typedef struct {
+    int num_shaders;
+    int num_pipelines;
+    sg_shader_desc** shader_descs;
+    sg_pipeline_desc** pipeline_descs;
+} _sg_pending_t;
+
+// shared pipeline and sampler objects (sg_desc.dedup_pipelines_and_samplers),
+// indexed by pool slot index, a ref_count of 0 means the slot isn't shared
+typedef struct {
+    uint64_t hash;
+    int ref_count;
+    int next;       // next slot index in the same hash bucket, 0 terminates the chain
+} _sg_dedup_item_t;
+
+typedef struct {
+    int num_buckets;            // always a power of 2
+    int* buckets;               // first slot index per bucket, 0 if empty
+    _sg_dedup_item_t* items;    // indexed by pool slot index
+} _sg_dedup_table_t;
+
+typedef struct {
+    bool enabled;
+    _sg_dedup_table_t pipelines;
+    sg_pipeline_desc* pipeline_descs;
+    _sg_dedup_table_t samplers;
+    sg_sampler_desc* sampler_descs;
+} _sg_dedup_t;
+
+#if defined(SOKOL_DEBUG)
+// successful sg_apply_pipeline() and sg_apply_bindings() validations, an item
+// is only valid while its epoch matches the current validate cache epoch, the
+// epoch is bumped at pass boundaries and when any resource object changes state
+typedef struct {
+    uint32_t epoch;
+    uint32_t pip_id;
+} _sg_validate_cache_pipeline_t;
+
+typedef struct {
+    uint32_t pip_id;
+    uint32_t ib_id;
+    uint32_t vb_ids[SG_MAX_VERTEXBUFFER_BINDSLOTS];
+    uint32_t view_ids[SG_MAX_VIEW_BINDSLOTS];
+    uint32_t smp_ids[SG_MAX_SAMPLER_BINDSLOTS];
+} _sg_validate_cache_bindings_key_t;
+
+typedef struct {
+    uint32_t epoch;
+    _sg_validate_cache_bindings_key_t key;
+} _sg_validate_cache_bindings_t;
+
+typedef struct {
+    bool enabled;
+    uint32_t epoch;
+    _sg_validate_cache_pipeline_t* pipelines;   // _SG_VALIDATE_CACHE_NUM_PIPELINES items, indexed by pipeline slot index
+    _sg_validate_cache_bindings_t* bindings;    // _SG_VALIDATE_CACHE_NUM_BINDINGS items, indexed by key hash
+} _sg_validate_cache_t;
+#endif
+
 // resolved pass attachments struct
 typedef struct {
     bool empty;
@@ -6821,6 +7536,7 @@ typedef struct {
         } swapchain;
     } cur_pass;
     _sg_pipeline_ref_t cur_pip;
+    bool cur_pip_pending;   // applied pipeline is waiting for an async shader, skip draws
     bool next_draw_valid;
     bool use_indexed_draw;
     bool use_instanced_draw;
@@ -6828,6 +7544,7 @@ typedef struct {
     uint32_t applied_bindings_and_uniforms;     // bits 0..7: uniform blocks, bit 8: bindings
     #if defined(SOKOL_DEBUG)
     sg_log_item validate_error;
+    _sg_validate_cache_t validate_cache;
     #endif
     _sg_pools_t pools;
     sg_backend backend;
@@ -6837,6 +7554,15 @@ typedef struct {
     bool stats_enabled;
     sg_frame_stats stats;
     sg_frame_stats prev_stats;
+    sg_frame_stats* stats_history;      // ring buffer with SG_MAX_FRAME_STATS_HISTORY items
+    uint32_t stats_history_count;       // number of frame stats written into the history
+    struct {
+        uint32_t pip_id;                // last applied pipeline in current pass
+        bool bindings_valid;
+        sg_bindings bindings;           // last applied bindings in current pass
+        uint32_t num_pipeline_switches;
+        uint32_t num_bindings_switches;
+    } stats_pass;
     #if defined(_SOKOL_ANY_GL)
     _sg_gl_backend_t gl;
     #elif defined(SOKOL_METAL)
@@ -6845,13 +7571,36 @@ typedef struct {
     _sg_d3d11_backend_t d3d11;
     #elif defined(SOKOL_WGPU)
     _sg_wgpu_backend_t wgpu;
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    _sg_dummy_backend_t dummy;
     #endif
     #if defined(SOKOL_TRACE_HOOKS)
     sg_trace_hooks hooks;
     #endif
     _sg_commit_listeners_t commit_listeners;
+    _sg_pending_t pending;
+    _sg_dedup_t dedup;
+    struct {
+        sg_buffer vbuf;
+        sg_buffer ibuf;
+        uint32_t overflow_frame_index;  // frame index of last transient buffer overflow
+    } transient;
 } _sg_state_t;
-static _sg_state_t _sg;
+#if defined(SOKOL_GFX_THREAD_LOCAL)
+    // one sokol-gfx instance per thread, see THREAD-LOCAL INSTANCES
+    #if defined(__cplusplus)
+        #define _SG_THREAD_LOCAL thread_local
+    #elif defined(_MSC_VER)
+        #define _SG_THREAD_LOCAL __declspec(thread)
+    #elif defined(__GNUC__) || defined(__clang__)
+        #define _SG_THREAD_LOCAL __thread
+    #else
+        #define _SG_THREAD_LOCAL _Thread_local
+    #endif
+#else
+    #define _SG_THREAD_LOCAL
+#endif
+static _SG_THREAD_LOCAL _sg_state_t _sg;
 
 // ██       ██████   ██████   ██████  ██ ███    ██  ██████
 // ██      ██    ██ ██       ██       ██ ████   ██ ██
@@ -6945,6 +7694,17 @@ _SOKOL_PRIVATE void _sg_free(void* ptr) {
     }
 }
 
+// grow an allocation, the new tail is zero-initialized
+_SOKOL_PRIVATE void* _sg_realloc_clear(void* old_ptr, size_t old_size, size_t new_size) {
+    SOKOL_ASSERT(new_size > old_size);
+    void* new_ptr = _sg_malloc_clear(new_size);
+    if (old_ptr) {
+        memcpy(new_ptr, old_ptr, old_size);
+        _sg_free(old_ptr);
+    }
+    return new_ptr;
+}
+
 _SOKOL_PRIVATE bool _sg_strempty(const _sg_str_t* str) {
     return 0 == str->buf[0];
 }
@@ -7030,6 +7790,62 @@ _SOKOL_PRIVATE void _sg_pool_free_index(_sg_pool_t* pool, int slot_index) {
     SOKOL_ASSERT(pool->queue_top <= (pool->size-1));
 }
 
+_SOKOL_PRIVATE int _sg_pool_num_chunks(int pool_size) {
+    return (pool_size + _SG_POOL_CHUNK_SIZE - 1) >> _SG_POOL_CHUNK_SHIFT;
+}
+
+// make sure that the chunk table has enough chunks for new_size items,
+// existing chunks are never moved, so pointers to items remain valid
+_SOKOL_PRIVATE void _sg_pool_alloc_chunks(void*** chunks, int old_size, int new_size, size_t item_size) {
+    SOKOL_ASSERT(chunks && (new_size > old_size));
+    const int old_num_chunks = _sg_pool_num_chunks(old_size);
+    const int new_num_chunks = _sg_pool_num_chunks(new_size);
+    if (new_num_chunks > old_num_chunks) {
+        *chunks = (void**)_sg_realloc_clear(*chunks, (size_t)old_num_chunks * sizeof(void*), (size_t)new_num_chunks * sizeof(void*));
+        for (int i = old_num_chunks; i < new_num_chunks; i++) {
+            (*chunks)[i] = _sg_malloc_clear(item_size * _SG_POOL_CHUNK_SIZE);
+        }
+    }
+}
+
+_SOKOL_PRIVATE void _sg_pool_free_chunks(void** chunks, int pool_size) {
+    if (chunks) {
+        const int num_chunks = _sg_pool_num_chunks(pool_size);
+        for (int i = 0; i < num_chunks; i++) {
+            _sg_free(chunks[i]);
+        }
+        _sg_free(chunks);
+    }
+}
+
+// grow an exhausted pool by 50% (at least one chunk, rounded up to whole chunks),
+// returns false if the pool is already at its maximum size
+_SOKOL_PRIVATE bool _sg_pool_grow(_sg_pool_t* pool, void*** chunks, size_t item_size) {
+    SOKOL_ASSERT(pool && pool->gen_ctrs && pool->free_queue);
+    SOKOL_ASSERT(0 == pool->queue_top);
+    const int old_size = pool->size;
+    if (old_size >= _SG_MAX_POOL_SIZE) {
+        return false;
+    }
+    int new_size = old_size + (old_size >> 1);
+    if (new_size <= old_size) {
+        new_size = old_size + 1;
+    }
+    new_size = (new_size + _SG_POOL_CHUNK_MASK) & ~_SG_POOL_CHUNK_MASK;
+    if (new_size > _SG_MAX_POOL_SIZE) {
+        new_size = _SG_MAX_POOL_SIZE;
+    }
+    _sg_pool_alloc_chunks(chunks, old_size, new_size, item_size);
+    pool->gen_ctrs = (uint32_t*)_sg_realloc_clear(pool->gen_ctrs, sizeof(uint32_t) * (size_t)old_size, sizeof(uint32_t) * (size_t)new_size);
+    _sg_free(pool->free_queue);
+    pool->free_queue = (int*)_sg_malloc_clear(sizeof(int) * (size_t)(new_size - 1));
+    pool->size = new_size;
+    for (int i = new_size - 1; i >= old_size; i--) {
+        pool->free_queue[pool->queue_top++] = i;
+    }
+    return true;
+}
+
 _SOKOL_PRIVATE void _sg_slot_reset(_sg_slot_t* slot) {
     SOKOL_ASSERT(slot);
     _sg_clear(slot, sizeof(_sg_slot_t));
@@ -7095,43 +7911,37 @@ _SOKOL_PRIVATE void _sg_setup_pools(_sg_pools_t* p, const sg_desc* desc) {
     // note: the pools here will have an additional item, since slot 0 is reserved
     SOKOL_ASSERT((desc->buffer_pool_size > 0) && (desc->buffer_pool_size < _SG_MAX_POOL_SIZE));
     _sg_pool_init(&p->buffer_pool, desc->buffer_pool_size);
-    size_t buffer_pool_byte_size = sizeof(_sg_buffer_t) * (size_t)p->buffer_pool.size;
-    p->buffers = (_sg_buffer_t*) _sg_malloc_clear(buffer_pool_byte_size);
+    _sg_pool_alloc_chunks(&p->buffer_chunks, 0, p->buffer_pool.size, sizeof(_sg_buffer_t));
 
     SOKOL_ASSERT((desc->image_pool_size > 0) && (desc->image_pool_size < _SG_MAX_POOL_SIZE));
     _sg_pool_init(&p->image_pool, desc->image_pool_size);
-    size_t image_pool_byte_size = sizeof(_sg_image_t) * (size_t)p->image_pool.size;
-    p->images = (_sg_image_t*) _sg_malloc_clear(image_pool_byte_size);
+    _sg_pool_alloc_chunks(&p->image_chunks, 0, p->image_pool.size, sizeof(_sg_image_t));
 
     SOKOL_ASSERT((desc->sampler_pool_size > 0) && (desc->sampler_pool_size < _SG_MAX_POOL_SIZE));
     _sg_pool_init(&p->sampler_pool, desc->sampler_pool_size);
-    size_t sampler_pool_byte_size = sizeof(_sg_sampler_t) * (size_t)p->sampler_pool.size;
-    p->samplers = (_sg_sampler_t*) _sg_malloc_clear(sampler_pool_byte_size);
+    _sg_pool_alloc_chunks(&p->sampler_chunks, 0, p->sampler_pool.size, sizeof(_sg_sampler_t));
 
     SOKOL_ASSERT((desc->shader_pool_size > 0) && (desc->shader_pool_size < _SG_MAX_POOL_SIZE));
     _sg_pool_init(&p->shader_pool, desc->shader_pool_size);
-    size_t shader_pool_byte_size = sizeof(_sg_shader_t) * (size_t)p->shader_pool.size;
-    p->shaders = (_sg_shader_t*) _sg_malloc_clear(shader_pool_byte_size);
+    _sg_pool_alloc_chunks(&p->shader_chunks, 0, p->shader_pool.size, sizeof(_sg_shader_t));
 
     SOKOL_ASSERT((desc->pipeline_pool_size > 0) && (desc->pipeline_pool_size < _SG_MAX_POOL_SIZE));
     _sg_pool_init(&p->pipeline_pool, desc->pipeline_pool_size);
-    size_t pipeline_pool_byte_size = sizeof(_sg_pipeline_t) * (size_t)p->pipeline_pool.size;
-    p->pipelines = (_sg_pipeline_t*) _sg_malloc_clear(pipeline_pool_byte_size);
+    _sg_pool_alloc_chunks(&p->pipeline_chunks, 0, p->pipeline_pool.size, sizeof(_sg_pipeline_t));
 
     SOKOL_ASSERT((desc->view_pool_size > 0) && (desc->view_pool_size < _SG_MAX_POOL_SIZE));
     _sg_pool_init(&p->view_pool, desc->view_pool_size);
-    size_t view_pool_byte_size = sizeof(_sg_view_t) * (size_t)p->view_pool.size;
-    p->views = (_sg_view_t*) _sg_malloc_clear(view_pool_byte_size);
+    _sg_pool_alloc_chunks(&p->view_chunks, 0, p->view_pool.size, sizeof(_sg_view_t));
 }
 
 _SOKOL_PRIVATE void _sg_discard_pools(_sg_pools_t* p) {
     SOKOL_ASSERT(p);
-    _sg_free(p->views);     p->views = 0;
-    _sg_free(p->pipelines); p->pipelines = 0;
-    _sg_free(p->shaders);   p->shaders = 0;
-    _sg_free(p->samplers);  p->samplers = 0;
-    _sg_free(p->images);    p->images = 0;
-    _sg_free(p->buffers);   p->buffers = 0;
+    _sg_pool_free_chunks(p->view_chunks, p->view_pool.size);         p->view_chunks = 0;
+    _sg_pool_free_chunks(p->pipeline_chunks, p->pipeline_pool.size); p->pipeline_chunks = 0;
+    _sg_pool_free_chunks(p->shader_chunks, p->shader_pool.size);     p->shader_chunks = 0;
+    _sg_pool_free_chunks(p->sampler_chunks, p->sampler_pool.size);   p->sampler_chunks = 0;
+    _sg_pool_free_chunks(p->image_chunks, p->image_pool.size);       p->image_chunks = 0;
+    _sg_pool_free_chunks(p->buffer_chunks, p->buffer_pool.size);     p->buffer_chunks = 0;
     _sg_pool_discard(&p->view_pool);
     _sg_pool_discard(&p->pipeline_pool);
     _sg_pool_discard(&p->shader_pool);
@@ -7169,47 +7979,78 @@ _SOKOL_PRIVATE int _sg_slot_index(uint32_t id) {
     return slot_index;
 }
 
+// returns pointer to resource by pool slot index (two-level lookup into the pool chunks)
+_SOKOL_PRIVATE _sg_buffer_t* _sg_buffer_at_index(int slot_index) {
+    SOKOL_ASSERT((slot_index >= 0) && (slot_index < _sg.pools.buffer_pool.size));
+    return &((_sg_buffer_t*)_sg.pools.buffer_chunks[slot_index >> _SG_POOL_CHUNK_SHIFT])[slot_index & _SG_POOL_CHUNK_MASK];
+}
+
+_SOKOL_PRIVATE _sg_image_t* _sg_image_at_index(int slot_index) {
+    SOKOL_ASSERT((slot_index >= 0) && (slot_index < _sg.pools.image_pool.size));
+    return &((_sg_image_t*)_sg.pools.image_chunks[slot_index >> _SG_POOL_CHUNK_SHIFT])[slot_index & _SG_POOL_CHUNK_MASK];
+}
+
+_SOKOL_PRIVATE _sg_sampler_t* _sg_sampler_at_index(int slot_index) {
+    SOKOL_ASSERT((slot_index >= 0) && (slot_index < _sg.pools.sampler_pool.size));
+    return &((_sg_sampler_t*)_sg.pools.sampler_chunks[slot_index >> _SG_POOL_CHUNK_SHIFT])[slot_index & _SG_POOL_CHUNK_MASK];
+}
+
+_SOKOL_PRIVATE _sg_shader_t* _sg_shader_at_index(int slot_index) {
+    SOKOL_ASSERT((slot_index >= 0) && (slot_index < _sg.pools.shader_pool.size));
+    return &((_sg_shader_t*)_sg.pools.shader_chunks[slot_index >> _SG_POOL_CHUNK_SHIFT])[slot_index & _SG_POOL_CHUNK_MASK];
+}
+
+_SOKOL_PRIVATE _sg_pipeline_t* _sg_pipeline_at_index(int slot_index) {
+    SOKOL_ASSERT((slot_index >= 0) && (slot_index < _sg.pools.pipeline_pool.size));
+    return &((_sg_pipeline_t*)_sg.pools.pipeline_chunks[slot_index >> _SG_POOL_CHUNK_SHIFT])[slot_index & _SG_POOL_CHUNK_MASK];
+}
+
+_SOKOL_PRIVATE _sg_view_t* _sg_view_at_index(int slot_index) {
+    SOKOL_ASSERT((slot_index >= 0) && (slot_index < _sg.pools.view_pool.size));
+    return &((_sg_view_t*)_sg.pools.view_chunks[slot_index >> _SG_POOL_CHUNK_SHIFT])[slot_index & _SG_POOL_CHUNK_MASK];
+}
+
 // returns pointer to resource by id without matching id check
 _SOKOL_PRIVATE _sg_buffer_t* _sg_buffer_at(uint32_t buf_id) {
     SOKOL_ASSERT(SG_INVALID_ID != buf_id);
     int slot_index = _sg_slot_index(buf_id);
     SOKOL_ASSERT((slot_index > _SG_INVALID_SLOT_INDEX) && (slot_index < _sg.pools.buffer_pool.size));
-    return &_sg.pools.buffers[slot_index];
+    return _sg_buffer_at_index(slot_index);
 }
 
 _SOKOL_PRIVATE _sg_image_t* _sg_image_at(uint32_t img_id) {
     SOKOL_ASSERT(SG_INVALID_ID != img_id);
     int slot_index = _sg_slot_index(img_id);
     SOKOL_ASSERT((slot_index > _SG_INVALID_SLOT_INDEX) && (slot_index < _sg.pools.image_pool.size));
-    return &_sg.pools.images[slot_index];
+    return _sg_image_at_index(slot_index);
 }
 
 _SOKOL_PRIVATE _sg_sampler_t* _sg_sampler_at(uint32_t smp_id) {
     SOKOL_ASSERT(SG_INVALID_ID != smp_id);
     int slot_index = _sg_slot_index(smp_id);
     SOKOL_ASSERT((slot_index > _SG_INVALID_SLOT_INDEX) && (slot_index < _sg.pools.sampler_pool.size));
-    return &_sg.pools.samplers[slot_index];
+    return _sg_sampler_at_index(slot_index);
 }
 
 _SOKOL_PRIVATE _sg_shader_t* _sg_shader_at(uint32_t shd_id) {
     SOKOL_ASSERT(SG_INVALID_ID != shd_id);
     int slot_index = _sg_slot_index(shd_id);
     SOKOL_ASSERT((slot_index > _SG_INVALID_SLOT_INDEX) && (slot_index < _sg.pools.shader_pool.size));
-    return &_sg.pools.shaders[slot_index];
+    return _sg_shader_at_index(slot_index);
 }
 
 _SOKOL_PRIVATE _sg_pipeline_t* _sg_pipeline_at(uint32_t pip_id) {
     SOKOL_ASSERT(SG_INVALID_ID != pip_id);
     int slot_index = _sg_slot_index(pip_id);
     SOKOL_ASSERT((slot_index > _SG_INVALID_SLOT_INDEX) && (slot_index < _sg.pools.pipeline_pool.size));
-    return &_sg.pools.pipelines[slot_index];
+    return _sg_pipeline_at_index(slot_index);
 }
 
 _SOKOL_PRIVATE _sg_view_t* _sg_view_at(uint32_t view_id) {
     SOKOL_ASSERT(SG_INVALID_ID != view_id);
     int slot_index = _sg_slot_index(view_id);
     SOKOL_ASSERT((slot_index > _SG_INVALID_SLOT_INDEX) && (slot_index < _sg.pools.view_pool.size));
-    return &_sg.pools.views[slot_index];
+    return _sg_view_at_index(slot_index);
 }
 
 // returns pointer to resource with matching id check, may return 0
@@ -7446,9 +8287,57 @@ _SOKOL_PRIVATE void _sg_update_frame_stats(void) {
     _sg_update_resource_stats(&_sg.stats.shaders, &_sg.pools.shader_pool);
     _sg_update_resource_stats(&_sg.stats.pipelines, &_sg.pools.pipeline_pool);
     _sg.prev_stats = _sg.stats;
+    if (_sg.stats_enabled && _sg.stats_history) {
+        _sg.stats_history[_sg.stats_history_count % SG_MAX_FRAME_STATS_HISTORY] = _sg.stats;
+        _sg.stats_history_count++;
+    }
     _sg_clear(&_sg.stats, sizeof(_sg.stats));
 }
 
+_SOKOL_PRIVATE void _sg_stats_begin_pass(void) {
+    _sg.stats_pass.pip_id = SG_INVALID_ID;
+    _sg.stats_pass.bindings_valid = false;
+    _sg.stats_pass.num_pipeline_switches = 0;
+    _sg.stats_pass.num_bindings_switches = 0;
+}
+
+_SOKOL_PRIVATE void _sg_stats_end_pass(void) {
+    _sg.stats.max_pipeline_switches_per_pass = _sg_max(_sg.stats.max_pipeline_switches_per_pass, _sg.stats_pass.num_pipeline_switches);
+    _sg.stats.max_bindings_switches_per_pass = _sg_max(_sg.stats.max_bindings_switches_per_pass, _sg.stats_pass.num_bindings_switches);
+}
+
+_SOKOL_PRIVATE void _sg_stats_apply_pipeline(sg_pipeline pip_id) {
+    if (pip_id.id != _sg.stats_pass.pip_id) {
+        _sg.stats_pass.pip_id = pip_id.id;
+        _sg.stats_pass.num_pipeline_switches++;
+        _sg.stats.num_pipeline_switches++;
+    }
+}
+
+_SOKOL_PRIVATE void _sg_stats_apply_bindings(const sg_bindings* bindings) {
+    if (!_sg.stats_pass.bindings_valid || (0 != memcmp(&_sg.stats_pass.bindings, bindings, sizeof(sg_bindings)))) {
+        _sg.stats_pass.bindings = *bindings;
+        _sg.stats_pass.bindings_valid = true;
+        _sg.stats_pass.num_bindings_switches++;
+        _sg.stats.num_bindings_switches++;
+    }
+}
+
+_SOKOL_PRIVATE void _sg_stats_draw(int num_elements, int num_instances) {
+    const _sg_pipeline_t* pip = _sg_pipeline_ref_ptr(&_sg.cur_pip);
+    uint64_t num_prims;
+    switch (pip->cmn.primitive_type) {
+        case SG_PRIMITIVETYPE_POINTS:           num_prims = (uint64_t)num_elements; break;
+        case SG_PRIMITIVETYPE_LINES:            num_prims = (uint64_t)(num_elements / 2); break;
+        case SG_PRIMITIVETYPE_LINE_STRIP:       num_prims = (uint64_t)_sg_max(num_elements - 1, 0); break;
+        case SG_PRIMITIVETYPE_TRIANGLE_STRIP:   num_prims = (uint64_t)_sg_max(num_elements - 2, 0); break;
+        default:                                num_prims = (uint64_t)(num_elements / 3); break;
+    }
+    _sg.stats.num_elements += (uint64_t)num_elements;
+    _sg.stats.num_instances += (uint64_t)num_instances;
+    _sg.stats.num_primitives += num_prims * (uint64_t)num_instances;
+}
+
 _SOKOL_PRIVATE uint32_t _sg_align_u32(uint32_t val, uint32_t align) {
     SOKOL_ASSERT((align > 0) && ((align & (align - 1)) == 0));
     return (val + (align - 1)) & ~(align - 1);
@@ -8112,6 +9001,164 @@ _SOKOL_PRIVATE bool _sg_multiple_u64(uint64_t val, uint64_t of) {
     return (val & (of-1)) == 0;
 }
 
+// MurmurHash64B (see: https://github.com/aappleby/smhasher/blob/61a0530f28277f2e850bfc39600ce61d02b518de/src/MurmurHash2.cpp#L142)
+_SOKOL_PRIVATE uint64_t _sg_hash(const void* key, int len, uint64_t seed) {
+    const uint32_t m = 0x5bd1e995;
+    const int r = 24;
+    uint32_t h1 = (uint32_t)seed ^ (uint32_t)len;
+    uint32_t h2 = (uint32_t)(seed >> 32);
+    // NOTE: key may be unaligned (e.g. shader source strings), so read through memcpy
+    const uint8_t* data = (const uint8_t*)key;
+    while (len >= 8) {
+        uint32_t k1; memcpy(&k1, data, 4); data += 4;
+        k1 *= m; k1 ^= k1 >> r; k1 *= m;
+        h1 *= m; h1 ^= k1;
+        len -= 4;
+        uint32_t k2; memcpy(&k2, data, 4); data += 4;
+        k2 *= m; k2 ^= k2 >> r; k2 *= m;
+        h2 *= m; h2 ^= k2;
+        len -= 4;
+    }
+    if (len >= 4) {
+        uint32_t k1; memcpy(&k1, data, 4); data += 4;
+        k1 *= m; k1 ^= k1 >> r; k1 *= m;
+        h1 *= m; h1 ^= k1;
+        len -= 4;
+    }
+    switch(len) {
+        case 3: h2 ^= (uint32_t)(data[2] << 16);
+        // fall through
+        case 2: h2 ^= (uint32_t)(data[1] << 8);
+        // fall through
+        case 1: h2 ^= data[0];
+        // fall through
+        h2 *= m;
+    };
+    h1 ^= h2 >> 18; h1 *= m;
+    h2 ^= h1 >> 22; h2 *= m;
+    h1 ^= h2 >> 17; h1 *= m;
+    h2 ^= h1 >> 19; h2 *= m;
+    uint64_t h = h1;
+    h = (h << 32) | h2;
+    return h;
+}
+
+// hash a single struct member or value, don't use on structs (padding bytes would be hashed)
+#define _SG_HASH_VALUE(h, val) h = _sg_hash(&(val), (int)sizeof(val), h)
+
+// hash over the pipeline state which is applied to the 3D API in sg_apply_pipeline(),
+// pipelines with different handles but the same state hash can skip redundant state
+// changes (after checking with _sg_pipeline_state_equal() that the state is identical)
+_SOKOL_PRIVATE uint64_t _sg_pipeline_state_hash(const _sg_pipeline_common_t* cmn) {
+    uint64_t h = 0;
+    _SG_HASH_VALUE(h, cmn->is_compute);
+    _SG_HASH_VALUE(h, cmn->depth.pixel_format);
+    _SG_HASH_VALUE(h, cmn->depth.compare);
+    _SG_HASH_VALUE(h, cmn->depth.write_enabled);
+    _SG_HASH_VALUE(h, cmn->depth.bias);
+    _SG_HASH_VALUE(h, cmn->depth.bias_slope_scale);
+    _SG_HASH_VALUE(h, cmn->depth.bias_clamp);
+    _SG_HASH_VALUE(h, cmn->stencil.enabled);
+    _SG_HASH_VALUE(h, cmn->stencil.front.compare);
+    _SG_HASH_VALUE(h, cmn->stencil.front.fail_op);
+    _SG_HASH_VALUE(h, cmn->stencil.front.depth_fail_op);
+    _SG_HASH_VALUE(h, cmn->stencil.front.pass_op);
+    _SG_HASH_VALUE(h, cmn->stencil.back.compare);
+    _SG_HASH_VALUE(h, cmn->stencil.back.fail_op);
+    _SG_HASH_VALUE(h, cmn->stencil.back.depth_fail_op);
+    _SG_HASH_VALUE(h, cmn->stencil.back.pass_op);
+    _SG_HASH_VALUE(h, cmn->stencil.read_mask);
+    _SG_HASH_VALUE(h, cmn->stencil.write_mask);
+    _SG_HASH_VALUE(h, cmn->stencil.ref);
+    _SG_HASH_VALUE(h, cmn->color_count);
+    for (int i = 0; i < cmn->color_count; i++) {
+        const sg_color_target_state* c = &cmn->colors[i];
+        _SG_HASH_VALUE(h, c->pixel_format);
+        _SG_HASH_VALUE(h, c->write_mask);
+        _SG_HASH_VALUE(h, c->blend.enabled);
+        _SG_HASH_VALUE(h, c->blend.src_factor_rgb);
+        _SG_HASH_VALUE(h, c->blend.dst_factor_rgb);
+        _SG_HASH_VALUE(h, c->blend.op_rgb);
+        _SG_HASH_VALUE(h, c->blend.src_factor_alpha);
+        _SG_HASH_VALUE(h, c->blend.dst_factor_alpha);
+        _SG_HASH_VALUE(h, c->blend.op_alpha);
+    }
+    _SG_HASH_VALUE(h, cmn->primitive_type);
+    _SG_HASH_VALUE(h, cmn->index_type);
+    _SG_HASH_VALUE(h, cmn->cull_mode);
+    _SG_HASH_VALUE(h, cmn->face_winding);
+    _SG_HASH_VALUE(h, cmn->sample_count);
+    _SG_HASH_VALUE(h, cmn->blend_color.r);
+    _SG_HASH_VALUE(h, cmn->blend_color.g);
+    _SG_HASH_VALUE(h, cmn->blend_color.b);
+    _SG_HASH_VALUE(h, cmn->blend_color.a);
+    _SG_HASH_VALUE(h, cmn->alpha_to_coverage_enabled);
+    return h;
+}
+
+_SOKOL_PRIVATE bool _sg_depth_state_equal(const sg_depth_state* a, const sg_depth_state* b) {
+    return (a->pixel_format == b->pixel_format) &&
+           (a->compare == b->compare) &&
+           (a->write_enabled == b->write_enabled) &&
+           (a->bias == b->bias) &&
+           (a->bias_slope_scale == b->bias_slope_scale) &&
+           (a->bias_clamp == b->bias_clamp);
+}
+
+_SOKOL_PRIVATE bool _sg_stencil_face_state_equal(const sg_stencil_face_state* a, const sg_stencil_face_state* b) {
+    return (a->compare == b->compare) &&
+           (a->fail_op == b->fail_op) &&
+           (a->depth_fail_op == b->depth_fail_op) &&
+           (a->pass_op == b->pass_op);
+}
+
+_SOKOL_PRIVATE bool _sg_stencil_state_equal(const sg_stencil_state* a, const sg_stencil_state* b) {
+    return (a->enabled == b->enabled) &&
+           _sg_stencil_face_state_equal(&a->front, &b->front) &&
+           _sg_stencil_face_state_equal(&a->back, &b->back) &&
+           (a->read_mask == b->read_mask) &&
+           (a->write_mask == b->write_mask) &&
+           (a->ref == b->ref);
+}
+
+_SOKOL_PRIVATE bool _sg_color_target_state_equal(const sg_color_target_state* a, const sg_color_target_state* b) {
+    return (a->pixel_format == b->pixel_format) &&
+           (a->write_mask == b->write_mask) &&
+           (a->blend.enabled == b->blend.enabled) &&
+           (a->blend.src_factor_rgb == b->blend.src_factor_rgb) &&
+           (a->blend.dst_factor_rgb == b->blend.dst_factor_rgb) &&
+           (a->blend.op_rgb == b->blend.op_rgb) &&
+           (a->blend.src_factor_alpha == b->blend.src_factor_alpha) &&
+           (a->blend.dst_factor_alpha == b->blend.dst_factor_alpha) &&
+           (a->blend.op_alpha == b->blend.op_alpha);
+}
+
+// member-wise compare of the state covered by _sg_pipeline_state_hash()
+_SOKOL_PRIVATE bool _sg_pipeline_state_equal(const _sg_pipeline_common_t* a, const _sg_pipeline_common_t* b) {
+    if ((a->is_compute != b->is_compute) ||
+        !_sg_depth_state_equal(&a->depth, &b->depth) ||
+        !_sg_stencil_state_equal(&a->stencil, &b->stencil) ||
+        (a->color_count != b->color_count))
+    {
+        return false;
+    }
+    for (int i = 0; i < a->color_count; i++) {
+        if (!_sg_color_target_state_equal(&a->colors[i], &b->colors[i])) {
+            return false;
+        }
+    }
+    return (a->primitive_type == b->primitive_type) &&
+           (a->index_type == b->index_type) &&
+           (a->cull_mode == b->cull_mode) &&
+           (a->face_winding == b->face_winding) &&
+           (a->sample_count == b->sample_count) &&
+           (a->blend_color.r == b->blend_color.r) &&
+           (a->blend_color.g == b->blend_color.g) &&
+           (a->blend_color.b == b->blend_color.b) &&
+           (a->blend_color.a == b->blend_color.a) &&
+           (a->alpha_to_coverage_enabled == b->alpha_to_coverage_enabled);
+}
+
 /* return row pitch for an image
 
     see ComputePitch in https://github.com/microsoft/DirectXTex/blob/master/DirectXTex/DirectXTexUtil.cpp
@@ -8322,9 +9369,46 @@ _SOKOL_PRIVATE sg_pass_action _sg_pass_action_defaults(const sg_pass_action* act
 // >>dummy backend
 #if defined(SOKOL_DUMMY_BACKEND)
 
+_SOKOL_PRIVATE uint32_t* _sg_dummy_record(sg_dummy_command cmd, int num_args) {
+    // returns a pointer to the argument words of the new command, or a null
+    // pointer if the command buffer is full (recording then stops for good
+    // so that the recorded commands remain a prefix of the backend calls)
+    SOKOL_ASSERT(_sg.dummy.recording);
+    SOKOL_ASSERT((num_args >= 0) && (num_args < 0x10000));
+    if (_sg.dummy.overflow) {
+        return 0;
+    }
+    if ((_sg.dummy.pos + 1 + num_args) > _sg.dummy.capacity) {
+        _sg.dummy.overflow = true;
+        _SG_WARN(DUMMY_COMMAND_BUFFER_FULL);
+        return 0;
+    }
+    uint32_t* ptr = &_sg.dummy.cmds[_sg.dummy.pos];
+    ptr[0] = (uint32_t)cmd | ((uint32_t)num_args << 16);
+    _sg.dummy.pos += 1 + num_args;
+    _sg.dummy.num_commands++;
+    _sg_stats_add(dummy.num_commands, 1);
+    _sg_stats_add(dummy.size_commands, (uint32_t)(1 + num_args) * sizeof(uint32_t));
+    return ptr + 1;
+}
+
+_SOKOL_PRIVATE void _sg_dummy_record_id(sg_dummy_command cmd, uint32_t id) {
+    uint32_t* args = _sg_dummy_record(cmd, 1);
+    if (args) {
+        args[0] = id;
+    }
+}
+
+_SOKOL_PRIVATE uint32_t _sg_dummy_hash(const sg_range* data, uint64_t seed) {
+    SOKOL_ASSERT(data);
+    if ((0 == data->ptr) || (0 == data->size)) {
+        return (uint32_t)seed;
+    }
+    return (uint32_t)_sg_hash(data->ptr, (int)data->size, seed);
+}
+
 _SOKOL_PRIVATE void _sg_dummy_setup_backend(const sg_desc* desc) {
     SOKOL_ASSERT(desc);
-    _SOKOL_UNUSED(desc);
     _sg.backend = SG_BACKEND_DUMMY;
     for (int i = SG_PIXELFORMAT_R8; i < SG_PIXELFORMAT_BC1_RGBA; i++) {
         _sg.formats[i].sample = true;
@@ -8345,175 +9429,411 @@ _SOKOL_PRIVATE void _sg_dummy_setup_backend(const sg_desc* desc) {
     _sg.limits.max_texture_bindings_per_stage = SG_MAX_PORTABLE_TEXTURE_BINDINGS_PER_STAGE;
     _sg.limits.max_storage_buffer_bindings_per_stage = SG_MAX_PORTABLE_STORAGEBUFFER_BINDINGS_PER_STAGE;
     _sg.limits.max_storage_image_bindings_per_stage = SG_MAX_PORTABLE_STORAGEIMAGE_BINDINGS_PER_STAGE;
+    if (desc->dummy_command_buffer_size > 0) {
+        _sg.dummy.recording = true;
+        _sg.dummy.capacity = desc->dummy_command_buffer_size / (int)sizeof(uint32_t);
+        SOKOL_ASSERT(_sg.dummy.capacity > 0);
+        _sg.dummy.cmds = (uint32_t*)_sg_malloc((size_t)_sg.dummy.capacity * sizeof(uint32_t));
+    }
 }
 
 _SOKOL_PRIVATE void _sg_dummy_discard_backend(void) {
-    // empty
+    if (_sg.dummy.cmds) {
+        _sg_free(_sg.dummy.cmds);
+        _sg.dummy.cmds = 0;
+    }
 }
 
 _SOKOL_PRIVATE void _sg_dummy_reset_state_cache(void) {
-    // empty
+    _sg_clear(&_sg.dummy.cache, sizeof(_sg.dummy.cache));
 }
 
 _SOKOL_PRIVATE sg_resource_state _sg_dummy_create_buffer(_sg_buffer_t* buf, const sg_buffer_desc* desc) {
     SOKOL_ASSERT(buf && desc);
-    _SOKOL_UNUSED(buf);
     _SOKOL_UNUSED(desc);
+    if (_sg.dummy.recording) {
+        uint32_t* args = _sg_dummy_record(SG_DUMMYCOMMAND_CREATE_BUFFER, 2);
+        if (args) {
+            args[0] = buf->slot.id;
+            args[1] = (uint32_t)buf->cmn.size;
+        }
+    }
     return SG_RESOURCESTATE_VALID;
 }
 
 _SOKOL_PRIVATE void _sg_dummy_discard_buffer(_sg_buffer_t* buf) {
     SOKOL_ASSERT(buf);
-    _SOKOL_UNUSED(buf);
+    if (_sg.dummy.recording) {
+        _sg_dummy_record_id(SG_DUMMYCOMMAND_DISCARD_BUFFER, buf->slot.id);
+    }
 }
 
 _SOKOL_PRIVATE sg_resource_state _sg_dummy_create_image(_sg_image_t* img, const sg_image_desc* desc) {
     SOKOL_ASSERT(img && desc);
-    _SOKOL_UNUSED(img);
     _SOKOL_UNUSED(desc);
+    if (_sg.dummy.recording) {
+        uint32_t* args = _sg_dummy_record(SG_DUMMYCOMMAND_CREATE_IMAGE, 8);
+        if (args) {
+            args[0] = img->slot.id;
+            args[1] = (uint32_t)img->cmn.type;
+            args[2] = (uint32_t)img->cmn.pixel_format;
+            args[3] = (uint32_t)img->cmn.width;
+            args[4] = (uint32_t)img->cmn.height;
+            args[5] = (uint32_t)img->cmn.num_slices;
+            args[6] = (uint32_t)img->cmn.num_mipmaps;
+            args[7] = (uint32_t)img->cmn.sample_count;
+        }
+    }
     return SG_RESOURCESTATE_VALID;
 }
 
 _SOKOL_PRIVATE void _sg_dummy_discard_image(_sg_image_t* img) {
     SOKOL_ASSERT(img);
-    _SOKOL_UNUSED(img);
+    if (_sg.dummy.recording) {
+        _sg_dummy_record_id(SG_DUMMYCOMMAND_DISCARD_IMAGE, img->slot.id);
+    }
 }
 
 _SOKOL_PRIVATE sg_resource_state _sg_dummy_create_sampler(_sg_sampler_t* smp, const sg_sampler_desc* desc) {
     SOKOL_ASSERT(smp && desc);
-    _SOKOL_UNUSED(smp);
     _SOKOL_UNUSED(desc);
+    if (_sg.dummy.recording) {
+        _sg_dummy_record_id(SG_DUMMYCOMMAND_CREATE_SAMPLER, smp->slot.id);
+    }
     return SG_RESOURCESTATE_VALID;
 }
 
 _SOKOL_PRIVATE void _sg_dummy_discard_sampler(_sg_sampler_t* smp) {
     SOKOL_ASSERT(smp);
-    _SOKOL_UNUSED(smp);
+    if (_sg.dummy.recording) {
+        _sg_dummy_record_id(SG_DUMMYCOMMAND_DISCARD_SAMPLER, smp->slot.id);
+    }
 }
 
 _SOKOL_PRIVATE sg_resource_state _sg_dummy_create_shader(_sg_shader_t* shd, const sg_shader_desc* desc) {
     SOKOL_ASSERT(shd && desc);
-    _SOKOL_UNUSED(shd);
     _SOKOL_UNUSED(desc);
+    if (_sg.dummy.recording) {
+        _sg_dummy_record_id(SG_DUMMYCOMMAND_CREATE_SHADER, shd->slot.id);
+    }
     return SG_RESOURCESTATE_VALID;
 }
 
 _SOKOL_PRIVATE void _sg_dummy_discard_shader(_sg_shader_t* shd) {
     SOKOL_ASSERT(shd);
-    _SOKOL_UNUSED(shd);
+    if (_sg.dummy.recording) {
+        _sg_dummy_record_id(SG_DUMMYCOMMAND_DISCARD_SHADER, shd->slot.id);
+    }
 }
 
 _SOKOL_PRIVATE sg_resource_state _sg_dummy_create_pipeline(_sg_pipeline_t* pip, const sg_pipeline_desc* desc) {
     SOKOL_ASSERT(pip && desc);
-    _SOKOL_UNUSED(pip);
     _SOKOL_UNUSED(desc);
+    if (_sg.dummy.recording) {
+        uint32_t* args = _sg_dummy_record(SG_DUMMYCOMMAND_CREATE_PIPELINE, 2);
+        if (args) {
+            args[0] = pip->slot.id;
+            args[1] = pip->cmn.shader.sref.id;
+        }
+    }
     return SG_RESOURCESTATE_VALID;
 }
 
 _SOKOL_PRIVATE void _sg_dummy_discard_pipeline(_sg_pipeline_t* pip) {
     SOKOL_ASSERT(pip);
-    _SOKOL_UNUSED(pip);
+    if (_sg.dummy.recording) {
+        _sg_dummy_record_id(SG_DUMMYCOMMAND_DISCARD_PIPELINE, pip->slot.id);
+    }
 }
 
 _SOKOL_PRIVATE sg_resource_state _sg_dummy_create_view(_sg_view_t* view, const sg_view_desc* desc) {
     SOKOL_ASSERT(view && desc);
-    _SOKOL_UNUSED(view);
     _SOKOL_UNUSED(desc);
+    if (_sg.dummy.recording) {
+        uint32_t* args = _sg_dummy_record(SG_DUMMYCOMMAND_CREATE_VIEW, 3);
+        if (args) {
+            args[0] = view->slot.id;
+            args[1] = (uint32_t)view->cmn.type;
+            if (view->cmn.type == SG_VIEWTYPE_STORAGEBUFFER) {
+                args[2] = view->cmn.buf.ref.sref.id;
+            } else {
+                args[2] = view->cmn.img.ref.sref.id;
+            }
+        }
+    }
     return SG_RESOURCESTATE_VALID;
 }
 
 _SOKOL_PRIVATE void _sg_dummy_discard_view(_sg_view_t* view) {
     SOKOL_ASSERT(view);
-    _SOKOL_UNUSED(view);
+    if (_sg.dummy.recording) {
+        _sg_dummy_record_id(SG_DUMMYCOMMAND_DISCARD_VIEW, view->slot.id);
+    }
 }
 
 _SOKOL_PRIVATE void _sg_dummy_begin_pass(const sg_pass* pass, const _sg_attachments_ptrs_t* atts) {
     SOKOL_ASSERT(pass && atts);
-    _SOKOL_UNUSED(pass);
-    _SOKOL_UNUSED(atts);
+    if (_sg.dummy.recording) {
+        _sg_clear(&_sg.dummy.cache, sizeof(_sg.dummy.cache));
+        const int num_color_views = atts->num_color_views;
+        uint32_t* args = _sg_dummy_record(SG_DUMMYCOMMAND_BEGIN_PASS, 5 + 2 * num_color_views);
+        if (args) {
+            args[0] = pass->compute ? 1 : 0;
+            args[1] = (uint32_t)_sg.cur_pass.dim.width;
+            args[2] = (uint32_t)_sg.cur_pass.dim.height;
+            args[3] = atts->ds_view ? atts->ds_view->slot.id : (uint32_t)SG_INVALID_ID;
+            args[4] = (uint32_t)num_color_views;
+            for (int i = 0; i < num_color_views; i++) {
+                args[5 + 2 * i] = atts->color_views[i] ? atts->color_views[i]->slot.id : (uint32_t)SG_INVALID_ID;
+                args[6 + 2 * i] = atts->resolve_views[i] ? atts->resolve_views[i]->slot.id : (uint32_t)SG_INVALID_ID;
+            }
+        }
+    }
 }
 
 _SOKOL_PRIVATE void _sg_dummy_end_pass(const _sg_attachments_ptrs_t* atts) {
     SOKOL_ASSERT(atts);
     _SOKOL_UNUSED(atts);
+    if (_sg.dummy.recording) {
+        _sg_dummy_record(SG_DUMMYCOMMAND_END_PASS, 0);
+    }
 }
 
 _SOKOL_PRIVATE void _sg_dummy_commit(void) {
-    // empty
+    if (_sg.dummy.recording) {
+        _sg_dummy_record(SG_DUMMYCOMMAND_COMMIT, 0);
+    }
+}
+
+_SOKOL_PRIVATE bool _sg_dummy_rect_redundant(bool* valid, int* cached, int x, int y, int w, int h, bool origin_top_left) {
+    const int rect[5] = { x, y, w, h, origin_top_left ? 1 : 0 };
+    const bool redundant = *valid && (0 == memcmp(cached, rect, sizeof(rect)));
+    *valid = true;
+    memcpy(cached, rect, sizeof(rect));
+    return redundant;
+}
+
+_SOKOL_PRIVATE void _sg_dummy_record_rect(sg_dummy_command cmd, int x, int y, int w, int h, bool origin_top_left) {
+    uint32_t* args = _sg_dummy_record(cmd, 5);
+    if (args) {
+        args[0] = (uint32_t)x;
+        args[1] = (uint32_t)y;
+        args[2] = (uint32_t)w;
+        args[3] = (uint32_t)h;
+        args[4] = origin_top_left ? 1 : 0;
+    }
 }
 
 _SOKOL_PRIVATE void _sg_dummy_apply_viewport(int x, int y, int w, int h, bool origin_top_left) {
-    _SOKOL_UNUSED(x);
-    _SOKOL_UNUSED(y);
-    _SOKOL_UNUSED(w);
-    _SOKOL_UNUSED(h);
-    _SOKOL_UNUSED(origin_top_left);
+    if (_sg.dummy.recording) {
+        if (_sg_dummy_rect_redundant(&_sg.dummy.cache.viewport_valid, _sg.dummy.cache.viewport, x, y, w, h, origin_top_left)) {
+            _sg_stats_add(dummy.num_redundant_viewport, 1);
+        }
+        _sg_dummy_record_rect(SG_DUMMYCOMMAND_APPLY_VIEWPORT, x, y, w, h, origin_top_left);
+    }
 }
 
 _SOKOL_PRIVATE void _sg_dummy_apply_scissor_rect(int x, int y, int w, int h, bool origin_top_left) {
-    _SOKOL_UNUSED(x);
-    _SOKOL_UNUSED(y);
-    _SOKOL_UNUSED(w);
-    _SOKOL_UNUSED(h);
-    _SOKOL_UNUSED(origin_top_left);
+    if (_sg.dummy.recording) {
+        if (_sg_dummy_rect_redundant(&_sg.dummy.cache.scissor_rect_valid, _sg.dummy.cache.scissor_rect, x, y, w, h, origin_top_left)) {
+            _sg_stats_add(dummy.num_redundant_scissor_rect, 1);
+        }
+        _sg_dummy_record_rect(SG_DUMMYCOMMAND_APPLY_SCISSOR_RECT, x, y, w, h, origin_top_left);
+    }
 }
 
 _SOKOL_PRIVATE void _sg_dummy_apply_pipeline(_sg_pipeline_t* pip) {
     SOKOL_ASSERT(pip);
-    _SOKOL_UNUSED(pip);
+    if (_sg.dummy.recording) {
+        if (_sg.dummy.cache.pip_id == pip->slot.id) {
+            _sg_stats_add(dummy.num_redundant_pipeline, 1);
+        } else {
+            // uniform data must be re-applied after a pipeline switch
+            _sg.dummy.cache.pip_id = pip->slot.id;
+            _sg_clear(_sg.dummy.cache.ub_valid, sizeof(_sg.dummy.cache.ub_valid));
+        }
+        _sg_dummy_record_id(SG_DUMMYCOMMAND_APPLY_PIPELINE, pip->slot.id);
+    }
 }
 
 _SOKOL_PRIVATE bool _sg_dummy_apply_bindings(_sg_bindings_ptrs_t* bnd) {
     SOKOL_ASSERT(bnd);
     SOKOL_ASSERT(bnd->pip);
-    _SOKOL_UNUSED(bnd);
+    if (!_sg.dummy.recording) {
+        return true;
+    }
+    _sg_dummy_state_cache_t* cache = &_sg.dummy.cache;
+    uint32_t vb_mask = 0;
+    uint32_t view_mask = 0;
+    uint32_t smp_mask = 0;
+    int num_args = 5;
+    for (int i = 0; i < SG_MAX_VERTEXBUFFER_BINDSLOTS; i++) {
+        if (bnd->vbs[i]) {
+            vb_mask |= 1u << i;
+            num_args += 2;
+            const uint32_t vb_id = bnd->vbs[i]->slot.id;
+            if ((cache->vb_ids[i] == vb_id) && (cache->vb_offsets[i] == bnd->vb_offsets[i])) {
+                _sg_stats_add(dummy.num_redundant_vertex_buffer, 1);
+            }
+            cache->vb_ids[i] = vb_id;
+            cache->vb_offsets[i] = bnd->vb_offsets[i];
+        }
+    }
+    if (bnd->ib) {
+        if ((cache->ib_id == bnd->ib->slot.id) && (cache->ib_offset == bnd->ib_offset)) {
+            _sg_stats_add(dummy.num_redundant_index_buffer, 1);
+        }
+        cache->ib_id = bnd->ib->slot.id;
+        cache->ib_offset = bnd->ib_offset;
+    }
+    for (int i = 0; i < SG_MAX_VIEW_BINDSLOTS; i++) {
+        if (bnd->views[i]) {
+            view_mask |= 1u << i;
+            num_args += 1;
+            if (cache->view_ids[i] == bnd->views[i]->slot.id) {
+                _sg_stats_add(dummy.num_redundant_view, 1);
+            }
+            cache->view_ids[i] = bnd->views[i]->slot.id;
+        }
+    }
+    for (int i = 0; i < SG_MAX_SAMPLER_BINDSLOTS; i++) {
+        if (bnd->smps[i]) {
+            smp_mask |= 1u << i;
+            num_args += 1;
+            if (cache->smp_ids[i] == bnd->smps[i]->slot.id) {
+                _sg_stats_add(dummy.num_redundant_sampler, 1);
+            }
+            cache->smp_ids[i] = bnd->smps[i]->slot.id;
+        }
+    }
+    uint32_t* args = _sg_dummy_record(SG_DUMMYCOMMAND_APPLY_BINDINGS, num_args);
+    if (args) {
+        int arg = 0;
+        args[arg++] = vb_mask;
+        args[arg++] = view_mask;
+        args[arg++] = smp_mask;
+        args[arg++] = bnd->ib ? bnd->ib->slot.id : (uint32_t)SG_INVALID_ID;
+        args[arg++] = bnd->ib ? (uint32_t)bnd->ib_offset : 0;
+        for (int i = 0; i < SG_MAX_VERTEXBUFFER_BINDSLOTS; i++) {
+            if (bnd->vbs[i]) {
+                args[arg++] = bnd->vbs[i]->slot.id;
+                args[arg++] = (uint32_t)bnd->vb_offsets[i];
+            }
+        }
+        for (int i = 0; i < SG_MAX_VIEW_BINDSLOTS; i++) {
+            if (bnd->views[i]) {
+                args[arg++] = bnd->views[i]->slot.id;
+            }
+        }
+        for (int i = 0; i < SG_MAX_SAMPLER_BINDSLOTS; i++) {
+            if (bnd->smps[i]) {
+                args[arg++] = bnd->smps[i]->slot.id;
+            }
+        }
+        SOKOL_ASSERT(arg == num_args);
+    }
     return true;
 }
 
 _SOKOL_PRIVATE void _sg_dummy_apply_uniforms(int ub_slot, const sg_range* data) {
-    _SOKOL_UNUSED(ub_slot);
-    _SOKOL_UNUSED(data);
+    SOKOL_ASSERT((ub_slot >= 0) && (ub_slot < SG_MAX_UNIFORMBLOCK_BINDSLOTS));
+    SOKOL_ASSERT(data);
+    if (_sg.dummy.recording) {
+        _sg_dummy_state_cache_t* cache = &_sg.dummy.cache;
+        const uint32_t size = (uint32_t)data->size;
+        const uint32_t hash = _sg_dummy_hash(data, 0);
+        if (cache->ub_valid[ub_slot] && (cache->ub_sizes[ub_slot] == size) && (cache->ub_hashes[ub_slot] == hash)) {
+            _sg_stats_add(dummy.num_redundant_uniforms, 1);
+        }
+        cache->ub_valid[ub_slot] = true;
+        cache->ub_sizes[ub_slot] = size;
+        cache->ub_hashes[ub_slot] = hash;
+        uint32_t* args = _sg_dummy_record(SG_DUMMYCOMMAND_APPLY_UNIFORMS, 3);
+        if (args) {
+            args[0] = (uint32_t)ub_slot;
+            args[1] = size;
+            args[2] = hash;
+        }
+    }
 }
 
 _SOKOL_PRIVATE void _sg_dummy_draw(int base_element, int num_elements, int num_instances, int base_vertex, int base_instance) {
-    _SOKOL_UNUSED(base_element);
-    _SOKOL_UNUSED(num_elements);
-    _SOKOL_UNUSED(num_instances);
-    _SOKOL_UNUSED(base_vertex);
-    _SOKOL_UNUSED(base_instance);
+    if (_sg.dummy.recording) {
+        uint32_t* args = _sg_dummy_record(SG_DUMMYCOMMAND_DRAW, 5);
+        if (args) {
+            args[0] = (uint32_t)base_element;
+            args[1] = (uint32_t)num_elements;
+            args[2] = (uint32_t)num_instances;
+            args[3] = (uint32_t)base_vertex;
+            args[4] = (uint32_t)base_instance;
+        }
+    }
 }
 
 _SOKOL_PRIVATE void _sg_dummy_dispatch(int num_groups_x, int num_groups_y, int num_groups_z) {
-    _SOKOL_UNUSED(num_groups_x);
-    _SOKOL_UNUSED(num_groups_y);
-    _SOKOL_UNUSED(num_groups_z);
+    if (_sg.dummy.recording) {
+        uint32_t* args = _sg_dummy_record(SG_DUMMYCOMMAND_DISPATCH, 3);
+        if (args) {
+            args[0] = (uint32_t)num_groups_x;
+            args[1] = (uint32_t)num_groups_y;
+            args[2] = (uint32_t)num_groups_z;
+        }
+    }
 }
 
 _SOKOL_PRIVATE void _sg_dummy_update_buffer(_sg_buffer_t* buf, const sg_range* data) {
     SOKOL_ASSERT(buf && data && data->ptr && (data->size > 0));
-    _SOKOL_UNUSED(data);
     if (++buf->cmn.active_slot >= buf->cmn.num_slots) {
         buf->cmn.active_slot = 0;
     }
+    if (_sg.dummy.recording) {
+        uint32_t* args = _sg_dummy_record(SG_DUMMYCOMMAND_UPDATE_BUFFER, 3);
+        if (args) {
+            args[0] = buf->slot.id;
+            args[1] = (uint32_t)data->size;
+            args[2] = _sg_dummy_hash(data, 0);
+        }
+    }
 }
 
 _SOKOL_PRIVATE bool _sg_dummy_append_buffer(_sg_buffer_t* buf, const sg_range* data, bool new_frame) {
     SOKOL_ASSERT(buf && data && data->ptr && (data->size > 0));
-    _SOKOL_UNUSED(data);
     if (new_frame) {
         if (++buf->cmn.active_slot >= buf->cmn.num_slots) {
             buf->cmn.active_slot = 0;
         }
     }
+    if (_sg.dummy.recording) {
+        uint32_t* args = _sg_dummy_record(SG_DUMMYCOMMAND_APPEND_BUFFER, 4);
+        if (args) {
+            args[0] = buf->slot.id;
+            args[1] = (uint32_t)data->size;
+            args[2] = _sg_dummy_hash(data, 0);
+            args[3] = new_frame ? 1 : 0;
+        }
+    }
     return true;
 }
 
 _SOKOL_PRIVATE void _sg_dummy_update_image(_sg_image_t* img, const sg_image_data* data) {
     SOKOL_ASSERT(img && data);
-    _SOKOL_UNUSED(data);
     if (++img->cmn.active_slot >= img->cmn.num_slots) {
         img->cmn.active_slot = 0;
     }
+    if (_sg.dummy.recording) {
+        uint32_t size = 0;
+        uint32_t hash = 0;
+        for (int mip_index = 0; mip_index < img->cmn.num_mipmaps; mip_index++) {
+            size += (uint32_t)data->mip_levels[mip_index].size;
+            hash = _sg_dummy_hash(&data->mip_levels[mip_index], hash);
+        }
+        uint32_t* args = _sg_dummy_record(SG_DUMMYCOMMAND_UPDATE_IMAGE, 3);
+        if (args) {
+            args[0] = img->slot.id;
+            args[1] = size;
+            args[2] = hash;
+        }
+    }
 }
 
 //  ██████  ██████  ███████ ███    ██  ██████  ██          ██████   █████   ██████ ██   ██ ███████ ███    ██ ██████
@@ -8656,7 +9976,17 @@ _SOKOL_PRIVATE void _sg_dummy_update_image(_sg_image_t* img, const sg_image_data
     _SG_XMACRO(glDrawElementsBaseVertex,          void, (GLenum mode, GLsizei count, GLenum type, const void* indices, GLint basevertex)) \
     _SG_XMACRO(glDrawElementsInstancedBaseVertex, void, (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount, GLint basevertex)) \
     _SG_XMACRO(glDrawElementsInstancedBaseVertexBaseInstance, void, (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance)) \
-    _SG_XMACRO(glDrawArraysInstancedBaseInstance, void, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance))
+    _SG_XMACRO(glDrawArraysInstancedBaseInstance, void, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance)) \
+    _SG_XMACRO(glProgramParameteri,               void, (GLuint program, GLenum pname, GLint value)) \
+    _SG_XMACRO(glGetProgramBinary,                void, (GLuint program, GLsizei bufSize, GLsizei* length, GLenum* binaryFormat, void* binary)) \
+    _SG_XMACRO(glProgramBinary,                   void, (GLuint program, GLenum binaryFormat, const void* binary, GLsizei length)) \
+    _SG_XMACRO(glFenceSync,                       GLsync, (GLenum condition, GLbitfield flags)) \
+    _SG_XMACRO(glWaitSync,                        void, (GLsync sync, GLbitfield flags, GLuint64 timeout)) \
+    _SG_XMACRO(glDeleteSync,                      void, (GLsync sync)) \
+    _SG_XMACRO(glClientWaitSync,                  GLenum, (GLsync sync, GLbitfield flags, GLuint64 timeout)) \
+    _SG_XMACRO(glReadPixels,                      void, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void* data)) \
+    _SG_XMACRO(glMapBufferRange,                  void*, (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)) \
+    _SG_XMACRO(glUnmapBuffer,                     GLboolean, (GLenum target))
 
 // generate GL function pointer typedefs
 #define _SG_XMACRO(name, ret, args) typedef ret (GL_APIENTRY* PFN_ ## name) args;
@@ -9494,6 +10824,8 @@ _SOKOL_PRIVATE void _sg_gl_init_caps_glcore(void) {
                 has_etc2 = true;
             } else if (strstr(ext, "_texture_filter_anisotropic")) {
                 _sg.gl.ext_anisotropic = true;
+            } else if (strstr(ext, "_parallel_shader_compile")) {
+                _sg.gl.ext_parallel_shader_compile = true;
             } else if (strstr(ext, "_texture_compression_astc_ldr")) {
                 has_astc = true;
             }
@@ -9597,6 +10929,8 @@ _SOKOL_PRIVATE void _sg_gl_init_caps_gles3(void) {
                 has_float_blend = true;
             } else if (strstr(ext, "_texture_filter_anisotropic")) {
                 _sg.gl.ext_anisotropic = true;
+            } else if (strstr(ext, "_parallel_shader_compile")) {
+                _sg.gl.ext_parallel_shader_compile = true;
             }
         }
     }
@@ -10000,6 +11334,44 @@ _SOKOL_PRIVATE void _sg_gl_reset_state_cache(void) {
     #endif
 }
 
+#if defined(_SOKOL_GL_HAS_PROGRAM_BINARY)
+_SOKOL_PRIVATE void _sg_gl_setup_program_cache(const sg_desc* desc) {
+    SOKOL_ASSERT(!_sg.gl.program_cache.enabled);
+    if (0 == desc->gl_program_cache_dir) {
+        return;
+    }
+    GLint num_formats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &num_formats);
+    _SG_GL_CHECK_ERROR();
+    if (num_formats <= 0) {
+        _SG_WARN(GL_PROGRAM_BINARY_NOT_SUPPORTED);
+        return;
+    }
+    // program binaries are only valid for the exact same driver version
+    uint64_t hash = 0;
+    const GLenum names[3] = { GL_VENDOR, GL_RENDERER, GL_VERSION };
+    for (size_t i = 0; i < 3; i++) {
+        const char* str = (const char*) glGetString(names[i]);
+        if (str) {
+            hash = _sg_hash(str, (int)strlen(str), hash);
+        }
+    }
+    const size_t dir_len = strlen(desc->gl_program_cache_dir);
+    _sg.gl.program_cache.dir = (char*) _sg_malloc(dir_len + 1);
+    memcpy(_sg.gl.program_cache.dir, desc->gl_program_cache_dir, dir_len + 1);
+    _sg.gl.program_cache.driver_hash = hash;
+    _sg.gl.program_cache.enabled = true;
+}
+
+_SOKOL_PRIVATE void _sg_gl_discard_program_cache(void) {
+    if (_sg.gl.program_cache.dir) {
+        _sg_free(_sg.gl.program_cache.dir);
+        _sg.gl.program_cache.dir = 0;
+    }
+    _sg.gl.program_cache.enabled = false;
+}
+#endif
+
 _SOKOL_PRIVATE void _sg_gl_setup_backend(const sg_desc* desc) {
     _SOKOL_UNUSED(desc);
 
@@ -10035,6 +11407,9 @@ _SOKOL_PRIVATE void _sg_gl_setup_backend(const sg_desc* desc) {
         // enable seamless cubemap sampling (only desktop GL)
         glEnable(GL_TEXTURE_CUBE_MAP_SEAMLESS);
     #endif
+    #if defined(_SOKOL_GL_HAS_PROGRAM_BINARY)
+        _sg_gl_setup_program_cache(desc);
+    #endif
     _sg_gl_reset_state_cache();
 }
 
@@ -10046,6 +11421,9 @@ _SOKOL_PRIVATE void _sg_gl_discard_backend(void) {
     if (_sg.gl.vao) {
         glDeleteVertexArrays(1, &_sg.gl.vao);
     }
+    #if defined(_SOKOL_GL_HAS_PROGRAM_BINARY)
+    _sg_gl_discard_program_cache();
+    #endif
     #if defined(_SOKOL_USE_WIN32_GL_LOADER)
     _sg_gl_unload_opengl();
     #endif
@@ -10053,15 +11431,41 @@ _SOKOL_PRIVATE void _sg_gl_discard_backend(void) {
 }
 
 //-- GL backend resource creation and destruction ------------------------------
+// let the GPU wait (without blocking the CPU) until a background upload has finished
+_SOKOL_PRIVATE void _sg_gl_wait_upload_sync(const void* sync) {
+    SOKOL_ASSERT(sync);
+    glWaitSync((GLsync)sync, 0, GL_TIMEOUT_IGNORED);
+    glDeleteSync((GLsync)sync);
+}
+
+// delete the GL objects from sg_gl_upload_buffer() or sg_gl_upload_image() when
+// the sokol-gfx resource couldn't be created (otherwise they are owned by the resource)
+_SOKOL_PRIVATE void _sg_gl_discard_upload(const void* sync, GLuint gl_buf, GLuint gl_tex) {
+    SOKOL_ASSERT(sync);
+    _SG_GL_CHECK_ERROR();
+    _sg_gl_wait_upload_sync(sync);
+    if (gl_buf) {
+        glDeleteBuffers(1, &gl_buf);
+    }
+    if (gl_tex) {
+        glDeleteTextures(1, &gl_tex);
+    }
+    _SG_GL_CHECK_ERROR();
+}
+
 _SOKOL_PRIVATE sg_resource_state _sg_gl_create_buffer(_sg_buffer_t* buf, const sg_buffer_desc* desc) {
     SOKOL_ASSERT(buf && desc);
     _SG_GL_CHECK_ERROR();
-    buf->gl.injected = (0 != desc->gl_buffers[0]);
+    // NOTE: buffers from sg_gl_upload_buffer() are owned by sokol-gfx
+    buf->gl.injected = (0 != desc->gl_buffers[0]) && (0 == desc->gl_sync);
+    if (desc->gl_sync) {
+        _sg_gl_wait_upload_sync(desc->gl_sync);
+    }
     const GLenum gl_target = _sg_gl_buffer_target(&buf->cmn.usage);
     const GLenum gl_usage  = _sg_gl_buffer_usage(&buf->cmn.usage);
     for (int slot = 0; slot < buf->cmn.num_slots; slot++) {
         GLuint gl_buf = 0;
-        if (buf->gl.injected) {
+        if (0 != desc->gl_buffers[0]) {
             SOKOL_ASSERT(desc->gl_buffers[slot]);
             gl_buf = desc->gl_buffers[slot];
         } else {
@@ -10217,10 +11621,38 @@ _SOKOL_PRIVATE void _sg_gl_teximage(const _sg_image_t* img, GLenum tgt, int mip_
     _SG_GL_CHECK_ERROR();
 }
 
+// upload all mip levels into the currently bound texture
+_SOKOL_PRIVATE void _sg_gl_teximage_mips(const _sg_image_t* img, const sg_image_data* data) {
+    for (int mip_index = 0; mip_index < img->cmn.num_mipmaps; mip_index++) {
+        const GLvoid* data_ptr = data->mip_levels[mip_index].ptr;
+        const GLsizei data_size = (GLsizei)data->mip_levels[mip_index].size;
+        const int mip_width = _sg_miplevel_dim(img->cmn.width, mip_index);
+        const int mip_height = _sg_miplevel_dim(img->cmn.height, mip_index);
+        const int mip_depth = (SG_IMAGETYPE_3D == img->cmn.type) ? _sg_miplevel_dim(img->cmn.num_slices, mip_index) : img->cmn.num_slices;
+        if (SG_IMAGETYPE_CUBE == img->cmn.type) {
+            const int surf_pitch = _sg_surface_pitch(img->cmn.pixel_format, mip_width, mip_height, 1);
+            // NOTE: surf_ptr is allowed to be null here
+            const uint8_t* surf_ptr = (const uint8_t*) data_ptr;
+            for (int i = 0; i < 6; i++) {
+                const GLenum gl_img_target = _sg_gl_cubeface_target(i);
+                _sg_gl_teximage(img, gl_img_target, mip_index, mip_width, mip_height, mip_depth, surf_ptr, surf_pitch);
+                if (data_ptr) {
+                    SOKOL_ASSERT((6 * surf_pitch) <= data_size);
+                    surf_ptr += surf_pitch;
+                }
+            }
+        } else {
+            _sg_gl_teximage(img, img->gl.target, mip_index, mip_width, mip_height, mip_depth, data_ptr, data_size);
+        }
+    }
+}
+
 _SOKOL_PRIVATE sg_resource_state _sg_gl_create_image(_sg_image_t* img, const sg_image_desc* desc) {
     SOKOL_ASSERT(img && desc);
     _SG_GL_CHECK_ERROR();
-    img->gl.injected = (0 != desc->gl_textures[0]);
+    // NOTE: textures from sg_gl_upload_image() are owned by sokol-gfx
+    img->gl.injected = (0 != desc->gl_textures[0]) && (0 == desc->gl_sync);
+    const bool has_gl_textures = (0 != desc->gl_textures[0]);
 
     // check if texture format is support
     if (!_sg_gl_supported_texture_format(img->cmn.pixel_format)) {
@@ -10228,7 +11660,10 @@ _SOKOL_PRIVATE sg_resource_state _sg_gl_create_image(_sg_image_t* img, const sg_
         return SG_RESOURCESTATE_FAILED;
     }
 
-    if (img->gl.injected) {
+    if (has_gl_textures) {
+        if (desc->gl_sync) {
+            _sg_gl_wait_upload_sync(desc->gl_sync);
+        }
         img->gl.target = _sg_gl_texture_target(img->cmn.type, img->cmn.sample_count);
         // inject externally GL textures
         for (int slot = 0; slot < img->cmn.num_slots; slot++) {
@@ -10256,28 +11691,7 @@ _SOKOL_PRIVATE sg_resource_state _sg_gl_create_image(_sg_image_t* img, const sg_
             _sg_gl_cache_store_texture_sampler_binding(0);
             _sg_gl_cache_bind_texture_sampler(0, img->gl.target, img->gl.tex[slot], 0);
             _sg_gl_texstorage(img);
-            for (int mip_index = 0; mip_index < img->cmn.num_mipmaps; mip_index++) {
-                const GLvoid* data_ptr = desc->data.mip_levels[mip_index].ptr;
-                const GLsizei data_size = (GLsizei)desc->data.mip_levels[mip_index].size;
-                const int mip_width = _sg_miplevel_dim(img->cmn.width, mip_index);
-                const int mip_height = _sg_miplevel_dim(img->cmn.height, mip_index);
-                const int mip_depth = (SG_IMAGETYPE_3D == img->cmn.type) ? _sg_miplevel_dim(img->cmn.num_slices, mip_index) : img->cmn.num_slices;
-                if (SG_IMAGETYPE_CUBE == img->cmn.type) {
-                    const int surf_pitch = _sg_surface_pitch(img->cmn.pixel_format, mip_width, mip_height, 1);
-                    // NOTE: surf_ptr is allowed to be null here
-                    const uint8_t* surf_ptr = (const uint8_t*) data_ptr;
-                    for (int i = 0; i < 6; i++) {
-                        const GLenum gl_img_target = _sg_gl_cubeface_target(i);
-                        _sg_gl_teximage(img, gl_img_target, mip_index, mip_width, mip_height, mip_depth, surf_ptr, surf_pitch);
-                        if (data_ptr) {
-                            SOKOL_ASSERT((6 * surf_pitch) <= data_size);
-                            surf_ptr += surf_pitch;
-                        }
-                    }
-                } else {
-                    _sg_gl_teximage(img, img->gl.target, mip_index, mip_width, mip_height, mip_depth, data_ptr, data_size);
-                }
-            }
+            _sg_gl_teximage_mips(img, &desc->data);
             _sg_gl_cache_restore_texture_sampler_binding(0);
         }
     }
@@ -10364,16 +11778,24 @@ _SOKOL_PRIVATE void _sg_gl_discard_sampler(_sg_sampler_t* smp) {
     _SG_GL_CHECK_ERROR();
 }
 
+// NOTE: this only kicks off compilation, the compile status is checked
+// later in _sg_gl_shader_compile_ok() to not stall on the GLSL compiler
 _SOKOL_PRIVATE GLuint _sg_gl_compile_shader(sg_shader_stage stage, const char* src) {
     SOKOL_ASSERT(src);
     _SG_GL_CHECK_ERROR();
     GLuint gl_shd = glCreateShader(_sg_gl_shader_stage(stage));
     glShaderSource(gl_shd, 1, &src, 0);
     glCompileShader(gl_shd);
+    _SG_GL_CHECK_ERROR();
+    return gl_shd;
+}
+
+_SOKOL_PRIVATE bool _sg_gl_shader_compile_ok(GLuint gl_shd) {
+    SOKOL_ASSERT(gl_shd);
     GLint compile_status = 0;
     glGetShaderiv(gl_shd, GL_COMPILE_STATUS, &compile_status);
     if (!compile_status) {
-        // compilation failed, log error and delete shader
+        // compilation failed, log error
         GLint log_len = 0;
         glGetShaderiv(gl_shd, GL_INFO_LOG_LENGTH, &log_len);
         if (log_len > 0) {
@@ -10383,11 +11805,8 @@ _SOKOL_PRIVATE GLuint _sg_gl_compile_shader(sg_shader_stage stage, const char* s
             _SG_LOGMSG(GL_SHADER_COMPILATION_FAILED, log_buf);
             _sg_free(log_buf);
         }
-        glDeleteShader(gl_shd);
-        gl_shd = 0;
     }
-    _SG_GL_CHECK_ERROR();
-    return gl_shd;
+    return 0 != compile_status;
 }
 
 // NOTE: this is an out-of-range check for GLSL bindslots that's also active in release mode
@@ -10415,7 +11834,160 @@ _SOKOL_PRIVATE bool _sg_gl_ensure_glsl_bindslot_ranges(const sg_shader_desc* des
     return true;
 }
 
-_SOKOL_PRIVATE sg_resource_state _sg_gl_create_shader(_sg_shader_t* shd, const sg_shader_desc* desc) {
+#if defined(_SOKOL_GL_HAS_PROGRAM_BINARY)
+#define _SG_GL_PROGRAM_CACHE_MAGIC (0x42504753)  // 'SGPB'
+#define _SG_GL_PROGRAM_CACHE_VERSION (1)
+#define _SG_GL_PROGRAM_CACHE_MAX_SIZE (64 * 1024 * 1024)  // larger program binaries are treated as corrupt
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t key;
+    uint32_t format;
+    uint32_t size;
+} _sg_gl_program_cache_header_t;
+
+_SOKOL_PRIVATE uint64_t _sg_gl_program_cache_key(const sg_shader_desc* desc) {
+    const char* srcs[3] = { desc->vertex_func.source, desc->fragment_func.source, desc->compute_func.source };
+    uint64_t hash = _sg.gl.program_cache.driver_hash;
+    for (size_t i = 0; i < 3; i++) {
+        const char* src = srcs[i] ? srcs[i] : "";
+        hash = _sg_hash(src, (int)strlen(src), hash);
+    }
+    return hash;
+}
+
+// returns an allocated string which must be freed with _sg_free()
+_SOKOL_PRIVATE char* _sg_gl_program_cache_path(uint64_t key, const char* ext) {
+    SOKOL_ASSERT(_sg.gl.program_cache.dir);
+    const size_t size = strlen(_sg.gl.program_cache.dir) + 32;
+    char* path = (char*) _sg_malloc(size);
+    snprintf(path, size, "%s/%016llx.%s", _sg.gl.program_cache.dir, (unsigned long long)key, ext);
+    return path;
+}
+
+// try to restore a linked program from the cache, returns false on cache miss
+_SOKOL_PRIVATE bool _sg_gl_program_cache_load(GLuint gl_prog, uint64_t key) {
+    char* path = _sg_gl_program_cache_path(key, "sgpb");
+    FILE* fp = fopen(path, "rb");
+    _sg_free(path);
+    if (0 == fp) {
+        return false;
+    }
+    bool linked = false;
+    long file_size = -1;
+    if (0 == fseek(fp, 0, SEEK_END)) {
+        file_size = ftell(fp);
+    }
+    _sg_gl_program_cache_header_t hdr;
+    // a truncated or corrupt file is a cache miss
+    if ((0 == fseek(fp, 0, SEEK_SET))
+        && (1 == fread(&hdr, sizeof(hdr), 1, fp))
+        && (hdr.magic == _SG_GL_PROGRAM_CACHE_MAGIC)
+        && (hdr.version == _SG_GL_PROGRAM_CACHE_VERSION)
+        && (hdr.key == key)
+        && (hdr.size > 0)
+        && (hdr.size <= _SG_GL_PROGRAM_CACHE_MAX_SIZE)
+        && (file_size == (long)(sizeof(hdr) + hdr.size)))
+    {
+        void* bin = _sg_malloc(hdr.size);
+        if (1 == fread(bin, hdr.size, 1, fp)) {
+            glProgramBinary(gl_prog, (GLenum)hdr.format, bin, (GLsizei)hdr.size);
+            GLint link_status = 0;
+            glGetProgramiv(gl_prog, GL_LINK_STATUS, &link_status);
+            linked = (0 != link_status);
+            if (!linked) {
+                // a rejected binary may leave an error behind, the
+                // program will be rebuilt from source
+                glGetError();
+            }
+        }
+        _sg_free(bin);
+    }
+    fclose(fp);
+    return linked;
+}
+
+// create a temp file with a name which is unique across processes and threads
+// (the process id and an address on the calling thread's stack), returns an
+// allocated path which must be freed with _sg_free(), or null
+_SOKOL_PRIVATE char* _sg_gl_program_cache_open_temp(uint64_t key, FILE** out_fp) {
+    SOKOL_ASSERT(_sg.gl.program_cache.dir);
+    *out_fp = 0;
+    #if defined(_WIN32)
+        const unsigned long pid = (unsigned long)GetCurrentProcessId();
+    #else
+        const unsigned long pid = (unsigned long)getpid();
+    #endif
+    const unsigned long long tid = (unsigned long long)(uintptr_t)out_fp;
+    const size_t size = strlen(_sg.gl.program_cache.dir) + 80;
+    char* path = (char*) _sg_malloc(size);
+    snprintf(path, size, "%s/%016llx.%lu.%llx.tmp", _sg.gl.program_cache.dir, (unsigned long long)key, pid, tid);
+    // 'x' fails if the file exists (for instance left behind by a crashed process)
+    *out_fp = fopen(path, "wbx");
+    if (0 == *out_fp) {
+        _sg_free(path);
+        return 0;
+    }
+    return path;
+}
+
+// atomically replace the cache file, readers see either the old or the new file
+_SOKOL_PRIVATE bool _sg_gl_program_cache_replace(const char* tmp_path, const char* path) {
+    #if defined(_WIN32)
+        return 0 != MoveFileExA(tmp_path, path, MOVEFILE_REPLACE_EXISTING);
+    #else
+        return 0 == rename(tmp_path, path);
+    #endif
+}
+
+_SOKOL_PRIVATE void _sg_gl_program_cache_store(GLuint gl_prog, uint64_t key) {
+    GLint bin_size = 0;
+    glGetProgramiv(gl_prog, GL_PROGRAM_BINARY_LENGTH, &bin_size);
+    if ((bin_size <= 0) || (bin_size > _SG_GL_PROGRAM_CACHE_MAX_SIZE)) {
+        return;
+    }
+    void* bin = _sg_malloc((size_t)bin_size);
+    GLsizei written = 0;
+    GLenum format = 0;
+    glGetProgramBinary(gl_prog, bin_size, &written, &format, bin);
+    _SG_GL_CHECK_ERROR();
+    bool ok = false;
+    if (written > 0) {
+        _sg_gl_program_cache_header_t hdr;
+        _sg_clear(&hdr, sizeof(hdr));
+        hdr.magic = _SG_GL_PROGRAM_CACHE_MAGIC;
+        hdr.version = _SG_GL_PROGRAM_CACHE_VERSION;
+        hdr.key = key;
+        hdr.format = (uint32_t)format;
+        hdr.size = (uint32_t)written;
+        // write to a temp file with a unique name first and rename, so that
+        // concurrent writers (other processes, or other threads with their
+        // own sokol-gfx instance) never see a partially written file
+        FILE* fp = 0;
+        char* tmp_path = _sg_gl_program_cache_open_temp(key, &fp);
+        if (tmp_path) {
+            char* path = _sg_gl_program_cache_path(key, "sgpb");
+            ok = (1 == fwrite(&hdr, sizeof(hdr), 1, fp)) && (1 == fwrite(bin, (size_t)written, 1, fp));
+            ok &= (0 == fclose(fp));
+            ok = ok && _sg_gl_program_cache_replace(tmp_path, path);
+            if (!ok) {
+                remove(tmp_path);
+            }
+            _sg_free(path);
+            _sg_free(tmp_path);
+        }
+    }
+    _sg_free(bin);
+    if (!ok) {
+        _SG_WARN(GL_PROGRAM_CACHE_STORE_FAILED);
+    }
+}
+#endif
+
+// kick off shader compilation and program linking without waiting for the result,
+// returns false if the shader creation failed early
+_SOKOL_PRIVATE bool _sg_gl_begin_create_shader(_sg_shader_t* shd, const sg_shader_desc* desc) {
     SOKOL_ASSERT(shd && desc);
     SOKOL_ASSERT(!shd->gl.prog);
     _SG_GL_CHECK_ERROR();
@@ -10423,7 +11995,7 @@ _SOKOL_PRIVATE sg_resource_state _sg_gl_create_shader(_sg_shader_t* shd, const s
     // perform a fatal range-check on GLSL bindslots that's also active
     // in release mode to avoid potential out-of-bounds array accesses
     if (!_sg_gl_ensure_glsl_bindslot_ranges(desc)) {
-        return SG_RESOURCESTATE_FAILED;
+        return false;
     }
 
     // copy the optional vertex attribute names over
@@ -10436,34 +12008,89 @@ _SOKOL_PRIVATE sg_resource_state _sg_gl_create_shader(_sg_shader_t* shd, const s
     const bool has_cs = desc->compute_func.source;
     SOKOL_ASSERT((has_vs && has_fs) || has_cs);
     GLuint gl_prog = glCreateProgram();
-    if (has_vs && has_fs) {
-        GLuint gl_vs = _sg_gl_compile_shader(SG_SHADERSTAGE_VERTEX, desc->vertex_func.source);
-        GLuint gl_fs = _sg_gl_compile_shader(SG_SHADERSTAGE_FRAGMENT, desc->fragment_func.source);
-        if (!(gl_vs && gl_fs)) {
-            glDeleteProgram(gl_prog);
-            if (gl_vs) { glDeleteShader(gl_vs); }
-            if (gl_fs) { glDeleteShader(gl_fs); }
-            return SG_RESOURCESTATE_FAILED;
+    #if defined(_SOKOL_GL_HAS_PROGRAM_BINARY)
+    if (_sg.gl.program_cache.enabled) {
+        shd->gl.build.cache_key = _sg_gl_program_cache_key(desc);
+        shd->gl.build.from_cache = _sg_gl_program_cache_load(gl_prog, shd->gl.build.cache_key);
+        if (!shd->gl.build.from_cache) {
+            glProgramParameteri(gl_prog, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
         }
-        glAttachShader(gl_prog, gl_vs);
-        glAttachShader(gl_prog, gl_fs);
+    }
+    #endif
+    if (shd->gl.build.from_cache) {
+        // program was restored from the program binary cache, skip compile and link
+    } else if (has_vs && has_fs) {
+        shd->gl.build.shaders[0] = _sg_gl_compile_shader(SG_SHADERSTAGE_VERTEX, desc->vertex_func.source);
+        shd->gl.build.shaders[1] = _sg_gl_compile_shader(SG_SHADERSTAGE_FRAGMENT, desc->fragment_func.source);
+        glAttachShader(gl_prog, shd->gl.build.shaders[0]);
+        glAttachShader(gl_prog, shd->gl.build.shaders[1]);
         glLinkProgram(gl_prog);
-        glDeleteShader(gl_vs);
-        glDeleteShader(gl_fs);
         _SG_GL_CHECK_ERROR();
     } else if (has_cs) {
-        GLuint gl_cs = _sg_gl_compile_shader(SG_SHADERSTAGE_COMPUTE, desc->compute_func.source);
-        if (!gl_cs) {
-            glDeleteProgram(gl_prog);
-            return SG_RESOURCESTATE_FAILED;
-        }
-        glAttachShader(gl_prog, gl_cs);
+        shd->gl.build.shaders[0] = _sg_gl_compile_shader(SG_SHADERSTAGE_COMPUTE, desc->compute_func.source);
+        glAttachShader(gl_prog, shd->gl.build.shaders[0]);
         glLinkProgram(gl_prog);
-        glDeleteShader(gl_cs);
         _SG_GL_CHECK_ERROR();
     } else {
         SOKOL_UNREACHABLE;
     }
+    shd->gl.prog = gl_prog;
+    return true;
+}
+
+// returns true when the program object started in _sg_gl_begin_create_shader()
+// can be finished, without GL_KHR_parallel_shader_compile finishing a shader
+// blocks until compilation is done, so allow only one of those per frame
+_SOKOL_PRIVATE bool _sg_gl_shader_build_done(const _sg_shader_t* shd) {
+    SOKOL_ASSERT(shd && shd->gl.prog);
+    if (!_sg.gl.ext_parallel_shader_compile) {
+        if (_sg.gl.sync_build_frame_index == _sg.frame_index) {
+            return false;
+        }
+        _sg.gl.sync_build_frame_index = _sg.frame_index;
+        return true;
+    }
+    GLint done = GL_FALSE;
+    glGetProgramiv(shd->gl.prog, GL_COMPLETION_STATUS_KHR, &done);
+    return GL_FALSE != done;
+}
+
+_SOKOL_PRIVATE void _sg_gl_discard_shader_build_objects(_sg_shader_t* shd) {
+    for (size_t i = 0; i < 2; i++) {
+        if (shd->gl.build.shaders[i]) {
+            glDeleteShader(shd->gl.build.shaders[i]);
+            shd->gl.build.shaders[i] = 0;
+        }
+    }
+}
+
+// abandon an in-flight shader build (e.g. a pending shader is destroyed)
+_SOKOL_PRIVATE void _sg_gl_cancel_create_shader(_sg_shader_t* shd) {
+    SOKOL_ASSERT(shd);
+    _sg_gl_discard_shader_build_objects(shd);
+    if (shd->gl.prog) {
+        glDeleteProgram(shd->gl.prog);
+        shd->gl.prog = 0;
+    }
+    _SG_GL_CHECK_ERROR();
+}
+
+// check compile and link status, and resolve uniform and resource bindings
+_SOKOL_PRIVATE sg_resource_state _sg_gl_finish_create_shader(_sg_shader_t* shd, const sg_shader_desc* desc) {
+    SOKOL_ASSERT(shd && desc);
+    SOKOL_ASSERT(shd->gl.prog);
+    const GLuint gl_prog = shd->gl.prog;
+    bool compile_ok = true;
+    for (size_t i = 0; i < 2; i++) {
+        if (shd->gl.build.shaders[i]) {
+            compile_ok &= _sg_gl_shader_compile_ok(shd->gl.build.shaders[i]);
+        }
+    }
+    _sg_gl_discard_shader_build_objects(shd);
+    if (!compile_ok) {
+        _sg_gl_cancel_create_shader(shd);
+        return SG_RESOURCESTATE_FAILED;
+    }
     GLint link_status;
     glGetProgramiv(gl_prog, GL_LINK_STATUS, &link_status);
     if (!link_status) {
@@ -10476,10 +12103,14 @@ _SOKOL_PRIVATE sg_resource_state _sg_gl_create_shader(_sg_shader_t* shd, const s
             _SG_LOGMSG(GL_SHADER_LINKING_FAILED, log_buf);
             _sg_free(log_buf);
         }
-        glDeleteProgram(gl_prog);
+        _sg_gl_cancel_create_shader(shd);
         return SG_RESOURCESTATE_FAILED;
     }
-    shd->gl.prog = gl_prog;
+    #if defined(_SOKOL_GL_HAS_PROGRAM_BINARY)
+    if (_sg.gl.program_cache.enabled && !shd->gl.build.from_cache) {
+        _sg_gl_program_cache_store(gl_prog, shd->gl.build.cache_key);
+    }
+    #endif
 
     // resolve uniforms
     _SG_GL_CHECK_ERROR();
@@ -10561,6 +12192,13 @@ _SOKOL_PRIVATE sg_resource_state _sg_gl_create_shader(_sg_shader_t* shd, const s
     return SG_RESOURCESTATE_VALID;
 }
 
+_SOKOL_PRIVATE sg_resource_state _sg_gl_create_shader(_sg_shader_t* shd, const sg_shader_desc* desc) {
+    if (!_sg_gl_begin_create_shader(shd, desc)) {
+        return SG_RESOURCESTATE_FAILED;
+    }
+    return _sg_gl_finish_create_shader(shd, desc);
+}
+
 _SOKOL_PRIVATE void _sg_gl_discard_shader(_sg_shader_t* shd) {
     SOKOL_ASSERT(shd);
     _SG_GL_CHECK_ERROR();
@@ -11317,7 +12955,22 @@ _SOKOL_PRIVATE void _sg_gl_apply_pipeline(_sg_pipeline_t* pip) {
     SOKOL_ASSERT(pip);
     _SG_GL_CHECK_ERROR();
     if (!_sg_sref_slot_eql(&_sg.gl.cache.cur_pip, &pip->slot)) {
+        // with sg_desc.dedup_pipelines_and_samplers, switching to a different
+        // pipeline object with identical render state (e.g. created from the
+        // same desc) only needs the shader program check, the state hash is
+        // only a quick reject, a hash hit is confirmed with a member-wise compare
+        bool same_state = false;
+        if (_sg.desc.dedup_pipelines_and_samplers
+            && (_sg.gl.cache.cur_pip.id != SG_INVALID_ID)
+            && (_sg.gl.cache.cur_pip_state_hash == pip->cmn.state_hash))
+        {
+            const _sg_pipeline_t* prev_pip = _sg_lookup_pipeline(_sg.gl.cache.cur_pip.id);
+            same_state = prev_pip
+                && _sg_sref_slot_eql(&_sg.gl.cache.cur_pip, &prev_pip->slot)
+                && _sg_pipeline_state_equal(&prev_pip->cmn, &pip->cmn);
+        }
         _sg.gl.cache.cur_pip = _sg_sref(&pip->slot);
+        _sg.gl.cache.cur_pip_state_hash = pip->cmn.state_hash;
 
         // bind shader program
         const _sg_shader_t* shd = _sg_shader_ref_ptr(&pip->cmn.shader);
@@ -11328,7 +12981,13 @@ _SOKOL_PRIVATE void _sg_gl_apply_pipeline(_sg_pipeline_t* pip) {
         }
 
         if (!pip->cmn.is_compute) {
-            _sg_gl_apply_render_pipeline_state(pip);
+            if (same_state) {
+                // the draw-call state isn't GL render state, always update it
+                _sg.gl.cache.cur_primitive_type = _sg_gl_primitive_type(pip->gl.primitive_type);
+                _sg.gl.cache.cur_index_type = _sg_gl_index_type(pip->cmn.index_type);
+            } else {
+                _sg_gl_apply_render_pipeline_state(pip);
+            }
         }
     }
     _SG_GL_CHECK_ERROR();
@@ -14676,6 +16335,11 @@ _SOKOL_PRIVATE void _sg_mtl_setup_backend(const sg_desc* desc) {
     SOKOL_ASSERT(desc);
     SOKOL_ASSERT(desc->environment.metal.device);
     SOKOL_ASSERT(desc->uniform_buffer_size > 0);
+    // the Metal id pool is sized once from the initial resource pool sizes
+    if (desc->growable_pools) {
+        _SG_WARN(METAL_GROWABLE_POOLS_NOT_SUPPORTED);
+        _sg.desc.growable_pools = false;
+    }
     _sg_mtl_init_pool(desc);
     _sg_mtl_clear_state_cache();
     _sg.mtl.valid = true;
@@ -16741,47 +18405,6 @@ _SOKOL_PRIVATE void _sg_wgpu_reset_bindgroup_to_alloc_state(_sg_wgpu_bindgroup_t
     bg->slot.state = SG_RESOURCESTATE_ALLOC;
 }
 
-// MurmurHash64B (see: https://github.com/aappleby/smhasher/blob/61a0530f28277f2e850bfc39600ce61d02b518de/src/MurmurHash2.cpp#L142)
-_SOKOL_PRIVATE uint64_t _sg_wgpu_hash(const void* key, int len, uint64_t seed) {
-    const uint32_t m = 0x5bd1e995;
-    const int r = 24;
-    uint32_t h1 = (uint32_t)seed ^ (uint32_t)len;
-    uint32_t h2 = (uint32_t)(seed >> 32);
-    const uint32_t * data = (const uint32_t *)key;
-    while (len >= 8) {
-        uint32_t k1 = *data++;
-        k1 *= m; k1 ^= k1 >> r; k1 *= m;
-        h1 *= m; h1 ^= k1;
-        len -= 4;
-        uint32_t k2 = *data++;
-        k2 *= m; k2 ^= k2 >> r; k2 *= m;
-        h2 *= m; h2 ^= k2;
-        len -= 4;
-    }
-    if (len >= 4) {
-        uint32_t k1 = *data++;
-        k1 *= m; k1 ^= k1 >> r; k1 *= m;
-        h1 *= m; h1 ^= k1;
-        len -= 4;
-    }
-    switch(len) {
-        case 3: h2 ^= (uint32_t)(((unsigned char*)data)[2] << 16);
-        // fall through
-        case 2: h2 ^= (uint32_t)(((unsigned char*)data)[1] << 8);
-        // fall through
-        case 1: h2 ^= ((unsigned char*)data)[0];
-        // fall through
-        h2 *= m;
-    };
-    h1 ^= h2 >> 18; h1 *= m;
-    h2 ^= h1 >> 22; h2 *= m;
-    h1 ^= h2 >> 17; h1 *= m;
-    h2 ^= h1 >> 19; h2 *= m;
-    uint64_t h = h1;
-    h = (h << 32) | h2;
-    return h;
-}
-
 _SOKOL_PRIVATE uint64_t _sg_wgpu_bindgroups_cache_item(_sg_wgpu_bindgroups_cache_item_type_t type, uint8_t wgpu_binding, uint32_t id, uint32_t uninit_count) {
     const uint64_t bb = wgpu_binding;
     const uint64_t t = type & 3;
@@ -16831,7 +18454,7 @@ _SOKOL_PRIVATE void _sg_wgpu_init_bindgroups_cache_key(_sg_wgpu_bindgroups_cache
         const uint8_t wgpu_binding = shd->wgpu.smp_grp1_bnd_n[i];
         key->items[item_idx] = _sg_wgpu_bindgroups_cache_sampler_item(wgpu_binding, &bnd->smps[i]->slot);
     }
-    key->hash = _sg_wgpu_hash(&key->items, (int)sizeof(key->items), 0x1234567887654321);
+    key->hash = _sg_hash(&key->items, (int)sizeof(key->items), 0x1234567887654321);
 }
 
 _SOKOL_PRIVATE bool _sg_wgpu_compare_bindgroups_cache_key(_sg_wgpu_bindgroups_cache_key_t* k0, _sg_wgpu_bindgroups_cache_key_t* k1) {
@@ -18345,15 +19968,53 @@ static inline sg_resource_state _sg_create_shader(_sg_shader_t* shd, const sg_sh
     #endif
 }
 
-static inline void _sg_discard_shader(_sg_shader_t* shd) {
+// asynchronous shader creation, only the GL backend actually builds shaders in the
+// background, all other backends create the shader right away and never return ALLOC
+static inline sg_resource_state _sg_begin_create_shader(_sg_shader_t* shd, const sg_shader_desc* desc) {
     #if defined(_SOKOL_ANY_GL)
-    _sg_gl_discard_shader(shd);
-    #elif defined(SOKOL_METAL)
-    _sg_mtl_discard_shader(shd);
-    #elif defined(SOKOL_D3D11)
-    _sg_d3d11_discard_shader(shd);
-    #elif defined(SOKOL_WGPU)
-    _sg_wgpu_discard_shader(shd);
+    return _sg_gl_begin_create_shader(shd, desc) ? SG_RESOURCESTATE_ALLOC : SG_RESOURCESTATE_FAILED;
+    #else
+    return _sg_create_shader(shd, desc);
+    #endif
+}
+
+static inline bool _sg_shader_build_done(const _sg_shader_t* shd) {
+    #if defined(_SOKOL_ANY_GL)
+    return _sg_gl_shader_build_done(shd);
+    #else
+    _SOKOL_UNUSED(shd);
+    return true;
+    #endif
+}
+
+static inline sg_resource_state _sg_finish_create_shader(_sg_shader_t* shd, const sg_shader_desc* desc) {
+    #if defined(_SOKOL_ANY_GL)
+    return _sg_gl_finish_create_shader(shd, desc);
+    #else
+    _SOKOL_UNUSED(shd); _SOKOL_UNUSED(desc);
+    SOKOL_UNREACHABLE;
+    return SG_RESOURCESTATE_FAILED;
+    #endif
+}
+
+static inline void _sg_cancel_create_shader(_sg_shader_t* shd) {
+    #if defined(_SOKOL_ANY_GL)
+    _sg_gl_cancel_create_shader(shd);
+    #else
+    _SOKOL_UNUSED(shd);
+    SOKOL_UNREACHABLE;
+    #endif
+}
+
+static inline void _sg_discard_shader(_sg_shader_t* shd) {
+    #if defined(_SOKOL_ANY_GL)
+    _sg_gl_discard_shader(shd);
+    #elif defined(SOKOL_METAL)
+    _sg_mtl_discard_shader(shd);
+    #elif defined(SOKOL_D3D11)
+    _sg_d3d11_discard_shader(shd);
+    #elif defined(SOKOL_WGPU)
+    _sg_wgpu_discard_shader(shd);
     #elif defined(SOKOL_DUMMY_BACKEND)
     _sg_dummy_discard_shader(shd);
     #else
@@ -18673,6 +20334,82 @@ _SOKOL_PRIVATE bool _sg_validate_end(void) {
 }
 #endif
 
+_SOKOL_PRIVATE void _sg_setup_validate_cache(const sg_desc* desc) {
+    #if defined(SOKOL_DEBUG)
+        SOKOL_ASSERT(desc);
+        SOKOL_ASSERT(0 == _sg.validate_cache.pipelines);
+        SOKOL_ASSERT(0 == _sg.validate_cache.bindings);
+        if (desc->disable_validation || desc->disable_validation_cache) {
+            return;
+        }
+        _sg.validate_cache.enabled = true;
+        _sg.validate_cache.epoch = 1;
+        _sg.validate_cache.pipelines = (_sg_validate_cache_pipeline_t*)_sg_malloc_clear(_SG_VALIDATE_CACHE_NUM_PIPELINES * sizeof(_sg_validate_cache_pipeline_t));
+        _sg.validate_cache.bindings = (_sg_validate_cache_bindings_t*)_sg_malloc_clear(_SG_VALIDATE_CACHE_NUM_BINDINGS * sizeof(_sg_validate_cache_bindings_t));
+    #else
+        _SOKOL_UNUSED(desc);
+    #endif
+}
+
+_SOKOL_PRIVATE void _sg_discard_validate_cache(void) {
+    #if defined(SOKOL_DEBUG)
+        if (_sg.validate_cache.pipelines) {
+            _sg_free(_sg.validate_cache.pipelines);
+            _sg.validate_cache.pipelines = 0;
+        }
+        if (_sg.validate_cache.bindings) {
+            _sg_free(_sg.validate_cache.bindings);
+            _sg.validate_cache.bindings = 0;
+        }
+        _sg.validate_cache.enabled = false;
+    #endif
+}
+
+// called at pass boundaries and whenever a resource object changes its state,
+// forgets all remembered validation results by bumping the epoch
+_SOKOL_PRIVATE void _sg_validate_cache_invalidate(void) {
+    #if defined(SOKOL_DEBUG)
+        if (_sg.validate_cache.enabled) {
+            if (0 == ++_sg.validate_cache.epoch) {
+                // on wraparound, old items could match again
+                _sg_clear(_sg.validate_cache.pipelines, _SG_VALIDATE_CACHE_NUM_PIPELINES * sizeof(_sg_validate_cache_pipeline_t));
+                _sg_clear(_sg.validate_cache.bindings, _SG_VALIDATE_CACHE_NUM_BINDINGS * sizeof(_sg_validate_cache_bindings_t));
+                _sg.validate_cache.epoch = 1;
+            }
+        }
+    #endif
+}
+
+#if defined(SOKOL_DEBUG)
+_SOKOL_PRIVATE _sg_validate_cache_pipeline_t* _sg_validate_cache_lookup_pipeline(uint32_t pip_id, bool* out_hit) {
+    SOKOL_ASSERT(_sg.validate_cache.enabled && out_hit);
+    _sg_validate_cache_pipeline_t* item = &_sg.validate_cache.pipelines[_sg_slot_index(pip_id) & (_SG_VALIDATE_CACHE_NUM_PIPELINES - 1)];
+    *out_hit = (item->epoch == _sg.validate_cache.epoch) && (item->pip_id == pip_id);
+    return item;
+}
+
+_SOKOL_PRIVATE _sg_validate_cache_bindings_t* _sg_validate_cache_lookup_bindings(const sg_bindings* bindings, _sg_validate_cache_bindings_key_t* out_key, bool* out_hit) {
+    SOKOL_ASSERT(_sg.validate_cache.enabled && bindings && out_key && out_hit);
+    // NOTE: buffer offsets are not part of the key since they are not validated
+    _sg_clear(out_key, sizeof(_sg_validate_cache_bindings_key_t));
+    out_key->pip_id = _sg.cur_pip.sref.id;
+    out_key->ib_id = bindings->index_buffer.id;
+    for (size_t i = 0; i < SG_MAX_VERTEXBUFFER_BINDSLOTS; i++) {
+        out_key->vb_ids[i] = bindings->vertex_buffers[i].id;
+    }
+    for (size_t i = 0; i < SG_MAX_VIEW_BINDSLOTS; i++) {
+        out_key->view_ids[i] = bindings->views[i].id;
+    }
+    for (size_t i = 0; i < SG_MAX_SAMPLER_BINDSLOTS; i++) {
+        out_key->smp_ids[i] = bindings->samplers[i].id;
+    }
+    const uint64_t hash = _sg_hash(out_key, (int)sizeof(_sg_validate_cache_bindings_key_t), 0);
+    _sg_validate_cache_bindings_t* item = &_sg.validate_cache.bindings[hash & (_SG_VALIDATE_CACHE_NUM_BINDINGS - 1)];
+    *out_hit = (item->epoch == _sg.validate_cache.epoch) && (0 == memcmp(&item->key, out_key, sizeof(_sg_validate_cache_bindings_key_t)));
+    return item;
+}
+#endif
+
 _SOKOL_PRIVATE bool _sg_one(bool b0, bool b1, bool b2) {
     return (b0 && !b1 && !b2) || (!b0 && b1 && !b2) || (!b0 && !b1 && b2);
 }
@@ -19638,6 +21375,15 @@ _SOKOL_PRIVATE bool _sg_validate_apply_pipeline(sg_pipeline pip_id) {
         if (_sg.desc.disable_validation) {
             return true;
         }
+        // skip the checks if the same pipeline has already passed them in the current pass
+        _sg_validate_cache_pipeline_t* cache_item = 0;
+        if (_sg.validate_cache.enabled) {
+            bool cache_hit = false;
+            cache_item = _sg_validate_cache_lookup_pipeline(pip_id.id, &cache_hit);
+            if (cache_hit) {
+                return true;
+            }
+        }
         _sg_validate_begin();
         // the pipeline object must be alive and valid
         _SG_VALIDATE(pip_id.id != SG_INVALID_ID, VALIDATE_APIP_PIPELINE_VALID_ID);
@@ -19700,7 +21446,12 @@ _SOKOL_PRIVATE bool _sg_validate_apply_pipeline(sg_pipeline pip_id) {
                 }
             }
         }
-        return _sg_validate_end();
+        const bool res = _sg_validate_end();
+        if (res && cache_item) {
+            cache_item->epoch = _sg.validate_cache.epoch;
+            cache_item->pip_id = pip_id.id;
+        }
+        return res;
     #endif
 }
 
@@ -19712,6 +21463,16 @@ _SOKOL_PRIVATE bool _sg_validate_apply_bindings(const sg_bindings* bindings) {
         if (_sg.desc.disable_validation) {
             return true;
         }
+        // skip the checks if the same pipeline and bindings have already passed them in the current pass
+        _sg_validate_cache_bindings_t* cache_item = 0;
+        _sg_validate_cache_bindings_key_t cache_key;
+        if (_sg.validate_cache.enabled) {
+            bool cache_hit = false;
+            cache_item = _sg_validate_cache_lookup_bindings(bindings, &cache_key, &cache_hit);
+            if (cache_hit) {
+                return true;
+            }
+        }
         _sg_validate_begin();
 
         // must be called in a pass
@@ -19921,7 +21682,12 @@ _SOKOL_PRIVATE bool _sg_validate_apply_bindings(const sg_bindings* bindings) {
                 }
             }
         }
-        return _sg_validate_end();
+        const bool res = _sg_validate_end();
+        if (res && cache_item) {
+            cache_item->epoch = _sg.validate_cache.epoch;
+            cache_item->key = cache_key;
+        }
+        return res;
     #endif
 }
 
@@ -20447,11 +22213,133 @@ _SOKOL_PRIVATE sg_view_desc _sg_view_desc_defaults(const sg_view_desc* desc) {
     return def;
 }
 
+// hash table over the dedup items of one pool, items with a ref_count > 0 are
+// chained into the bucket selected by their desc hash
+_SOKOL_PRIVATE int _sg_dedup_num_buckets(int pool_size) {
+    int num_buckets = 1;
+    while (num_buckets < pool_size) {
+        num_buckets <<= 1;
+    }
+    return num_buckets;
+}
+
+_SOKOL_PRIVATE void _sg_dedup_table_insert(_sg_dedup_table_t* tbl, int slot_index) {
+    SOKOL_ASSERT(tbl && tbl->buckets && (slot_index > 0));
+    _sg_dedup_item_t* item = &tbl->items[slot_index];
+    const int bucket = (int)(item->hash & (uint64_t)(tbl->num_buckets - 1));
+    item->next = tbl->buckets[bucket];
+    tbl->buckets[bucket] = slot_index;
+}
+
+_SOKOL_PRIVATE void _sg_dedup_table_remove(_sg_dedup_table_t* tbl, int slot_index) {
+    SOKOL_ASSERT(tbl && tbl->buckets && (slot_index > 0));
+    _sg_dedup_item_t* item = &tbl->items[slot_index];
+    if (item->ref_count > 0) {
+        int* link = &tbl->buckets[(int)(item->hash & (uint64_t)(tbl->num_buckets - 1))];
+        while (*link != 0) {
+            if (*link == slot_index) {
+                *link = item->next;
+                break;
+            }
+            link = &tbl->items[*link].next;
+        }
+    }
+    _sg_clear(item, sizeof(_sg_dedup_item_t));
+}
+
+_SOKOL_PRIVATE void _sg_dedup_table_init(_sg_dedup_table_t* tbl, int pool_size) {
+    SOKOL_ASSERT(tbl && (pool_size > 0));
+    tbl->num_buckets = _sg_dedup_num_buckets(pool_size);
+    tbl->buckets = (int*)_sg_malloc_clear((size_t)tbl->num_buckets * sizeof(int));
+    tbl->items = (_sg_dedup_item_t*)_sg_malloc_clear((size_t)pool_size * sizeof(_sg_dedup_item_t));
+}
+
+_SOKOL_PRIVATE void _sg_dedup_table_discard(_sg_dedup_table_t* tbl) {
+    SOKOL_ASSERT(tbl);
+    _sg_free(tbl->items);
+    _sg_free(tbl->buckets);
+    _sg_clear(tbl, sizeof(_sg_dedup_table_t));
+}
+
+_SOKOL_PRIVATE void _sg_dedup_table_grow(_sg_dedup_table_t* tbl, int old_size, int new_size) {
+    SOKOL_ASSERT(tbl && (new_size > old_size));
+    tbl->items = (_sg_dedup_item_t*)_sg_realloc_clear(tbl->items,
+        sizeof(_sg_dedup_item_t) * (size_t)old_size, sizeof(_sg_dedup_item_t) * (size_t)new_size);
+    // rehash the live items into a bucket array matching the new pool size
+    _sg_free(tbl->buckets);
+    tbl->num_buckets = _sg_dedup_num_buckets(new_size);
+    tbl->buckets = (int*)_sg_malloc_clear((size_t)tbl->num_buckets * sizeof(int));
+    for (int i = 1; i < old_size; i++) {
+        if (tbl->items[i].ref_count > 0) {
+            _sg_dedup_table_insert(tbl, i);
+        }
+    }
+}
+
+_SOKOL_PRIVATE bool _sg_grow_buffer_pool(void) {
+    return _sg_pool_grow(&_sg.pools.buffer_pool, &_sg.pools.buffer_chunks, sizeof(_sg_buffer_t));
+}
+
+_SOKOL_PRIVATE bool _sg_grow_image_pool(void) {
+    return _sg_pool_grow(&_sg.pools.image_pool, &_sg.pools.image_chunks, sizeof(_sg_image_t));
+}
+
+_SOKOL_PRIVATE bool _sg_grow_sampler_pool(void) {
+    const int old_size = _sg.pools.sampler_pool.size;
+    if (!_sg_pool_grow(&_sg.pools.sampler_pool, &_sg.pools.sampler_chunks, sizeof(_sg_sampler_t))) {
+        return false;
+    }
+    const int new_size = _sg.pools.sampler_pool.size;
+    // per-slot side tables must grow along with the pool
+    if (_sg.dedup.enabled) {
+        _sg_dedup_table_grow(&_sg.dedup.samplers, old_size, new_size);
+        _sg.dedup.sampler_descs = (sg_sampler_desc*)_sg_realloc_clear(_sg.dedup.sampler_descs,
+            sizeof(sg_sampler_desc) * (size_t)old_size, sizeof(sg_sampler_desc) * (size_t)new_size);
+    }
+    return true;
+}
+
+_SOKOL_PRIVATE bool _sg_grow_shader_pool(void) {
+    const int old_size = _sg.pools.shader_pool.size;
+    if (!_sg_pool_grow(&_sg.pools.shader_pool, &_sg.pools.shader_chunks, sizeof(_sg_shader_t))) {
+        return false;
+    }
+    const int new_size = _sg.pools.shader_pool.size;
+    // per-slot side tables must grow along with the pool
+    _sg.pending.shader_descs = (sg_shader_desc**)_sg_realloc_clear(_sg.pending.shader_descs,
+        sizeof(sg_shader_desc*) * (size_t)old_size, sizeof(sg_shader_desc*) * (size_t)new_size);
+    return true;
+}
+
+_SOKOL_PRIVATE bool _sg_grow_pipeline_pool(void) {
+    const int old_size = _sg.pools.pipeline_pool.size;
+    if (!_sg_pool_grow(&_sg.pools.pipeline_pool, &_sg.pools.pipeline_chunks, sizeof(_sg_pipeline_t))) {
+        return false;
+    }
+    const int new_size = _sg.pools.pipeline_pool.size;
+    // per-slot side tables must grow along with the pool
+    _sg.pending.pipeline_descs = (sg_pipeline_desc**)_sg_realloc_clear(_sg.pending.pipeline_descs,
+        sizeof(sg_pipeline_desc*) * (size_t)old_size, sizeof(sg_pipeline_desc*) * (size_t)new_size);
+    if (_sg.dedup.enabled) {
+        _sg_dedup_table_grow(&_sg.dedup.pipelines, old_size, new_size);
+        _sg.dedup.pipeline_descs = (sg_pipeline_desc*)_sg_realloc_clear(_sg.dedup.pipeline_descs,
+            sizeof(sg_pipeline_desc) * (size_t)old_size, sizeof(sg_pipeline_desc) * (size_t)new_size);
+    }
+    return true;
+}
+
+_SOKOL_PRIVATE bool _sg_grow_view_pool(void) {
+    return _sg_pool_grow(&_sg.pools.view_pool, &_sg.pools.view_chunks, sizeof(_sg_view_t));
+}
+
 _SOKOL_PRIVATE sg_buffer _sg_alloc_buffer(void) {
     sg_buffer res;
     int slot_index = _sg_pool_alloc_index(&_sg.pools.buffer_pool);
+    if ((_SG_INVALID_SLOT_INDEX == slot_index) && _sg.desc.growable_pools && _sg_grow_buffer_pool()) {
+        slot_index = _sg_pool_alloc_index(&_sg.pools.buffer_pool);
+    }
     if (_SG_INVALID_SLOT_INDEX != slot_index) {
-        res.id = _sg_slot_alloc(&_sg.pools.buffer_pool, &_sg.pools.buffers[slot_index].slot, slot_index);
+        res.id = _sg_slot_alloc(&_sg.pools.buffer_pool, &_sg_buffer_at_index(slot_index)->slot, slot_index);
         _sg_stats_add(buffers.allocated, 1);
     } else {
         res.id = SG_INVALID_ID;
@@ -20463,8 +22351,11 @@ _SOKOL_PRIVATE sg_buffer _sg_alloc_buffer(void) {
 _SOKOL_PRIVATE sg_image _sg_alloc_image(void) {
     sg_image res;
     int slot_index = _sg_pool_alloc_index(&_sg.pools.image_pool);
+    if ((_SG_INVALID_SLOT_INDEX == slot_index) && _sg.desc.growable_pools && _sg_grow_image_pool()) {
+        slot_index = _sg_pool_alloc_index(&_sg.pools.image_pool);
+    }
     if (_SG_INVALID_SLOT_INDEX != slot_index) {
-        res.id = _sg_slot_alloc(&_sg.pools.image_pool, &_sg.pools.images[slot_index].slot, slot_index);
+        res.id = _sg_slot_alloc(&_sg.pools.image_pool, &_sg_image_at_index(slot_index)->slot, slot_index);
         _sg_stats_add(images.allocated, 1);
     } else {
         res.id = SG_INVALID_ID;
@@ -20476,8 +22367,11 @@ _SOKOL_PRIVATE sg_image _sg_alloc_image(void) {
 _SOKOL_PRIVATE sg_sampler _sg_alloc_sampler(void) {
     sg_sampler res;
     int slot_index = _sg_pool_alloc_index(&_sg.pools.sampler_pool);
+    if ((_SG_INVALID_SLOT_INDEX == slot_index) && _sg.desc.growable_pools && _sg_grow_sampler_pool()) {
+        slot_index = _sg_pool_alloc_index(&_sg.pools.sampler_pool);
+    }
     if (_SG_INVALID_SLOT_INDEX != slot_index) {
-        res.id = _sg_slot_alloc(&_sg.pools.sampler_pool, &_sg.pools.samplers[slot_index].slot, slot_index);
+        res.id = _sg_slot_alloc(&_sg.pools.sampler_pool, &_sg_sampler_at_index(slot_index)->slot, slot_index);
         _sg_stats_add(samplers.allocated, 1);
     } else {
         res.id = SG_INVALID_ID;
@@ -20489,8 +22383,11 @@ _SOKOL_PRIVATE sg_sampler _sg_alloc_sampler(void) {
 _SOKOL_PRIVATE sg_shader _sg_alloc_shader(void) {
     sg_shader res;
     int slot_index = _sg_pool_alloc_index(&_sg.pools.shader_pool);
+    if ((_SG_INVALID_SLOT_INDEX == slot_index) && _sg.desc.growable_pools && _sg_grow_shader_pool()) {
+        slot_index = _sg_pool_alloc_index(&_sg.pools.shader_pool);
+    }
     if (_SG_INVALID_SLOT_INDEX != slot_index) {
-        res.id = _sg_slot_alloc(&_sg.pools.shader_pool, &_sg.pools.shaders[slot_index].slot, slot_index);
+        res.id = _sg_slot_alloc(&_sg.pools.shader_pool, &_sg_shader_at_index(slot_index)->slot, slot_index);
         _sg_stats_add(shaders.allocated, 1);
     } else {
         res.id = SG_INVALID_ID;
@@ -20502,8 +22399,11 @@ _SOKOL_PRIVATE sg_shader _sg_alloc_shader(void) {
 _SOKOL_PRIVATE sg_pipeline _sg_alloc_pipeline(void) {
     sg_pipeline res;
     int slot_index = _sg_pool_alloc_index(&_sg.pools.pipeline_pool);
+    if ((_SG_INVALID_SLOT_INDEX == slot_index) && _sg.desc.growable_pools && _sg_grow_pipeline_pool()) {
+        slot_index = _sg_pool_alloc_index(&_sg.pools.pipeline_pool);
+    }
     if (_SG_INVALID_SLOT_INDEX != slot_index) {
-        res.id =_sg_slot_alloc(&_sg.pools.pipeline_pool, &_sg.pools.pipelines[slot_index].slot, slot_index);
+        res.id = _sg_slot_alloc(&_sg.pools.pipeline_pool, &_sg_pipeline_at_index(slot_index)->slot, slot_index);
         _sg_stats_add(pipelines.allocated, 1);
     } else {
         res.id = SG_INVALID_ID;
@@ -20515,8 +22415,11 @@ _SOKOL_PRIVATE sg_pipeline _sg_alloc_pipeline(void) {
 _SOKOL_PRIVATE sg_view _sg_alloc_view(void) {
     sg_view res;
     int slot_index = _sg_pool_alloc_index(&_sg.pools.view_pool);
+    if ((_SG_INVALID_SLOT_INDEX == slot_index) && _sg.desc.growable_pools && _sg_grow_view_pool()) {
+        slot_index = _sg_pool_alloc_index(&_sg.pools.view_pool);
+    }
     if (_SG_INVALID_SLOT_INDEX != slot_index) {
-        res.id = _sg_slot_alloc(&_sg.pools.view_pool, &_sg.pools.views[slot_index].slot, slot_index);
+        res.id = _sg_slot_alloc(&_sg.pools.view_pool, &_sg_view_at_index(slot_index)->slot, slot_index);
         _sg_stats_add(views.allocated, 1);
     } else {
         res.id = SG_INVALID_ID;
@@ -20529,6 +22432,7 @@ _SOKOL_PRIVATE void _sg_dealloc_buffer(_sg_buffer_t* buf) {
     SOKOL_ASSERT(buf && (buf->slot.state == SG_RESOURCESTATE_ALLOC) && (buf->slot.id != SG_INVALID_ID));
     _sg_pool_free_index(&_sg.pools.buffer_pool, _sg_slot_index(buf->slot.id));
     _sg_slot_reset(&buf->slot);
+    _sg_validate_cache_invalidate();
     _sg_stats_add(buffers.deallocated, 1);
 }
 
@@ -20536,6 +22440,7 @@ _SOKOL_PRIVATE void _sg_dealloc_image(_sg_image_t* img) {
     SOKOL_ASSERT(img && (img->slot.state == SG_RESOURCESTATE_ALLOC) && (img->slot.id != SG_INVALID_ID));
     _sg_pool_free_index(&_sg.pools.image_pool, _sg_slot_index(img->slot.id));
     _sg_slot_reset(&img->slot);
+    _sg_validate_cache_invalidate();
     _sg_stats_add(images.deallocated, 1);
 }
 
@@ -20543,20 +22448,281 @@ _SOKOL_PRIVATE void _sg_dealloc_sampler(_sg_sampler_t* smp) {
     SOKOL_ASSERT(smp && (smp->slot.state == SG_RESOURCESTATE_ALLOC) && (smp->slot.id != SG_INVALID_ID));
     _sg_pool_free_index(&_sg.pools.sampler_pool, _sg_slot_index(smp->slot.id));
     _sg_slot_reset(&smp->slot);
+    _sg_validate_cache_invalidate();
     _sg_stats_add(samplers.deallocated, 1);
 }
 
+_SOKOL_PRIVATE bool _sg_shader_pending(const _sg_shader_t* shd) {
+    SOKOL_ASSERT(shd && (shd->slot.id != SG_INVALID_ID));
+    return (_sg.pending.num_shaders > 0) && (0 != _sg.pending.shader_descs[_sg_slot_index(shd->slot.id)]);
+}
+
+_SOKOL_PRIVATE bool _sg_pipeline_pending(const _sg_pipeline_t* pip) {
+    SOKOL_ASSERT(pip && (pip->slot.id != SG_INVALID_ID));
+    return (_sg.pending.num_pipelines > 0) && (0 != _sg.pending.pipeline_descs[_sg_slot_index(pip->slot.id)]);
+}
+
+_SOKOL_PRIVATE void _sg_cancel_pending_pipeline(_sg_pipeline_t* pip) {
+    const int slot_index = _sg_slot_index(pip->slot.id);
+    SOKOL_ASSERT(_sg.pending.pipeline_descs[slot_index]);
+    _sg_free(_sg.pending.pipeline_descs[slot_index]);
+    _sg.pending.pipeline_descs[slot_index] = 0;
+    _sg.pending.num_pipelines--;
+}
+
+// abandon an in-flight async shader build, pipelines waiting for the shader are put into FAILED state
+_SOKOL_PRIVATE void _sg_cancel_pending_shader(_sg_shader_t* shd) {
+    const int slot_index = _sg_slot_index(shd->slot.id);
+    SOKOL_ASSERT(_sg.pending.shader_descs[slot_index]);
+    _sg_cancel_create_shader(shd);
+    _sg_free(_sg.pending.shader_descs[slot_index]);
+    _sg.pending.shader_descs[slot_index] = 0;
+    _sg.pending.num_shaders--;
+    _sg_reset_shader_to_alloc_state(shd);
+    for (int i = 1; (i < _sg.pools.pipeline_pool.size) && (_sg.pending.num_pipelines > 0); i++) {
+        const sg_pipeline_desc* pip_desc = _sg.pending.pipeline_descs[i];
+        if (pip_desc && (pip_desc->shader.id == shd->slot.id)) {
+            _sg_pipeline_t* pip = _sg_pipeline_at_index(i);
+            _sg_cancel_pending_pipeline(pip);
+            pip->slot.state = SG_RESOURCESTATE_FAILED;
+        }
+    }
+}
+
+// the dedup key is the defaulted desc, hashed and compared member by member so
+// that struct padding doesn't matter, the label and canaries are not part of it
+_SOKOL_PRIVATE uint64_t _sg_dedup_pipeline_hash(const sg_pipeline_desc* desc) {
+    uint64_t h = 0;
+    _SG_HASH_VALUE(h, desc->compute);
+    _SG_HASH_VALUE(h, desc->shader.id);
+    // the vertex layout structs only have 32-bit members, so no padding
+    _SG_HASH_VALUE(h, desc->layout);
+    _SG_HASH_VALUE(h, desc->depth.pixel_format);
+    _SG_HASH_VALUE(h, desc->depth.compare);
+    _SG_HASH_VALUE(h, desc->depth.write_enabled);
+    _SG_HASH_VALUE(h, desc->depth.bias);
+    _SG_HASH_VALUE(h, desc->depth.bias_slope_scale);
+    _SG_HASH_VALUE(h, desc->depth.bias_clamp);
+    _SG_HASH_VALUE(h, desc->stencil.enabled);
+    _SG_HASH_VALUE(h, desc->stencil.front);
+    _SG_HASH_VALUE(h, desc->stencil.back);
+    _SG_HASH_VALUE(h, desc->stencil.read_mask);
+    _SG_HASH_VALUE(h, desc->stencil.write_mask);
+    _SG_HASH_VALUE(h, desc->stencil.ref);
+    _SG_HASH_VALUE(h, desc->color_count);
+    for (int i = 0; i < SG_MAX_COLOR_ATTACHMENTS; i++) {
+        const sg_color_target_state* c = &desc->colors[i];
+        _SG_HASH_VALUE(h, c->pixel_format);
+        _SG_HASH_VALUE(h, c->write_mask);
+        _SG_HASH_VALUE(h, c->blend.enabled);
+        _SG_HASH_VALUE(h, c->blend.src_factor_rgb);
+        _SG_HASH_VALUE(h, c->blend.dst_factor_rgb);
+        _SG_HASH_VALUE(h, c->blend.op_rgb);
+        _SG_HASH_VALUE(h, c->blend.src_factor_alpha);
+        _SG_HASH_VALUE(h, c->blend.dst_factor_alpha);
+        _SG_HASH_VALUE(h, c->blend.op_alpha);
+    }
+    _SG_HASH_VALUE(h, desc->primitive_type);
+    _SG_HASH_VALUE(h, desc->index_type);
+    _SG_HASH_VALUE(h, desc->cull_mode);
+    _SG_HASH_VALUE(h, desc->face_winding);
+    _SG_HASH_VALUE(h, desc->sample_count);
+    _SG_HASH_VALUE(h, desc->blend_color);
+    _SG_HASH_VALUE(h, desc->alpha_to_coverage_enabled);
+    return h;
+}
+
+_SOKOL_PRIVATE uint64_t _sg_dedup_sampler_hash(const sg_sampler_desc* desc) {
+    uint64_t h = 0;
+    _SG_HASH_VALUE(h, desc->min_filter);
+    _SG_HASH_VALUE(h, desc->mag_filter);
+    _SG_HASH_VALUE(h, desc->mipmap_filter);
+    _SG_HASH_VALUE(h, desc->wrap_u);
+    _SG_HASH_VALUE(h, desc->wrap_v);
+    _SG_HASH_VALUE(h, desc->wrap_w);
+    _SG_HASH_VALUE(h, desc->min_lod);
+    _SG_HASH_VALUE(h, desc->max_lod);
+    _SG_HASH_VALUE(h, desc->border_color);
+    _SG_HASH_VALUE(h, desc->compare);
+    _SG_HASH_VALUE(h, desc->max_anisotropy);
+    _SG_HASH_VALUE(h, desc->gl_sampler);
+    _SG_HASH_VALUE(h, desc->mtl_sampler);
+    _SG_HASH_VALUE(h, desc->d3d11_sampler);
+    _SG_HASH_VALUE(h, desc->wgpu_sampler);
+    return h;
+}
+
+#undef _SG_DEDUP_HASH
+
+_SOKOL_PRIVATE bool _sg_dedup_pipeline_desc_equal(const sg_pipeline_desc* a, const sg_pipeline_desc* b) {
+    if ((a->compute != b->compute) || (a->shader.id != b->shader.id)) {
+        return false;
+    }
+    if (0 != memcmp(&a->layout, &b->layout, sizeof(a->layout))) {
+        return false;
+    }
+    if (!_sg_depth_state_equal(&a->depth, &b->depth) ||
+        !_sg_stencil_state_equal(&a->stencil, &b->stencil) ||
+        (a->color_count != b->color_count))
+    {
+        return false;
+    }
+    for (int i = 0; i < SG_MAX_COLOR_ATTACHMENTS; i++) {
+        if (!_sg_color_target_state_equal(&a->colors[i], &b->colors[i])) {
+            return false;
+        }
+    }
+    return (a->primitive_type == b->primitive_type) &&
+           (a->index_type == b->index_type) &&
+           (a->cull_mode == b->cull_mode) &&
+           (a->face_winding == b->face_winding) &&
+           (a->sample_count == b->sample_count) &&
+           (a->blend_color.r == b->blend_color.r) &&
+           (a->blend_color.g == b->blend_color.g) &&
+           (a->blend_color.b == b->blend_color.b) &&
+           (a->blend_color.a == b->blend_color.a) &&
+           (a->alpha_to_coverage_enabled == b->alpha_to_coverage_enabled);
+}
+
+_SOKOL_PRIVATE bool _sg_dedup_sampler_desc_equal(const sg_sampler_desc* a, const sg_sampler_desc* b) {
+    return (a->min_filter == b->min_filter) &&
+           (a->mag_filter == b->mag_filter) &&
+           (a->mipmap_filter == b->mipmap_filter) &&
+           (a->wrap_u == b->wrap_u) &&
+           (a->wrap_v == b->wrap_v) &&
+           (a->wrap_w == b->wrap_w) &&
+           (a->min_lod == b->min_lod) &&
+           (a->max_lod == b->max_lod) &&
+           (a->border_color == b->border_color) &&
+           (a->compare == b->compare) &&
+           (a->max_anisotropy == b->max_anisotropy) &&
+           (a->gl_sampler == b->gl_sampler) &&
+           (a->mtl_sampler == b->mtl_sampler) &&
+           (a->d3d11_sampler == b->d3d11_sampler) &&
+           (a->wgpu_sampler == b->wgpu_sampler);
+}
+
+// returns the handle of a live pipeline with an identical desc and bumps its
+// reference count, or an invalid handle if no such pipeline exists
+_SOKOL_PRIVATE sg_pipeline _sg_dedup_share_pipeline(const sg_pipeline_desc* desc) {
+    SOKOL_ASSERT(_sg.dedup.enabled);
+    sg_pipeline res;
+    res.id = SG_INVALID_ID;
+    const _sg_dedup_table_t* tbl = &_sg.dedup.pipelines;
+    const uint64_t hash = _sg_dedup_pipeline_hash(desc);
+    int i = tbl->buckets[(int)(hash & (uint64_t)(tbl->num_buckets - 1))];
+    for (; i != 0; i = tbl->items[i].next) {
+        _sg_dedup_item_t* item = &tbl->items[i];
+        if ((item->hash == hash) && _sg_dedup_pipeline_desc_equal(&_sg.dedup.pipeline_descs[i], desc)) {
+            item->ref_count++;
+            res.id = _sg_pipeline_at_index(i)->slot.id;
+            break;
+        }
+    }
+    return res;
+}
+
+_SOKOL_PRIVATE sg_sampler _sg_dedup_share_sampler(const sg_sampler_desc* desc) {
+    SOKOL_ASSERT(_sg.dedup.enabled);
+    sg_sampler res;
+    res.id = SG_INVALID_ID;
+    const _sg_dedup_table_t* tbl = &_sg.dedup.samplers;
+    const uint64_t hash = _sg_dedup_sampler_hash(desc);
+    int i = tbl->buckets[(int)(hash & (uint64_t)(tbl->num_buckets - 1))];
+    for (; i != 0; i = tbl->items[i].next) {
+        _sg_dedup_item_t* item = &tbl->items[i];
+        if ((item->hash == hash) && _sg_dedup_sampler_desc_equal(&_sg.dedup.sampler_descs[i], desc)) {
+            item->ref_count++;
+            res.id = _sg_sampler_at_index(i)->slot.id;
+            break;
+        }
+    }
+    return res;
+}
+
+// register a freshly created pipeline for sharing (failed pipelines are never shared)
+_SOKOL_PRIVATE void _sg_dedup_add_pipeline(const _sg_pipeline_t* pip, const sg_pipeline_desc* desc) {
+    SOKOL_ASSERT(_sg.dedup.enabled);
+    if ((pip->slot.state != SG_RESOURCESTATE_VALID) && !_sg_pipeline_pending(pip)) {
+        return;
+    }
+    const int slot_index = _sg_slot_index(pip->slot.id);
+    _sg_dedup_item_t* item = &_sg.dedup.pipelines.items[slot_index];
+    SOKOL_ASSERT(item->ref_count == 0);
+    _sg.dedup.pipeline_descs[slot_index] = *desc;
+    item->hash = _sg_dedup_pipeline_hash(desc);
+    item->ref_count = 1;
+    _sg_dedup_table_insert(&_sg.dedup.pipelines, slot_index);
+}
+
+_SOKOL_PRIVATE void _sg_dedup_add_sampler(const _sg_sampler_t* smp, const sg_sampler_desc* desc) {
+    SOKOL_ASSERT(_sg.dedup.enabled);
+    if (smp->slot.state != SG_RESOURCESTATE_VALID) {
+        return;
+    }
+    const int slot_index = _sg_slot_index(smp->slot.id);
+    _sg_dedup_item_t* item = &_sg.dedup.samplers.items[slot_index];
+    SOKOL_ASSERT(item->ref_count == 0);
+    _sg.dedup.sampler_descs[slot_index] = *desc;
+    item->hash = _sg_dedup_sampler_hash(desc);
+    item->ref_count = 1;
+    _sg_dedup_table_insert(&_sg.dedup.samplers, slot_index);
+}
+
+// drops one reference, returns true if the pipeline is still shared and must stay alive
+_SOKOL_PRIVATE bool _sg_dedup_release_pipeline(const _sg_pipeline_t* pip) {
+    SOKOL_ASSERT(_sg.dedup.enabled);
+    _sg_dedup_item_t* item = &_sg.dedup.pipelines.items[_sg_slot_index(pip->slot.id)];
+    if (item->ref_count > 1) {
+        item->ref_count--;
+        return true;
+    }
+    return false;
+}
+
+_SOKOL_PRIVATE bool _sg_dedup_release_sampler(const _sg_sampler_t* smp) {
+    SOKOL_ASSERT(_sg.dedup.enabled);
+    _sg_dedup_item_t* item = &_sg.dedup.samplers.items[_sg_slot_index(smp->slot.id)];
+    if (item->ref_count > 1) {
+        item->ref_count--;
+        return true;
+    }
+    return false;
+}
+
+// called when the object behind a pool slot goes away, so it can't be shared anymore
+_SOKOL_PRIVATE void _sg_dedup_forget_pipeline(const _sg_pipeline_t* pip) {
+    if (_sg.dedup.enabled) {
+        _sg_dedup_table_remove(&_sg.dedup.pipelines, _sg_slot_index(pip->slot.id));
+    }
+}
+
+_SOKOL_PRIVATE void _sg_dedup_forget_sampler(const _sg_sampler_t* smp) {
+    if (_sg.dedup.enabled) {
+        _sg_dedup_table_remove(&_sg.dedup.samplers, _sg_slot_index(smp->slot.id));
+    }
+}
+
 _SOKOL_PRIVATE void _sg_dealloc_shader(_sg_shader_t* shd) {
     SOKOL_ASSERT(shd && (shd->slot.state == SG_RESOURCESTATE_ALLOC) && (shd->slot.id != SG_INVALID_ID));
+    if (_sg_shader_pending(shd)) {
+        _sg_cancel_pending_shader(shd);
+    }
     _sg_pool_free_index(&_sg.pools.shader_pool, _sg_slot_index(shd->slot.id));
     _sg_slot_reset(&shd->slot);
+    _sg_validate_cache_invalidate();
     _sg_stats_add(shaders.deallocated, 1);
 }
 
 _SOKOL_PRIVATE void _sg_dealloc_pipeline(_sg_pipeline_t* pip) {
     SOKOL_ASSERT(pip && (pip->slot.state == SG_RESOURCESTATE_ALLOC) && (pip->slot.id != SG_INVALID_ID));
+    if (_sg_pipeline_pending(pip)) {
+        _sg_cancel_pending_pipeline(pip);
+    }
+    _sg_dedup_forget_pipeline(pip);
     _sg_pool_free_index(&_sg.pools.pipeline_pool, _sg_slot_index(pip->slot.id));
     _sg_slot_reset(&pip->slot);
+    _sg_validate_cache_invalidate();
     _sg_stats_add(pipelines.deallocated, 1);
 }
 
@@ -20564,6 +22730,7 @@ _SOKOL_PRIVATE void _sg_dealloc_view(_sg_view_t* view) {
     SOKOL_ASSERT(view && (view->slot.state == SG_RESOURCESTATE_ALLOC) && (view->slot.id != SG_INVALID_ID));
     _sg_pool_free_index(&_sg.pools.view_pool, _sg_slot_index(view->slot.id));
     _sg_slot_reset(&view->slot);
+    _sg_validate_cache_invalidate();
     _sg_stats_add(views.deallocated, 1);
 }
 
@@ -20577,6 +22744,7 @@ _SOKOL_PRIVATE void _sg_init_buffer(_sg_buffer_t* buf, const sg_buffer_desc* des
         buf->slot.state = SG_RESOURCESTATE_FAILED;
     }
     SOKOL_ASSERT((buf->slot.state == SG_RESOURCESTATE_VALID)||(buf->slot.state == SG_RESOURCESTATE_FAILED));
+    _sg_validate_cache_invalidate();
     _sg_stats_add(buffers.inited, 1);
 }
 
@@ -20590,6 +22758,7 @@ _SOKOL_PRIVATE void _sg_init_image(_sg_image_t* img, const sg_image_desc* desc)
         img->slot.state = SG_RESOURCESTATE_FAILED;
     }
     SOKOL_ASSERT((img->slot.state == SG_RESOURCESTATE_VALID)||(img->slot.state == SG_RESOURCESTATE_FAILED));
+    _sg_validate_cache_invalidate();
     _sg_stats_add(images.inited, 1);
 }
 
@@ -20603,6 +22772,7 @@ _SOKOL_PRIVATE void _sg_init_sampler(_sg_sampler_t* smp, const sg_sampler_desc*
         smp->slot.state = SG_RESOURCESTATE_FAILED;
     }
     SOKOL_ASSERT((smp->slot.state == SG_RESOURCESTATE_VALID)||(smp->slot.state == SG_RESOURCESTATE_FAILED));
+    _sg_validate_cache_invalidate();
     _sg_stats_add(samplers.inited, 1);
 }
 
@@ -20620,16 +22790,54 @@ _SOKOL_PRIVATE void _sg_init_shader(_sg_shader_t* shd, const sg_shader_desc* des
     _sg_shader_common_init(&shd->cmn, desc);
     shd->slot.state = _sg_create_shader(shd, desc);
     SOKOL_ASSERT((shd->slot.state == SG_RESOURCESTATE_VALID)||(shd->slot.state == SG_RESOURCESTATE_FAILED));
+    _sg_validate_cache_invalidate();
     _sg_stats_add(shaders.inited, 1);
 }
 
+// like _sg_init_shader(), but a successfully started shader build stays in ALLOC
+// state and is finished later in _sg_update_pending()
+_SOKOL_PRIVATE void _sg_init_shader_async(_sg_shader_t* shd, const sg_shader_desc* desc) {
+    SOKOL_ASSERT(shd && (shd->slot.state == SG_RESOURCESTATE_ALLOC));
+    SOKOL_ASSERT(desc);
+    if (!_sg_validate_shader_desc(desc)) {
+        shd->slot.state = SG_RESOURCESTATE_FAILED;
+        return;
+    }
+    if (!_sg_validate_shader_binding_limits(desc)) {
+        shd->slot.state = SG_RESOURCESTATE_FAILED;
+        return;
+    }
+    _sg_shader_common_init(&shd->cmn, desc);
+    shd->slot.state = _sg_begin_create_shader(shd, desc);
+    if (shd->slot.state == SG_RESOURCESTATE_ALLOC) {
+        sg_shader_desc* desc_copy = (sg_shader_desc*) _sg_malloc(sizeof(sg_shader_desc));
+        *desc_copy = *desc;
+        _sg.pending.shader_descs[_sg_slot_index(shd->slot.id)] = desc_copy;
+        _sg.pending.num_shaders++;
+    } else {
+        _sg_validate_cache_invalidate();
+        _sg_stats_add(shaders.inited, 1);
+    }
+}
+
 _SOKOL_PRIVATE void _sg_init_pipeline(_sg_pipeline_t* pip, const sg_pipeline_desc* desc) {
     SOKOL_ASSERT(pip && (pip->slot.state == SG_RESOURCESTATE_ALLOC));
     SOKOL_ASSERT(desc);
+    // if the shader is still compiling asynchronously, defer pipeline
+    // creation until the shader is done, the pipeline stays in ALLOC state
+    const _sg_shader_t* pending_shd = _sg_lookup_shader(desc->shader.id);
+    if (pending_shd && (pending_shd->slot.state == SG_RESOURCESTATE_ALLOC) && _sg_shader_pending(pending_shd)) {
+        sg_pipeline_desc* desc_copy = (sg_pipeline_desc*) _sg_malloc(sizeof(sg_pipeline_desc));
+        *desc_copy = *desc;
+        _sg.pending.pipeline_descs[_sg_slot_index(pip->slot.id)] = desc_copy;
+        _sg.pending.num_pipelines++;
+        return;
+    }
     if (_sg_validate_pipeline_desc(desc)) {
         _sg_shader_t* shd = _sg_lookup_shader(desc->shader.id);
         if (shd && (shd->slot.state == SG_RESOURCESTATE_VALID)) {
             _sg_pipeline_common_init(&pip->cmn, desc, shd);
+            pip->cmn.state_hash = _sg_pipeline_state_hash(&pip->cmn);
             pip->slot.state = _sg_create_pipeline(pip, desc);
         } else {
             pip->slot.state = SG_RESOURCESTATE_FAILED;
@@ -20638,6 +22846,7 @@ _SOKOL_PRIVATE void _sg_init_pipeline(_sg_pipeline_t* pip, const sg_pipeline_des
         pip->slot.state = SG_RESOURCESTATE_FAILED;
     }
     SOKOL_ASSERT((pip->slot.state == SG_RESOURCESTATE_VALID)||(pip->slot.state == SG_RESOURCESTATE_FAILED));
+    _sg_validate_cache_invalidate();
     _sg_stats_add(pipelines.inited, 1);
 }
 
@@ -20671,6 +22880,7 @@ _SOKOL_PRIVATE void _sg_init_view(_sg_view_t* view, const sg_view_desc* desc) {
        view->slot.state = SG_RESOURCESTATE_FAILED;
     }
     SOKOL_ASSERT((view->slot.state == SG_RESOURCESTATE_VALID) || (view->slot.state == SG_RESOURCESTATE_FAILED));
+    _sg_validate_cache_invalidate();
     _sg_stats_add(views.inited, 1);
 }
 
@@ -20678,6 +22888,7 @@ _SOKOL_PRIVATE void _sg_uninit_buffer(_sg_buffer_t* buf) {
     SOKOL_ASSERT(buf && ((buf->slot.state == SG_RESOURCESTATE_VALID) || (buf->slot.state == SG_RESOURCESTATE_FAILED)));
     _sg_discard_buffer(buf);
     _sg_reset_buffer_to_alloc_state(buf);
+    _sg_validate_cache_invalidate();
     _sg_stats_add(buffers.uninited, 1);
 }
 
@@ -20685,13 +22896,16 @@ _SOKOL_PRIVATE void _sg_uninit_image(_sg_image_t* img) {
     SOKOL_ASSERT(img && ((img->slot.state == SG_RESOURCESTATE_VALID) || (img->slot.state == SG_RESOURCESTATE_FAILED)));
     _sg_discard_image(img);
     _sg_reset_image_to_alloc_state(img);
+    _sg_validate_cache_invalidate();
     _sg_stats_add(images.uninited, 1);
 }
 
 _SOKOL_PRIVATE void _sg_uninit_sampler(_sg_sampler_t* smp) {
     SOKOL_ASSERT(smp && ((smp->slot.state == SG_RESOURCESTATE_VALID) || (smp->slot.state == SG_RESOURCESTATE_FAILED)));
+    _sg_dedup_forget_sampler(smp);
     _sg_discard_sampler(smp);
     _sg_reset_sampler_to_alloc_state(smp);
+    _sg_validate_cache_invalidate();
     _sg_stats_add(samplers.uninited, 1);
 }
 
@@ -20699,13 +22913,16 @@ _SOKOL_PRIVATE void _sg_uninit_shader(_sg_shader_t* shd) {
     SOKOL_ASSERT(shd && ((shd->slot.state == SG_RESOURCESTATE_VALID) || (shd->slot.state == SG_RESOURCESTATE_FAILED)));
     _sg_discard_shader(shd);
     _sg_reset_shader_to_alloc_state(shd);
+    _sg_validate_cache_invalidate();
     _sg_stats_add(shaders.uninited, 1);
 }
 
 _SOKOL_PRIVATE void _sg_uninit_pipeline(_sg_pipeline_t* pip) {
     SOKOL_ASSERT(pip && ((pip->slot.state == SG_RESOURCESTATE_VALID) || (pip->slot.state == SG_RESOURCESTATE_FAILED)));
+    _sg_dedup_forget_pipeline(pip);
     _sg_discard_pipeline(pip);
     _sg_reset_pipeline_to_alloc_state(pip);
+    _sg_validate_cache_invalidate();
     _sg_stats_add(pipelines.uninited, 1);
 }
 
@@ -20713,6 +22930,7 @@ _SOKOL_PRIVATE void _sg_uninit_view(_sg_view_t* view) {
     SOKOL_ASSERT(view && ((view->slot.state == SG_RESOURCESTATE_VALID) || (view->slot.state == SG_RESOURCESTATE_FAILED)));
     _sg_discard_view(view);
     _sg_reset_view_to_alloc_state(view);
+    _sg_validate_cache_invalidate();
     _sg_stats_add(views.uninited, 1);
 }
 
@@ -20792,6 +23010,173 @@ _SOKOL_PRIVATE bool _sg_remove_commit_listener(const sg_commit_listener* listene
     return false;
 }
 
+// the offset of an overflowed transient range, appended data is never at a negative offset
+#define _SG_TRANSIENT_OVERFLOW_OFFSET (-1)
+
+_SOKOL_PRIVATE sg_buffer _sg_make_transient_buffer(int size, bool index_buffer, const char* label) {
+    SOKOL_ASSERT(size > 0);
+    sg_buffer_desc desc;
+    _sg_clear(&desc, sizeof(desc));
+    desc.size = (size_t)size;
+    desc.usage.vertex_buffer = !index_buffer;
+    desc.usage.index_buffer = index_buffer;
+    desc.usage.stream_update = true;
+    desc.label = label;
+    sg_buffer buf_id = sg_make_buffer(&desc);
+    if (sg_query_buffer_state(buf_id) != SG_RESOURCESTATE_VALID) {
+        _SG_ERROR(TRANSIENT_BUFFER_CREATION_FAILED);
+    }
+    return buf_id;
+}
+
+_SOKOL_PRIVATE void _sg_setup_transient_buffers(const sg_desc* desc) {
+    SOKOL_ASSERT(_sg.valid);
+    if (desc->transient_vertex_buffer_size > 0) {
+        _sg.transient.vbuf = _sg_make_transient_buffer(desc->transient_vertex_buffer_size, false, "sg-transient-vertices");
+    }
+    if (desc->transient_index_buffer_size > 0) {
+        _sg.transient.ibuf = _sg_make_transient_buffer(desc->transient_index_buffer_size, true, "sg-transient-indices");
+    }
+}
+
+_SOKOL_PRIVATE sg_transient_range _sg_append_transient(sg_buffer buf_id, const sg_range* data) {
+    SOKOL_ASSERT(data && data->ptr && (data->size > 0));
+    sg_transient_range res;
+    _sg_clear(&res, sizeof(res));
+    if (buf_id.id == SG_INVALID_ID) {
+        _SG_ERROR(TRANSIENT_BUFFER_NOT_CONFIGURED);
+        return res;
+    }
+    if (sg_query_buffer_will_overflow(buf_id, data->size)) {
+        // only warn once per frame, the overflow state sticks until the next frame
+        if (_sg.transient.overflow_frame_index != _sg.frame_index) {
+            _SG_WARN(TRANSIENT_BUFFER_OVERFLOW);
+            _sg.transient.overflow_frame_index = _sg.frame_index;
+        }
+        // the transient buffer with a negative offset marks the range as overflowed
+        res.buffer = buf_id;
+        res.offset = _SG_TRANSIENT_OVERFLOW_OFFSET;
+        res.overflowed = true;
+        return res;
+    }
+    res.offset = sg_append_buffer(buf_id, data);
+    res.buffer = buf_id;
+    return res;
+}
+
+// true if the bindings contain a range returned by an overflowed sg_append_transient_*() call
+_SOKOL_PRIVATE bool _sg_transient_overflow_bindings(const sg_bindings* bindings) {
+    if (_sg.transient.overflow_frame_index != _sg.frame_index) {
+        return false;
+    }
+    for (size_t i = 0; i < SG_MAX_VERTEXBUFFER_BINDSLOTS; i++) {
+        if ((bindings->vertex_buffers[i].id != SG_INVALID_ID) &&
+            (bindings->vertex_buffers[i].id == _sg.transient.vbuf.id) &&
+            (bindings->vertex_buffer_offsets[i] == _SG_TRANSIENT_OVERFLOW_OFFSET))
+        {
+            return true;
+        }
+    }
+    return (bindings->index_buffer.id != SG_INVALID_ID) &&
+           (bindings->index_buffer.id == _sg.transient.ibuf.id) &&
+           (bindings->index_buffer_offset == _SG_TRANSIENT_OVERFLOW_OFFSET);
+}
+
+_SOKOL_PRIVATE void _sg_setup_pending(void) {
+    SOKOL_ASSERT(0 == _sg.pending.shader_descs);
+    SOKOL_ASSERT(0 == _sg.pending.pipeline_descs);
+    SOKOL_ASSERT(_sg.pools.shader_pool.size > 0);
+    SOKOL_ASSERT(_sg.pools.pipeline_pool.size > 0);
+    _sg.pending.shader_descs = (sg_shader_desc**)_sg_malloc_clear((size_t)_sg.pools.shader_pool.size * sizeof(sg_shader_desc*));
+    _sg.pending.pipeline_descs = (sg_pipeline_desc**)_sg_malloc_clear((size_t)_sg.pools.pipeline_pool.size * sizeof(sg_pipeline_desc*));
+}
+
+_SOKOL_PRIVATE void _sg_setup_dedup(const sg_desc* desc) {
+    if (!desc->dedup_pipelines_and_samplers) {
+        return;
+    }
+    const size_t num_pips = (size_t)_sg.pools.pipeline_pool.size;
+    const size_t num_smps = (size_t)_sg.pools.sampler_pool.size;
+    _sg.dedup.enabled = true;
+    _sg_dedup_table_init(&_sg.dedup.pipelines, (int)num_pips);
+    _sg.dedup.pipeline_descs = (sg_pipeline_desc*)_sg_malloc_clear(num_pips * sizeof(sg_pipeline_desc));
+    _sg_dedup_table_init(&_sg.dedup.samplers, (int)num_smps);
+    _sg.dedup.sampler_descs = (sg_sampler_desc*)_sg_malloc_clear(num_smps * sizeof(sg_sampler_desc));
+}
+
+_SOKOL_PRIVATE void _sg_discard_dedup(void) {
+    if (!_sg.dedup.enabled) {
+        return;
+    }
+    _sg_free(_sg.dedup.sampler_descs);
+    _sg_dedup_table_discard(&_sg.dedup.samplers);
+    _sg_free(_sg.dedup.pipeline_descs);
+    _sg_dedup_table_discard(&_sg.dedup.pipelines);
+    _sg_clear(&_sg.dedup, sizeof(_sg.dedup));
+}
+
+_SOKOL_PRIVATE void _sg_setup_stats_history(void) {
+    _sg.stats_history = (sg_frame_stats*)_sg_malloc_clear(SG_MAX_FRAME_STATS_HISTORY * sizeof(sg_frame_stats));
+    _sg.stats_history_count = 0;
+}
+
+_SOKOL_PRIVATE void _sg_discard_stats_history(void) {
+    if (_sg.stats_history) {
+        _sg_free(_sg.stats_history);
+        _sg.stats_history = 0;
+    }
+}
+
+// must be called before the backend is discarded, since in-flight shader builds own backend objects
+_SOKOL_PRIVATE void _sg_discard_pending(void) {
+    SOKOL_ASSERT(_sg.pending.shader_descs && _sg.pending.pipeline_descs);
+    for (int i = 1; i < _sg.pools.shader_pool.size; i++) {
+        if (_sg.pending.shader_descs[i]) {
+            _sg_cancel_pending_shader(_sg_shader_at_index(i));
+        }
+    }
+    SOKOL_ASSERT((0 == _sg.pending.num_shaders) && (0 == _sg.pending.num_pipelines));
+    _sg_free(_sg.pending.pipeline_descs);
+    _sg_free(_sg.pending.shader_descs);
+    _sg.pending.pipeline_descs = 0;
+    _sg.pending.shader_descs = 0;
+}
+
+// finish a shader which has completed its async build, and init all pipelines waiting for it
+_SOKOL_PRIVATE void _sg_finish_pending_shader(_sg_shader_t* shd) {
+    const int slot_index = _sg_slot_index(shd->slot.id);
+    sg_shader_desc* desc = _sg.pending.shader_descs[slot_index];
+    SOKOL_ASSERT(desc && (shd->slot.state == SG_RESOURCESTATE_ALLOC));
+    shd->slot.state = _sg_finish_create_shader(shd, desc);
+    SOKOL_ASSERT((shd->slot.state == SG_RESOURCESTATE_VALID)||(shd->slot.state == SG_RESOURCESTATE_FAILED));
+    _sg_validate_cache_invalidate();
+    _sg_stats_add(shaders.inited, 1);
+    _sg_free(desc);
+    _sg.pending.shader_descs[slot_index] = 0;
+    _sg.pending.num_shaders--;
+    for (int i = 1; (i < _sg.pools.pipeline_pool.size) && (_sg.pending.num_pipelines > 0); i++) {
+        sg_pipeline_desc* pip_desc = _sg.pending.pipeline_descs[i];
+        if (pip_desc && (pip_desc->shader.id == shd->slot.id)) {
+            _sg.pending.pipeline_descs[i] = 0;
+            _sg.pending.num_pipelines--;
+            _sg_init_pipeline(_sg_pipeline_at_index(i), pip_desc);
+            _sg_free(pip_desc);
+        }
+    }
+}
+
+// called from sg_commit() to poll outstanding async shader builds
+_SOKOL_PRIVATE void _sg_update_pending(void) {
+    for (int i = 1; (i < _sg.pools.shader_pool.size) && (_sg.pending.num_shaders > 0); i++) {
+        if (_sg.pending.shader_descs[i]) {
+            _sg_shader_t* shd = _sg_shader_at_index(i);
+            if (_sg_shader_build_done(shd)) {
+                _sg_finish_pending_shader(shd);
+            }
+        }
+    }
+}
+
 _SOKOL_PRIVATE sg_desc _sg_desc_defaults(const sg_desc* desc) {
     /*
         NOTE: on WebGPU, the default color pixel format MUST be provided,
@@ -20842,39 +23227,39 @@ _SOKOL_PRIVATE void _sg_discard_all_resources(void) {
               and the resource slots not be cleared!
     */
     for (int i = 1; i < _sg.pools.buffer_pool.size; i++) {
-        sg_resource_state state = _sg.pools.buffers[i].slot.state;
+        sg_resource_state state = _sg_buffer_at_index(i)->slot.state;
         if ((state == SG_RESOURCESTATE_VALID) || (state == SG_RESOURCESTATE_FAILED)) {
-            _sg_discard_buffer(&_sg.pools.buffers[i]);
+            _sg_discard_buffer(_sg_buffer_at_index(i));
         }
     }
     for (int i = 1; i < _sg.pools.image_pool.size; i++) {
-        sg_resource_state state = _sg.pools.images[i].slot.state;
+        sg_resource_state state = _sg_image_at_index(i)->slot.state;
         if ((state == SG_RESOURCESTATE_VALID) || (state == SG_RESOURCESTATE_FAILED)) {
-            _sg_discard_image(&_sg.pools.images[i]);
+            _sg_discard_image(_sg_image_at_index(i));
         }
     }
     for (int i = 1; i < _sg.pools.sampler_pool.size; i++) {
-        sg_resource_state state = _sg.pools.samplers[i].slot.state;
+        sg_resource_state state = _sg_sampler_at_index(i)->slot.state;
         if ((state == SG_RESOURCESTATE_VALID) || (state == SG_RESOURCESTATE_FAILED)) {
-            _sg_discard_sampler(&_sg.pools.samplers[i]);
+            _sg_discard_sampler(_sg_sampler_at_index(i));
         }
     }
     for (int i = 1; i < _sg.pools.shader_pool.size; i++) {
-        sg_resource_state state = _sg.pools.shaders[i].slot.state;
+        sg_resource_state state = _sg_shader_at_index(i)->slot.state;
         if ((state == SG_RESOURCESTATE_VALID) || (state == SG_RESOURCESTATE_FAILED)) {
-            _sg_discard_shader(&_sg.pools.shaders[i]);
+            _sg_discard_shader(_sg_shader_at_index(i));
         }
     }
     for (int i = 1; i < _sg.pools.pipeline_pool.size; i++) {
-        sg_resource_state state = _sg.pools.pipelines[i].slot.state;
+        sg_resource_state state = _sg_pipeline_at_index(i)->slot.state;
         if ((state == SG_RESOURCESTATE_VALID) || (state == SG_RESOURCESTATE_FAILED)) {
-            _sg_discard_pipeline(&_sg.pools.pipelines[i]);
+            _sg_discard_pipeline(_sg_pipeline_at_index(i));
         }
     }
     for (int i = 1; i < _sg.pools.view_pool.size; i++) {
-        sg_resource_state state = _sg.pools.views[i].slot.state;
+        sg_resource_state state = _sg_view_at_index(i)->slot.state;
         if ((state == SG_RESOURCESTATE_VALID) || (state == SG_RESOURCESTATE_FAILED)) {
-            _sg_discard_view(&_sg.pools.views[i]);
+            _sg_discard_view(_sg_view_at_index(i));
         }
     }
 }
@@ -20905,17 +23290,26 @@ SOKOL_API_IMPL void sg_setup(const sg_desc* desc) {
     _sg.desc = _sg_desc_defaults(desc);
     _sg_setup_pools(&_sg.pools, &_sg.desc);
     _sg_setup_commit_listeners(&_sg.desc);
+    _sg_setup_pending();
+    _sg_setup_dedup(&_sg.desc);
+    _sg_setup_validate_cache(&_sg.desc);
     _sg.frame_index = 1;
     _sg.stats_enabled = true;
+    _sg_setup_stats_history();
     _sg_setup_backend(&_sg.desc);
     _sg_override_portable_limits();
     _sg.valid = true;
+    _sg_setup_transient_buffers(&_sg.desc);
 }
 
 SOKOL_API_IMPL void sg_shutdown(void) {
+    _sg_discard_pending();
     _sg_discard_all_resources();
+    _sg_discard_dedup();
+    _sg_discard_validate_cache();
     _sg_discard_backend();
     _sg_discard_commit_listeners();
+    _sg_discard_stats_history();
     _sg_discard_pools(&_sg.pools);
     _SG_CLEAR_ARC_STRUCT(_sg_state_t, _sg);
 }
@@ -20987,6 +23381,18 @@ SOKOL_API_IMPL sg_frame_stats sg_query_frame_stats(void) {
     return _sg.prev_stats;
 }
 
+SOKOL_API_IMPL int sg_query_frame_stats_history(sg_frame_stats* stats, int max_frames) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(stats && (max_frames >= 0));
+    uint32_t num = _sg_min(_sg.stats_history_count, (uint32_t)SG_MAX_FRAME_STATS_HISTORY);
+    num = _sg_min(num, (uint32_t)max_frames);
+    const uint32_t first = _sg.stats_history_count - num;
+    for (uint32_t i = 0; i < num; i++) {
+        stats[i] = _sg.stats_history[(first + i) % SG_MAX_FRAME_STATS_HISTORY];
+    }
+    return (int)num;
+}
+
 SOKOL_API_IMPL sg_trace_hooks sg_install_trace_hooks(const sg_trace_hooks* trace_hooks) {
     SOKOL_ASSERT(_sg.valid);
     SOKOL_ASSERT(trace_hooks);
@@ -21171,7 +23577,7 @@ SOKOL_API_IMPL void sg_init_shader(sg_shader shd_id, const sg_shader_desc* desc)
     sg_shader_desc desc_def = _sg_shader_desc_defaults(desc);
     _sg_shader_t* shd = _sg_lookup_shader(shd_id.id);
     if (shd) {
-        if (shd->slot.state == SG_RESOURCESTATE_ALLOC) {
+        if ((shd->slot.state == SG_RESOURCESTATE_ALLOC) && !_sg_shader_pending(shd)) {
             _sg_init_shader(shd, &desc_def);
             SOKOL_ASSERT((shd->slot.state == SG_RESOURCESTATE_VALID) || (shd->slot.state == SG_RESOURCESTATE_FAILED));
         } else {
@@ -21181,14 +23587,28 @@ SOKOL_API_IMPL void sg_init_shader(sg_shader shd_id, const sg_shader_desc* desc)
     _SG_TRACE_ARGS(init_shader, shd_id, &desc_def);
 }
 
+SOKOL_API_IMPL void sg_init_shader_async(sg_shader shd_id, const sg_shader_desc* desc) {
+    SOKOL_ASSERT(_sg.valid);
+    sg_shader_desc desc_def = _sg_shader_desc_defaults(desc);
+    _sg_shader_t* shd = _sg_lookup_shader(shd_id.id);
+    if (shd) {
+        if ((shd->slot.state == SG_RESOURCESTATE_ALLOC) && !_sg_shader_pending(shd)) {
+            _sg_init_shader_async(shd, &desc_def);
+        } else {
+            _SG_ERROR(INIT_SHADER_INVALID_STATE);
+        }
+    }
+    _SG_TRACE_ARGS(init_shader, shd_id, &desc_def);
+}
+
 SOKOL_API_IMPL void sg_init_pipeline(sg_pipeline pip_id, const sg_pipeline_desc* desc) {
     SOKOL_ASSERT(_sg.valid);
     sg_pipeline_desc desc_def = _sg_pipeline_desc_defaults(desc);
     _sg_pipeline_t* pip = _sg_lookup_pipeline(pip_id.id);
     if (pip) {
-        if (pip->slot.state == SG_RESOURCESTATE_ALLOC) {
+        if ((pip->slot.state == SG_RESOURCESTATE_ALLOC) && !_sg_pipeline_pending(pip)) {
             _sg_init_pipeline(pip, &desc_def);
-            SOKOL_ASSERT((pip->slot.state == SG_RESOURCESTATE_VALID) || (pip->slot.state == SG_RESOURCESTATE_FAILED));
+            SOKOL_ASSERT((pip->slot.state == SG_RESOURCESTATE_VALID) || (pip->slot.state == SG_RESOURCESTATE_FAILED) || _sg_pipeline_pending(pip));
         } else {
             _SG_ERROR(INIT_PIPELINE_INVALID_STATE);
         }
@@ -21262,7 +23682,11 @@ SOKOL_API_IMPL void sg_uninit_shader(sg_shader shd_id) {
         if ((shd->slot.state == SG_RESOURCESTATE_VALID) || (shd->slot.state == SG_RESOURCESTATE_FAILED)) {
             _sg_uninit_shader(shd);
             SOKOL_ASSERT(shd->slot.state == SG_RESOURCESTATE_ALLOC);
-        } else if (shd->slot.state != SG_RESOURCESTATE_ALLOC) {
+        } else if (shd->slot.state == SG_RESOURCESTATE_ALLOC) {
+            if (_sg_shader_pending(shd)) {
+                _sg_cancel_pending_shader(shd);
+            }
+        } else {
             _SG_ERROR(UNINIT_SHADER_INVALID_STATE);
         }
     }
@@ -21276,7 +23700,11 @@ SOKOL_API_IMPL void sg_uninit_pipeline(sg_pipeline pip_id) {
         if ((pip->slot.state == SG_RESOURCESTATE_VALID) || (pip->slot.state == SG_RESOURCESTATE_FAILED)) {
             _sg_uninit_pipeline(pip);
             SOKOL_ASSERT(pip->slot.state == SG_RESOURCESTATE_ALLOC);
-        } else if (pip->slot.state != SG_RESOURCESTATE_ALLOC) {
+        } else if (pip->slot.state == SG_RESOURCESTATE_ALLOC) {
+            if (_sg_pipeline_pending(pip)) {
+                _sg_cancel_pending_pipeline(pip);
+            }
+        } else {
             _SG_ERROR(UNINIT_PIPELINE_INVALID_STATE);
         }
     }
@@ -21341,6 +23769,9 @@ SOKOL_API_IMPL void sg_fail_shader(sg_shader shd_id) {
     _sg_shader_t* shd = _sg_lookup_shader(shd_id.id);
     if (shd) {
         if (shd->slot.state == SG_RESOURCESTATE_ALLOC) {
+            if (_sg_shader_pending(shd)) {
+                _sg_cancel_pending_shader(shd);
+            }
             shd->slot.state = SG_RESOURCESTATE_FAILED;
         } else {
             _SG_ERROR(FAIL_SHADER_INVALID_STATE);
@@ -21354,6 +23785,9 @@ SOKOL_API_IMPL void sg_fail_pipeline(sg_pipeline pip_id) {
     _sg_pipeline_t* pip = _sg_lookup_pipeline(pip_id.id);
     if (pip) {
         if (pip->slot.state == SG_RESOURCESTATE_ALLOC) {
+            if (_sg_pipeline_pending(pip)) {
+                _sg_cancel_pending_pipeline(pip);
+            }
             pip->slot.state = SG_RESOURCESTATE_FAILED;
         } else {
             _SG_ERROR(FAIL_PIPELINE_INVALID_STATE);
@@ -21428,6 +23862,12 @@ SOKOL_API_IMPL sg_buffer sg_make_buffer(const sg_buffer_desc* desc) {
         _sg_init_buffer(buf, &desc_def);
         SOKOL_ASSERT((buf->slot.state == SG_RESOURCESTATE_VALID) || (buf->slot.state == SG_RESOURCESTATE_FAILED));
     }
+    #if defined(_SOKOL_ANY_GL)
+    // the GL buffer from sg_gl_upload_buffer() would leak if no valid buffer owns it
+    if (desc_def.gl_sync && (sg_query_buffer_state(buf_id) != SG_RESOURCESTATE_VALID)) {
+        _sg_gl_discard_upload(desc_def.gl_sync, desc_def.gl_buffers[0], 0);
+    }
+    #endif
     _SG_TRACE_ARGS(make_buffer, &desc_def, buf_id);
     return buf_id;
 }
@@ -21443,6 +23883,12 @@ SOKOL_API_IMPL sg_image sg_make_image(const sg_image_desc* desc) {
         _sg_init_image(img, &desc_def);
         SOKOL_ASSERT((img->slot.state == SG_RESOURCESTATE_VALID) || (img->slot.state == SG_RESOURCESTATE_FAILED));
     }
+    #if defined(_SOKOL_ANY_GL)
+    // the GL texture from sg_gl_upload_image() would leak if no valid image owns it
+    if (desc_def.gl_sync && (sg_query_image_state(img_id) != SG_RESOURCESTATE_VALID)) {
+        _sg_gl_discard_upload(desc_def.gl_sync, 0, desc_def.gl_textures[0]);
+    }
+    #endif
     _SG_TRACE_ARGS(make_image, &desc_def, img_id);
     return img_id;
 }
@@ -21451,12 +23897,22 @@ SOKOL_API_IMPL sg_sampler sg_make_sampler(const sg_sampler_desc* desc) {
     SOKOL_ASSERT(_sg.valid);
     SOKOL_ASSERT(desc);
     sg_sampler_desc desc_def = _sg_sampler_desc_defaults(desc);
+    if (_sg.dedup.enabled) {
+        sg_sampler shared_smp_id = _sg_dedup_share_sampler(&desc_def);
+        if (shared_smp_id.id != SG_INVALID_ID) {
+            _SG_TRACE_ARGS(make_sampler, &desc_def, shared_smp_id);
+            return shared_smp_id;
+        }
+    }
     sg_sampler smp_id = _sg_alloc_sampler();
     if (smp_id.id != SG_INVALID_ID) {
         _sg_sampler_t* smp = _sg_sampler_at(smp_id.id);
         SOKOL_ASSERT(smp && (smp->slot.state == SG_RESOURCESTATE_ALLOC));
         _sg_init_sampler(smp, &desc_def);
         SOKOL_ASSERT((smp->slot.state == SG_RESOURCESTATE_VALID) || (smp->slot.state == SG_RESOURCESTATE_FAILED));
+        if (_sg.dedup.enabled) {
+            _sg_dedup_add_sampler(smp, &desc_def);
+        }
     }
     _SG_TRACE_ARGS(make_sampler, &desc_def, smp_id);
     return smp_id;
@@ -21477,16 +23933,45 @@ SOKOL_API_IMPL sg_shader sg_make_shader(const sg_shader_desc* desc) {
     return shd_id;
 }
 
+SOKOL_API_IMPL sg_shader sg_make_shader_async(const sg_shader_desc* desc) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(desc);
+    sg_shader_desc desc_def = _sg_shader_desc_defaults(desc);
+    sg_shader shd_id = _sg_alloc_shader();
+    if (shd_id.id != SG_INVALID_ID) {
+        _sg_shader_t* shd = _sg_shader_at(shd_id.id);
+        SOKOL_ASSERT(shd && (shd->slot.state == SG_RESOURCESTATE_ALLOC));
+        _sg_init_shader_async(shd, &desc_def);
+    }
+    _SG_TRACE_ARGS(make_shader, &desc_def, shd_id);
+    return shd_id;
+}
+
+SOKOL_API_IMPL int sg_query_num_pending_shaders(void) {
+    SOKOL_ASSERT(_sg.valid);
+    return _sg.pending.num_shaders;
+}
+
 SOKOL_API_IMPL sg_pipeline sg_make_pipeline(const sg_pipeline_desc* desc) {
     SOKOL_ASSERT(_sg.valid);
     SOKOL_ASSERT(desc);
     sg_pipeline_desc desc_def = _sg_pipeline_desc_defaults(desc);
+    if (_sg.dedup.enabled) {
+        sg_pipeline shared_pip_id = _sg_dedup_share_pipeline(&desc_def);
+        if (shared_pip_id.id != SG_INVALID_ID) {
+            _SG_TRACE_ARGS(make_pipeline, &desc_def, shared_pip_id);
+            return shared_pip_id;
+        }
+    }
     sg_pipeline pip_id = _sg_alloc_pipeline();
     if (pip_id.id != SG_INVALID_ID) {
         _sg_pipeline_t* pip = _sg_pipeline_at(pip_id.id);
         SOKOL_ASSERT(pip && (pip->slot.state == SG_RESOURCESTATE_ALLOC));
         _sg_init_pipeline(pip, &desc_def);
-        SOKOL_ASSERT((pip->slot.state == SG_RESOURCESTATE_VALID) || (pip->slot.state == SG_RESOURCESTATE_FAILED));
+        SOKOL_ASSERT((pip->slot.state == SG_RESOURCESTATE_VALID) || (pip->slot.state == SG_RESOURCESTATE_FAILED) || _sg_pipeline_pending(pip));
+        if (_sg.dedup.enabled) {
+            _sg_dedup_add_pipeline(pip, &desc_def);
+        }
     }
     _SG_TRACE_ARGS(make_pipeline, &desc_def, pip_id);
     return pip_id;
@@ -21544,6 +24029,10 @@ SOKOL_API_IMPL void sg_destroy_sampler(sg_sampler smp_id) {
     _SG_TRACE_ARGS(destroy_sampler, smp_id);
     _sg_sampler_t* smp = _sg_lookup_sampler(smp_id.id);
     if (smp) {
+        if (_sg.dedup.enabled && _sg_dedup_release_sampler(smp)) {
+            // still shared by other sg_make_sampler() callers
+            return;
+        }
         if ((smp->slot.state == SG_RESOURCESTATE_VALID) || (smp->slot.state == SG_RESOURCESTATE_FAILED)) {
             _sg_uninit_sampler(smp);
             SOKOL_ASSERT(smp->slot.state == SG_RESOURCESTATE_ALLOC);
@@ -21576,6 +24065,10 @@ SOKOL_API_IMPL void sg_destroy_pipeline(sg_pipeline pip_id) {
     _SG_TRACE_ARGS(destroy_pipeline, pip_id);
     _sg_pipeline_t* pip = _sg_lookup_pipeline(pip_id.id);
     if (pip) {
+        if (_sg.dedup.enabled && _sg_dedup_release_pipeline(pip)) {
+            // still shared by other sg_make_pipeline() callers
+            return;
+        }
         if ((pip->slot.state == SG_RESOURCESTATE_VALID) || (pip->slot.state == SG_RESOURCESTATE_FAILED)) {
             _sg_uninit_pipeline(pip);
             SOKOL_ASSERT(pip->slot.state == SG_RESOURCESTATE_ALLOC);
@@ -21611,6 +24104,10 @@ SOKOL_API_IMPL void sg_begin_pass(const sg_pass* pass) {
     SOKOL_ASSERT(pass);
     SOKOL_ASSERT((pass->_start_canary == 0) && (pass->_end_canary == 0));
     _sg.cur_pass.in_pass = true;
+    _sg_validate_cache_invalidate();
+    if (_sg.stats_enabled) {
+        _sg_stats_begin_pass();
+    }
     const sg_pass pass_def = _sg_pass_defaults(pass);
     if (!_sg_validate_pass_attachment_limits(&pass_def)) {
         return;
@@ -21685,6 +24182,20 @@ SOKOL_API_IMPL void sg_apply_scissor_rectf(float x, float y, float width, float
 SOKOL_API_IMPL void sg_apply_pipeline(sg_pipeline pip_id) {
     SOKOL_ASSERT(_sg.valid);
     _sg_stats_add(num_apply_pipeline, 1);
+    if (_sg.stats_enabled) {
+        _sg_stats_apply_pipeline(pip_id);
+    }
+    // a pipeline waiting for an async shader build isn't an error, but
+    // all following bindings, uniforms and draws are silently skipped
+    const _sg_pipeline_t* pending_pip = _sg.pending.num_pipelines > 0 ? _sg_lookup_pipeline(pip_id.id) : 0;
+    _sg.cur_pip_pending = pending_pip && _sg_pipeline_pending(pending_pip);
+    if (_sg.cur_pip_pending) {
+        _sg.cur_pip = _sg_pipeline_ref(0);
+        _sg.next_draw_valid = false;
+        // trace hooks (e.g. a profiler) still see the call
+        _SG_TRACE_ARGS(apply_pipeline, pip_id);
+        return;
+    }
     if (!_sg_validate_apply_pipeline(pip_id)) {
         _sg.next_draw_valid = false;
         return;
@@ -21717,7 +24228,19 @@ SOKOL_API_IMPL void sg_apply_bindings(const sg_bindings* bindings) {
     SOKOL_ASSERT(_sg.valid);
     SOKOL_ASSERT(bindings);
     _sg_stats_add(num_apply_bindings, 1);
+    if (_sg.stats_enabled) {
+        _sg_stats_apply_bindings(bindings);
+    }
+    if (_sg.cur_pip_pending) {
+        return;
+    }
     _sg.applied_bindings_and_uniforms |= (1 << SG_MAX_UNIFORMBLOCK_BINDSLOTS);
+    if (_sg_transient_overflow_bindings(bindings)) {
+        // skip draws with ranges from an overflowed transient buffer, the
+        // overflow has already been logged in sg_append_transient_*()
+        _sg.next_draw_valid = false;
+        return;
+    }
     if (!_sg_validate_apply_bindings(bindings)) {
         _sg.next_draw_valid = false;
     }
@@ -21788,6 +24311,9 @@ SOKOL_API_IMPL void sg_apply_uniforms(int ub_slot, const sg_range* data) {
     SOKOL_ASSERT(data && data->ptr && (data->size > 0));
     _sg_stats_add(num_apply_uniforms, 1);
     _sg_stats_add(size_apply_uniforms, (uint32_t)data->size);
+    if (_sg.cur_pip_pending) {
+        return;
+    }
     _sg.applied_bindings_and_uniforms |= 1 << ub_slot;
     if (!_sg_validate_apply_uniforms(ub_slot, data)) {
         _sg.next_draw_valid = false;
@@ -21819,6 +24345,9 @@ _SOKOL_PRIVATE bool _sg_check_skip_draw(int num_elements, int num_instances) {
 
 SOKOL_API_IMPL void sg_draw(int base_element, int num_elements, int num_instances) {
     SOKOL_ASSERT(_sg.valid);
+    if (_sg.cur_pip_pending) {
+        return;
+    }
     #if defined(SOKOL_DEBUG)
     if (!_sg_validate_draw(base_element, num_elements, num_instances)) {
         return;
@@ -21828,12 +24357,18 @@ SOKOL_API_IMPL void sg_draw(int base_element, int num_elements, int num_instance
     if (_sg_check_skip_draw(num_elements, num_instances)) {
         return;
     }
+    if (_sg.stats_enabled) {
+        _sg_stats_draw(num_elements, num_instances);
+    }
     _sg_draw(base_element, num_elements, num_instances, 0, 0);
     _SG_TRACE_ARGS(draw, base_element, num_elements, num_instances);
 }
 
 SOKOL_API_IMPL void sg_draw_ex(int base_element, int num_elements, int num_instances, int base_vertex, int base_instance) {
     SOKOL_ASSERT(_sg.valid);
+    if (_sg.cur_pip_pending) {
+        return;
+    }
     #if defined(SOKOL_DEBUG)
     if (!_sg_validate_draw_ex(base_element, num_elements, num_instances, base_vertex, base_instance)) {
         return;
@@ -21843,12 +24378,18 @@ SOKOL_API_IMPL void sg_draw_ex(int base_element, int num_elements, int num_insta
     if (_sg_check_skip_draw(num_elements, num_instances)) {
         return;
     }
+    if (_sg.stats_enabled) {
+        _sg_stats_draw(num_elements, num_instances);
+    }
     _sg_draw(base_element, num_elements, num_instances, base_vertex, base_instance);
     _SG_TRACE_ARGS(draw_ex, base_element, num_elements, num_instances, base_vertex, base_instance);
 }
 
 SOKOL_API_IMPL void sg_dispatch(int num_groups_x, int num_groups_y, int num_groups_z) {
     SOKOL_ASSERT(_sg.valid);
+    if (_sg.cur_pip_pending) {
+        return;
+    }
     #if defined(SOKOL_DEBUG)
     if (!_sg_validate_dispatch(num_groups_x, num_groups_y, num_groups_z)) {
         return;
@@ -21873,11 +24414,16 @@ SOKOL_API_IMPL void sg_end_pass(void) {
     SOKOL_ASSERT(_sg.valid);
     SOKOL_ASSERT(_sg.cur_pass.in_pass);
     _sg_stats_add(num_passes, 1);
+    if (_sg.stats_enabled) {
+        _sg_stats_end_pass();
+    }
     // NOTE: don't exit early if !_sg.cur_pass.valid
     const _sg_attachments_ptrs_t atts_ptrs = _sg_attachments_ptrs(&_sg.cur_pass.atts);
     _sg_end_pass(&atts_ptrs);
     _sg.cur_pip = _sg_pipeline_ref(0);
+    _sg.cur_pip_pending = false;
     _sg_clear(&_sg.cur_pass, sizeof(_sg.cur_pass));
+    _sg_validate_cache_invalidate();
     _SG_TRACE_NOARGS(end_pass);
 }
 
@@ -21886,6 +24432,9 @@ SOKOL_API_IMPL void sg_commit(void) {
     SOKOL_ASSERT(!_sg.cur_pass.valid);
     SOKOL_ASSERT(!_sg.cur_pass.in_pass);
     _sg_commit();
+    if (_sg.pending.num_shaders > 0) {
+        _sg_update_pending();
+    }
     _sg_update_frame_stats();
     _sg_notify_commit_listeners();
     _SG_TRACE_NOARGS(commit);
@@ -21903,6 +24452,7 @@ SOKOL_API_IMPL void sg_update_buffer(sg_buffer buf_id, const sg_range* data) {
     SOKOL_ASSERT(data && data->ptr && (data->size > 0));
     _sg_stats_add(num_update_buffer, 1);
     _sg_stats_add(size_update_buffer, (uint32_t)data->size);
+    _sg_stats_add(size_uploaded, data->size);
     _sg_buffer_t* buf = _sg_lookup_buffer(buf_id.id);
     if ((data->size > 0) && buf && (buf->slot.state == SG_RESOURCESTATE_VALID)) {
         if (_sg_validate_update_buffer(buf, data)) {
@@ -21923,6 +24473,7 @@ SOKOL_API_IMPL int sg_append_buffer(sg_buffer buf_id, const sg_range* data) {
     SOKOL_ASSERT(data && data->ptr);
     _sg_stats_add(num_append_buffer, 1);
     _sg_stats_add(size_append_buffer, (uint32_t)data->size);
+    _sg_stats_add(size_uploaded, data->size);
     _sg_buffer_t* buf = _sg_lookup_buffer(buf_id.id);
     int result;
     if (buf) {
@@ -21932,6 +24483,10 @@ SOKOL_API_IMPL int sg_append_buffer(sg_buffer buf_id, const sg_range* data) {
             buf->cmn.append_overflow = false;
         }
         if (((size_t)buf->cmn.append_pos + data->size) > (size_t)buf->cmn.size) {
+            if (!buf->cmn.append_overflow) {
+                // an overflowing buffer fails the sg_apply_bindings() validation
+                _sg_validate_cache_invalidate();
+            }
             buf->cmn.append_overflow = true;
         }
         const int start_pos = buf->cmn.append_pos;
@@ -21982,6 +24537,21 @@ SOKOL_API_IMPL bool sg_query_buffer_will_overflow(sg_buffer buf_id, size_t size)
     return result;
 }
 
+SOKOL_API_IMPL sg_transient_range sg_append_transient_vertices(const sg_range* data) {
+    SOKOL_ASSERT(_sg.valid);
+    return _sg_append_transient(_sg.transient.vbuf, data);
+}
+
+SOKOL_API_IMPL sg_transient_range sg_append_transient_indices(const sg_range* data) {
+    SOKOL_ASSERT(_sg.valid);
+    return _sg_append_transient(_sg.transient.ibuf, data);
+}
+
+SOKOL_API_IMPL bool sg_query_transient_overflow(void) {
+    SOKOL_ASSERT(_sg.valid);
+    return _sg.transient.overflow_frame_index == _sg.frame_index;
+}
+
 SOKOL_API_IMPL void sg_update_image(sg_image img_id, const sg_image_data* data) {
     SOKOL_ASSERT(_sg.valid);
     _sg_stats_add(num_update_image, 1);
@@ -21990,6 +24560,7 @@ SOKOL_API_IMPL void sg_update_image(sg_image img_id, const sg_image_data* data)
             break;
         }
         _sg_stats_add(size_update_image, (uint32_t)data->mip_levels[mip_index].size);
+        _sg_stats_add(size_uploaded, data->mip_levels[mip_index].size);
     }
     _sg_image_t* img = _sg_lookup_image(img_id.id);
     if (img && img->slot.state == SG_RESOURCESTATE_VALID) {
@@ -22922,6 +25493,208 @@ SOKOL_API_IMPL sg_gl_shader_info sg_gl_query_shader_info(sg_shader shd_id) {
     return res;
 }
 
+// NOTE: the upload functions are called on a worker thread with a shared GL
+// context current, they must not modify any sokol-gfx state or use the GL state cache
+SOKOL_API_IMPL bool sg_gl_upload_buffer(sg_buffer_desc* desc) {
+    SOKOL_ASSERT(_sg.valid && desc);
+    #if defined(_SOKOL_ANY_GL)
+        const sg_buffer_desc desc_def = _sg_buffer_desc_defaults(desc);
+        if (!desc_def.usage.immutable || (0 == desc_def.data.ptr) || (0 != desc_def.gl_buffers[0])) {
+            _SG_ERROR(GL_UPLOAD_INVALID_DESC);
+            return false;
+        }
+        _SG_GL_CHECK_ERROR();
+        const GLenum gl_target = _sg_gl_buffer_target(&desc_def.usage);
+        GLuint gl_buf = 0;
+        glGenBuffers(1, &gl_buf);
+        SOKOL_ASSERT(gl_buf);
+        glBindBuffer(gl_target, gl_buf);
+        glBufferData(gl_target, (GLsizeiptr)desc_def.size, desc_def.data.ptr, _sg_gl_buffer_usage(&desc_def.usage));
+        glBindBuffer(gl_target, 0);
+        desc->size = desc_def.size;
+        _sg_clear(&desc->data, sizeof(desc->data));
+        desc->gl_buffers[0] = gl_buf;
+        desc->gl_sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        // make sure the fence is visible to the render thread context
+        glFlush();
+        _SG_GL_CHECK_ERROR();
+        return true;
+    #else
+        _SOKOL_UNUSED(desc);
+        return false;
+    #endif
+}
+
+SOKOL_API_IMPL bool sg_gl_upload_image(sg_image_desc* desc) {
+    SOKOL_ASSERT(_sg.valid && desc);
+    #if defined(_SOKOL_ANY_GL)
+        const sg_image_desc desc_def = _sg_image_desc_defaults(desc);
+        const sg_image_usage* usg = &desc_def.usage;
+        const bool any_attachment = usg->color_attachment || usg->resolve_attachment || usg->depth_stencil_attachment;
+        if (!usg->immutable || any_attachment || usg->storage_image
+            || (0 == desc_def.data.mip_levels[0].ptr) || (0 != desc_def.gl_textures[0]))
+        {
+            _SG_ERROR(GL_UPLOAD_INVALID_DESC);
+            return false;
+        }
+        if (!_sg_gl_supported_texture_format(desc_def.pixel_format)) {
+            _SG_ERROR(GL_TEXTURE_FORMAT_NOT_SUPPORTED);
+            return false;
+        }
+        _SG_GL_CHECK_ERROR();
+        // a temporary image object, only needed for the common texture upload helpers
+        _sg_image_t img;
+        _sg_clear(&img, sizeof(img));
+        _sg_image_common_init(&img.cmn, &desc_def);
+        img.gl.target = _sg_gl_texture_target(img.cmn.type, img.cmn.sample_count);
+        GLuint gl_tex = 0;
+        glGenTextures(1, &gl_tex);
+        SOKOL_ASSERT(gl_tex);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glBindTexture(img.gl.target, gl_tex);
+        _sg_gl_texstorage(&img);
+        _sg_gl_teximage_mips(&img, &desc_def.data);
+        glBindTexture(img.gl.target, 0);
+        _sg_clear(&desc->data, sizeof(desc->data));
+        desc->gl_textures[0] = gl_tex;
+        desc->gl_sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        // make sure the fence is visible to the render thread context
+        glFlush();
+        _SG_GL_CHECK_ERROR();
+        return true;
+    #else
+        _SOKOL_UNUSED(desc);
+        return false;
+    #endif
+}
+
+SOKOL_API_IMPL bool sg_gl_begin_readback(sg_gl_readback* rb, sg_image img_id) {
+    SOKOL_ASSERT(_sg.valid && rb);
+    #if defined(_SOKOL_ANY_GL) && defined(__EMSCRIPTEN__)
+        _SOKOL_UNUSED(rb);
+        _SOKOL_UNUSED(img_id);
+        _SG_ERROR(GL_READBACK_NOT_SUPPORTED);
+        return false;
+    #elif defined(_SOKOL_ANY_GL)
+        if (_sg.cur_pass.in_pass) {
+            _SG_ERROR(GL_READBACK_IN_PASS);
+            return false;
+        }
+        if (rb->sync) {
+            _SG_ERROR(GL_READBACK_BUSY);
+            return false;
+        }
+        const _sg_image_t* img = _sg_lookup_image(img_id.id);
+        if (!img || (img->slot.state != SG_RESOURCESTATE_VALID)
+            || (img->cmn.type != SG_IMAGETYPE_2D) || (img->cmn.sample_count != 1)
+            || ((img->cmn.pixel_format != SG_PIXELFORMAT_RGBA8) && (img->cmn.pixel_format != SG_PIXELFORMAT_SRGB8A8)))
+        {
+            _SG_ERROR(GL_READBACK_INVALID_IMAGE);
+            return false;
+        }
+        _SG_GL_CHECK_ERROR();
+        const int w = img->cmn.width;
+        const int h = img->cmn.height;
+        const size_t size = (size_t)w * (size_t)h * 4;
+        if (0 == rb->pbo) {
+            glGenBuffers(1, &rb->pbo);
+            SOKOL_ASSERT(rb->pbo);
+            rb->pbo_size = 0;
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, rb->pbo);
+        if (rb->pbo_size < size) {
+            glBufferData(GL_PIXEL_PACK_BUFFER, (GLsizeiptr)size, 0, GL_STREAM_READ);
+            rb->pbo_size = size;
+        }
+        // a temporary framebuffer to read from, the pass framebuffer binding is restored below
+        GLuint gl_fb = 0;
+        glGenFramebuffers(1, &gl_fb);
+        glBindFramebuffer(GL_FRAMEBUFFER, gl_fb);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, img->gl.tex[img->cmn.active_slot], 0);
+        glReadBuffer(GL_COLOR_ATTACHMENT0);
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+        glReadPixels(0, 0, w, h, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        glBindFramebuffer(GL_FRAMEBUFFER, _sg.gl.fb);
+        glDeleteFramebuffers(1, &gl_fb);
+        rb->sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        rb->width = w;
+        rb->height = h;
+        _SG_GL_CHECK_ERROR();
+        return true;
+    #else
+        _SOKOL_UNUSED(rb);
+        _SOKOL_UNUSED(img_id);
+        return false;
+    #endif
+}
+
+SOKOL_API_IMPL bool sg_gl_readback_ready(sg_gl_readback* rb) {
+    SOKOL_ASSERT(_sg.valid && rb);
+    #if defined(_SOKOL_ANY_GL) && !defined(__EMSCRIPTEN__)
+        if (0 == rb->sync) {
+            return false;
+        }
+        // NOTE: flush on the first poll, otherwise the fence might never be signalled
+        const GLenum res = glClientWaitSync((GLsync)rb->sync, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+        return (res == GL_ALREADY_SIGNALED) || (res == GL_CONDITION_SATISFIED);
+    #else
+        _SOKOL_UNUSED(rb);
+        return false;
+    #endif
+}
+
+SOKOL_API_IMPL bool sg_gl_end_readback(sg_gl_readback* rb, sg_range dst) {
+    SOKOL_ASSERT(_sg.valid && rb);
+    #if defined(_SOKOL_ANY_GL) && !defined(__EMSCRIPTEN__)
+        if (0 == rb->sync) {
+            return false;
+        }
+        const size_t row_size = (size_t)rb->width * 4;
+        const size_t size = row_size * (size_t)rb->height;
+        if ((0 == dst.ptr) || (dst.size < size)) {
+            _SG_ERROR(GL_READBACK_DST_TOO_SMALL);
+            return false;
+        }
+        _SG_GL_CHECK_ERROR();
+        glClientWaitSync((GLsync)rb->sync, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+        glDeleteSync((GLsync)rb->sync);
+        rb->sync = 0;
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, rb->pbo);
+        const uint8_t* src = (const uint8_t*) glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, (GLsizeiptr)size, GL_MAP_READ_BIT);
+        bool res = false;
+        if (src) {
+            // GL rows are bottom-to-top, flip into top-to-bottom order
+            uint8_t* dst_ptr = (uint8_t*) dst.ptr;
+            for (int y = 0; y < rb->height; y++) {
+                memcpy(dst_ptr + (size_t)y * row_size, src + (size_t)(rb->height - 1 - y) * row_size, row_size);
+            }
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+            res = true;
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        _SG_GL_CHECK_ERROR();
+        return res;
+    #else
+        _SOKOL_UNUSED(rb);
+        _SOKOL_UNUSED(dst);
+        return false;
+    #endif
+}
+
+SOKOL_API_IMPL void sg_gl_discard_readback(sg_gl_readback* rb) {
+    SOKOL_ASSERT(_sg.valid && rb);
+    #if defined(_SOKOL_ANY_GL) && !defined(__EMSCRIPTEN__)
+        if (rb->sync) {
+            glDeleteSync((GLsync)rb->sync);
+        }
+        if (rb->pbo) {
+            glDeleteBuffers(1, &rb->pbo);
+        }
+    #endif
+    _sg_clear(rb, sizeof(sg_gl_readback));
+}
+
 SOKOL_API_IMPL sg_gl_view_info sg_gl_query_view_info(sg_view view_id) {
     SOKOL_ASSERT(_sg.valid);
     sg_gl_view_info res;
@@ -22941,6 +25714,56 @@ SOKOL_API_IMPL sg_gl_view_info sg_gl_query_view_info(sg_view view_id) {
     return res;
 }
 
+SOKOL_API_IMPL sg_dummy_commands sg_dummy_query_commands(void) {
+    SOKOL_ASSERT(_sg.valid);
+    sg_dummy_commands res;
+    _sg_clear(&res, sizeof(res));
+    #if defined(SOKOL_DUMMY_BACKEND)
+        res.data.ptr = _sg.dummy.cmds;
+        res.data.size = (size_t)_sg.dummy.pos * sizeof(uint32_t);
+        res.num_commands = _sg.dummy.num_commands;
+        res.overflow = _sg.dummy.overflow;
+    #endif
+    return res;
+}
+
+SOKOL_API_IMPL void sg_dummy_reset_commands(void) {
+    SOKOL_ASSERT(_sg.valid);
+    #if defined(SOKOL_DUMMY_BACKEND)
+        _sg.dummy.pos = 0;
+        _sg.dummy.num_commands = 0;
+        _sg.dummy.overflow = false;
+    #endif
+}
+
+SOKOL_API_IMPL int sg_dummy_compare_commands(const sg_range* expected) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(expected && (expected->ptr || (0 == expected->size)));
+    const sg_dummy_commands recorded = sg_dummy_query_commands();
+    const uint32_t* words = (const uint32_t*) recorded.data.ptr;
+    const size_t num_words = recorded.data.size / sizeof(uint32_t);
+    // NOTE: the expected data may be unaligned, so only access it through memcmp
+    const uint8_t* expected_bytes = (const uint8_t*) expected->ptr;
+    const size_t num_expected_words = expected->size / sizeof(uint32_t);
+    size_t pos = 0;
+    int cmd_index = 0;
+    while ((pos < num_words) && (pos < num_expected_words)) {
+        const size_t cmd_words = 1 + (words[pos] >> 16);
+        if ((pos + cmd_words) > num_expected_words) {
+            return cmd_index;
+        }
+        if (0 != memcmp(&words[pos], expected_bytes + pos * sizeof(uint32_t), cmd_words * sizeof(uint32_t))) {
+            return cmd_index;
+        }
+        pos += cmd_words;
+        cmd_index++;
+    }
+    if ((pos < num_words) || (pos < num_expected_words)) {
+        return cmd_index;
+    }
+    return -1;
+}
+
 #ifdef _MSC_VER
 #pragma warning(pop)
 #endif
@@ -0,0 +1,1071 @@
+#if defined(SOKOL_IMPL) && !defined(SOKOL_HUD_IMPL)
+#define SOKOL_HUD_IMPL
+#endif
+#ifndef SOKOL_HUD_INCLUDED
+/*
+    sokol_hud.h -- a performance overlay for sokol_gfx.h applications
+
+    Project URL: https://github.com/floooh/sokol
+
+    Do this:
+        #define SOKOL_IMPL or
+        #define SOKOL_HUD_IMPL
+    before you include this file in *one* C or C++ file to create the
+    implementation.
+
+    ...optionally provide the following macros to override defaults:
+
+    SOKOL_ASSERT(c)     - your own assert macro (default: assert(c))
+    SOKOL_HUD_API_DECL  - public function declaration prefix (default: extern)
+    SOKOL_API_DECL      - same as SOKOL_HUD_API_DECL
+    SOKOL_API_IMPL      - public function implementation prefix (default: -)
+    SOKOL_UNREACHABLE() - a guard macro for unreachable code (default: assert(false))
+
+    If sokol_hud.h is compiled as a DLL, define the following before
+    including the declaration or implementation:
+
+    SOKOL_DLL
+
+    On Windows, SOKOL_DLL will define SOKOL_HUD_API_DECL as __declspec(dllexport)
+    or __declspec(dllimport) as needed.
+
+    Include the following headers before including sokol_hud.h:
+
+        sokol_gfx.h
+        sokol_time.h
+        sokol_app.h (optional, for shud_handle_event())
+
+    OVERVIEW
+    ========
+    sokol_hud.h renders a small performance overlay into a corner of the
+    window, with:
+
+    - the duration of the last frame, and the average, minimum and maximum
+      frame duration over the recorded frame history
+    - a bar graph of the recorded frame durations, with a reference line at
+      the target frame duration (bars above the target are yellow, bars above
+      twice the target are red)
+    - the sg_frame_stats counters of the previous frame: number of draw calls,
+      elements, instances and primitives, pipeline and bindings switches, and
+      the number of bytes uploaded into buffers and images
+    - the number of live sokol-gfx buffers, images and pipelines
+    - the resident memory of the process (only on Linux and macOS)
+    - the CPU time spent in shud_draw() itself
+
+    The whole overlay is rendered with a single instanced draw call, each
+    glyph or rectangle is one instance of a quad. The font is a built-in 5x7
+    pixel font which only has upper-case ASCII characters (lower-case
+    characters are rendered as upper-case). The text is only re-formatted every
+    few frames (see shud_desc.text_update_interval), so that the numbers
+    remain readable, the frame time graph is updated every frame.
+
+    The built-in shaders are only provided for the GL backends (SOKOL_GLCORE
+    and SOKOL_GLES3). With other backends, shud_setup() logs an error
+    and shud_draw() only records frame durations.
+
+    STEP BY STEP
+    ============
+    --- after stm_setup() and sg_setup(), call shud_setup():
+
+            shud_setup(&(shud_desc){
+                .logger.func = slog_func,
+            });
+
+        The following shud_desc items are optional:
+
+        .corner         - the window corner of the overlay (default: SHUD_CORNER_TOP_LEFT)
+        .scale          - the size of one font pixel in framebuffer pixels (default: 2)
+        .max_frames     - the number of frame durations in the graph (default: 120)
+        .target_frame_time_ms - the reference line in the frame time graph
+                          (default: 16.667)
+        .text_update_interval - number of frames between text updates (default: 30)
+        .toggle_key     - the sokol_app.h keycode which shows or hides the overlay in
+                          shud_handle_event() (default: SAPP_KEYCODE_F10)
+        .color_format   - the color pixel format of the render pass
+        .depth_format   - the depth pixel format of the render pass
+        .sample_count   - the MSAA sample count of the render pass
+        .allocator      - optional memory allocation callbacks
+        .logger         - optional logging callback
+
+        ...the pixel formats and sample count default to the sg_desc.environment
+        defaults, so they only need to be provided if the overlay is rendered
+        into an offscreen pass.
+
+    --- at the end of the frame, inside the swapchain render pass, call:
+
+            shud_draw(sapp_width(), sapp_height());
+
+        ...shud_draw() should be called exactly once per frame, since the
+        frame duration is measured as the time between two shud_draw() calls.
+        It also calls sg_update_buffer() on its own instance buffer.
+
+    --- optionally with sokol_app.h, forward input events to shud_handle_event()
+        to show or hide the overlay with the toggle key:
+
+            static void event(const sapp_event* ev) {
+                if (shud_handle_event(ev)) {
+                    return;
+                }
+                ...
+            }
+
+        ...or call shud_set_visible() directly. A hidden overlay still records
+        the frame durations, but doesn't render anything.
+
+    --- before sg_shutdown(), call:
+
+            shud_shutdown();
+
+    Since the overlay is rendered with sokol-gfx, its own draw call, buffer
+    update and uniform update show up in the sg_frame_stats counters.
+
+    MEMORY ALLOCATION OVERRIDE
+    ==========================
+    You can override the memory allocation functions at initialization time
+    like this:
+
+        void* my_alloc(size_t size, void* user_data) {
+            return malloc(size);
+        }
+
+        void my_free(void* ptr, void* user_data) {
+            free(ptr);
+        }
+
+        ...
+            shud_setup(&(shud_desc){
+                // ...
+                .allocator = {
+                    .alloc_fn = my_alloc,
+                    .free_fn = my_free,
+                    .user_data = ...,
+                }
+            });
+        ...
+
+    If no overrides are provided, malloc and free will be used.
+
+    ERROR REPORTING AND LOGGING
+    ===========================
+    To get any logging information at all you need to provide a logging callback in the setup call,
+    the easiest way is to use sokol_log.h:
+
+        #include "sokol_log.h"
+
+        shud_setup(&(shud_desc){
+            .logger.func = slog_func
+        });
+
+    LICENSE
+    =======
+    zlib/libpng license
+
+    Copyright (c) 2026 the sokol contributors
+
+    This software is provided 'as-is', without any express or implied warranty.
+    In no event will the authors be held liable for any damages arising from the
+    use of this software.
+
+    Permission is granted to anyone to use this software for any purpose,
+    including commercial applications, and to alter it and redistribute it
+    freely, subject to the following restrictions:
+
+        1. The origin of this software must not be misrepresented; you must not
+        claim that you wrote the original software. If you use this software in a
+        product, an acknowledgment in the product documentation would be
+        appreciated but is not required.
+
+        2. Altered source versions must be plainly marked as such, and must not
+        be misrepresented as being the original software.
+
+        3. This notice may not be removed or altered from any source
+        distribution.
+*/
+#define SOKOL_HUD_INCLUDED (1)
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h> // size_t
+
+#if !defined(SOKOL_GFX_INCLUDED)
+#error "Please include sokol_gfx.h before sokol_hud.h"
+#endif
+#if !defined(SOKOL_TIME_INCLUDED)
+#error "Please include sokol_time.h before sokol_hud.h"
+#endif
+
+#if defined(SOKOL_API_DECL) && !defined(SOKOL_HUD_API_DECL)
+#define SOKOL_HUD_API_DECL SOKOL_API_DECL
+#endif
+#ifndef SOKOL_HUD_API_DECL
+#if defined(_WIN32) && defined(SOKOL_DLL) && defined(SOKOL_HUD_IMPL)
+#define SOKOL_HUD_API_DECL __declspec(dllexport)
+#elif defined(_WIN32) && defined(SOKOL_DLL)
+#define SOKOL_HUD_API_DECL __declspec(dllimport)
+#else
+#define SOKOL_HUD_API_DECL extern
+#endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+    shud_log_item_t
+
+    Log items are defined via X-Macros, and expanded to an
+    enum 'shud_log_item' - and in debug mode only - corresponding strings.
+
+    Used as parameter in the logging callback.
+*/
+#define _SHUD_LOG_ITEMS \
+    _SHUD_LOGITEM_XMACRO(OK, "Ok") \
+    _SHUD_LOGITEM_XMACRO(MALLOC_FAILED, "memory allocation failed") \
+    _SHUD_LOGITEM_XMACRO(UNSUPPORTED_BACKEND, "sokol_hud.h only has shaders for the GL backends, overlay disabled") \
+    _SHUD_LOGITEM_XMACRO(CREATE_RESOURCES_FAILED, "failed to create the sokol-gfx resources for the overlay") \
+    _SHUD_LOGITEM_XMACRO(QUADS_FULL, "shud_draw(): quad buffer full (increase shud_desc.max_quads)") \
+
+#define _SHUD_LOGITEM_XMACRO(item,msg) SHUD_LOGITEM_##item,
+typedef enum shud_log_item_t {
+    _SHUD_LOG_ITEMS
+} shud_log_item_t;
+#undef _SHUD_LOGITEM_XMACRO
+
+/*
+    shud_allocator_t
+
+    Used in shud_desc to provide custom memory-alloc and -free functions
+    to sokol_hud.h. If memory management should be overridden, both the
+    alloc_fn and free_fn function must be provided (e.g. it's not valid to
+    override one function but not the other).
+*/
+typedef struct shud_allocator_t {
+    void* (*alloc_fn)(size_t size, void* user_data);
+    void (*free_fn)(void* ptr, void* user_data);
+    void* user_data;
+} shud_allocator_t;
+
+/*
+    shud_logger_t
+
+    Used in shud_desc to provide a logging function. Please be aware that
+    without logging function, sokol-hud will be completely silent, e.g. it will
+    not report errors or warnings. For maximum error verbosity, compile in
+    debug mode (e.g. NDEBUG *not* defined) and install a logger (for instance
+    the standard logging function from sokol_log.h).
+*/
+typedef struct shud_logger_t {
+    void (*func)(
+        const char* tag,                // always "shud"
+        uint32_t log_level,             // 0=panic, 1=error, 2=warning, 3=info
+        uint32_t log_item_id,           // SHUD_LOGITEM_*
+        const char* message_or_null,    // a message string, may be nullptr in release mode
+        uint32_t line_nr,               // line number in sokol_hud.h
+        const char* filename_or_null,   // source filename, may be nullptr in release mode
+        void* user_data);
+    void* user_data;
+} shud_logger_t;
+
+/*
+    shud_corner
+
+    The window corner the overlay is rendered into.
+*/
+typedef enum shud_corner {
+    _SHUD_CORNER_DEFAULT,   // value 0 reserved for default-init
+    SHUD_CORNER_TOP_LEFT,
+    SHUD_CORNER_TOP_RIGHT,
+    SHUD_CORNER_BOTTOM_LEFT,
+    SHUD_CORNER_BOTTOM_RIGHT,
+    _SHUD_CORNER_FORCE_U32 = 0x7FFFFFFF
+} shud_corner;
+
+/*
+    shud_desc
+
+    The setup parameters for shud_setup(), see the documentation
+    section STEP BY STEP for details.
+*/
+typedef struct shud_desc {
+    shud_corner corner;             // default: SHUD_CORNER_TOP_LEFT
+    float scale;                    // size of a font pixel in framebuffer pixels (default: 2)
+    int max_frames;                 // number of frame durations in the graph (default: 120)
+    int max_quads;                  // max number of rendered glyphs and rectangles (default: 1024)
+    float target_frame_time_ms;     // the reference line in the graph (default: 16.667)
+    int text_update_interval;       // number of frames between text updates (default: 30)
+    int toggle_key;                 // sapp_keycode for shud_handle_event() (default: SAPP_KEYCODE_F10)
+    sg_pixel_format color_format;   // default: sg_desc.environment.defaults.color_format
+    sg_pixel_format depth_format;   // default: sg_desc.environment.defaults.depth_format
+    int sample_count;               // default: sg_desc.environment.defaults.sample_count
+    shud_allocator_t allocator;
+    shud_logger_t logger;
+} shud_desc;
+
+/* setup and shutdown */
+SOKOL_HUD_API_DECL void shud_setup(const shud_desc* desc);
+SOKOL_HUD_API_DECL void shud_shutdown(void);
+/* record the frame duration and render the overlay, call once per frame inside a render pass */
+SOKOL_HUD_API_DECL void shud_draw(int width, int height);
+/* show or hide the overlay */
+SOKOL_HUD_API_DECL void shud_set_visible(bool visible);
+SOKOL_HUD_API_DECL bool shud_visible(void);
+#if defined(SOKOL_APP_INCLUDED)
+/* toggle the overlay when the toggle key is pressed, returns true if the event was handled */
+SOKOL_HUD_API_DECL bool shud_handle_event(const sapp_event* ev);
+#endif
+
+#ifdef __cplusplus
+} // extern "C"
+
+// reference-based equivalents for C++
+inline void shud_setup(const shud_desc& desc) { return shud_setup(&desc); }
+
+#endif
+#endif // SOKOL_HUD_INCLUDED
+
+// ██ ███    ███ ██████  ██      ███████ ███    ███ ███████ ███    ██ ████████  █████  ████████ ██  ██████  ███    ██
+// ██ ████  ████ ██   ██ ██      ██      ████  ████ ██      ████   ██    ██    ██   ██    ██    ██ ██    ██ ████   ██
+// ██ ██ ████ ██ ██████  ██      █████   ██ ████ ██ █████   ██ ██  ██    ██    ███████    ██    ██ ██    ██ ██ ██  ██
+// ██ ██  ██  ██ ██      ██      ██      ██  ██  ██ ██      ██  ██ ██    ██    ██   ██    ██    ██ ██    ██ ██  ██ ██
+// ██ ██      ██ ██      ███████ ███████ ██      ██ ███████ ██   ████    ██    ██   ██    ██    ██  ██████  ██   ████
+//
+// >>implementation
+#ifdef SOKOL_HUD_IMPL
+#define SOKOL_HUD_IMPL_INCLUDED (1)
+
+#include <stdlib.h> // malloc, free
+#include <string.h> // memset
+#include <stdio.h>  // snprintf, fopen, fscanf, fclose
+#if defined(__linux__)
+    #include <unistd.h> // sysconf
+#elif defined(__APPLE__)
+    #include <mach/mach.h>
+#endif
+
+#ifndef SOKOL_API_IMPL
+    #define SOKOL_API_IMPL
+#endif
+#ifndef SOKOL_DEBUG
+    #ifndef NDEBUG
+        #define SOKOL_DEBUG
+    #endif
+#endif
+#ifndef SOKOL_ASSERT
+    #include <assert.h>
+    #define SOKOL_ASSERT(c) assert(c)
+#endif
+#ifndef _SOKOL_PRIVATE
+    #if defined(__GNUC__) || defined(__clang__)
+        #define _SOKOL_PRIVATE __attribute__((unused)) static
+    #else
+        #define _SOKOL_PRIVATE static
+    #endif
+#endif
+#ifndef _SOKOL_UNUSED
+    #define _SOKOL_UNUSED(x) (void)(x)
+#endif
+
+#define _SHUD_DEFAULT_SCALE (2.0f)
+#define _SHUD_DEFAULT_MAX_FRAMES (120)
+#define _SHUD_DEFAULT_MAX_QUADS (1024)
+#define _SHUD_DEFAULT_TARGET_FRAME_TIME_MS (16.667f)
+#define _SHUD_DEFAULT_TEXT_UPDATE_INTERVAL (30)
+#define _SHUD_DEFAULT_TOGGLE_KEY (299)  // SAPP_KEYCODE_F10
+
+// the font atlas has one 8x8 cell per glyph (ASCII 32..95), followed by a solid cell for rectangles
+#define _SHUD_GLYPH_WIDTH (5)
+#define _SHUD_GLYPH_HEIGHT (7)
+#define _SHUD_NUM_GLYPHS (64)
+#define _SHUD_CELL_SIZE (8)
+#define _SHUD_ATLAS_COLUMNS (16)
+#define _SHUD_SOLID_CELL (_SHUD_NUM_GLYPHS)
+#define _SHUD_ATLAS_WIDTH (_SHUD_ATLAS_COLUMNS * _SHUD_CELL_SIZE)
+#define _SHUD_ATLAS_HEIGHT ((_SHUD_NUM_GLYPHS / _SHUD_ATLAS_COLUMNS + 1) * _SHUD_CELL_SIZE)
+
+// the panel layout in font pixels
+#define _SHUD_ADVANCE_X (6)
+#define _SHUD_ADVANCE_Y (10)
+#define _SHUD_PADDING (4)
+#define _SHUD_MARGIN (4)
+#define _SHUD_GRAPH_HEIGHT (32)
+#define _SHUD_LINE_LENGTH (32)
+#define _SHUD_NUM_LINES (8)
+#define _SHUD_NUM_HEADER_LINES (2)   // the text lines above the graph
+
+// RGBA8 colors, red in the lowest byte
+#define _SHUD_COLOR_TEXT (0xFFFFFFFF)
+#define _SHUD_COLOR_PANEL (0xB0000000)
+#define _SHUD_COLOR_GRAPH (0x30FFFFFF)
+#define _SHUD_COLOR_TARGET (0xA0FFFFFF)
+#define _SHUD_COLOR_GOOD (0xFF40E040)
+#define _SHUD_COLOR_SLOW (0xFF00D0FF)
+#define _SHUD_COLOR_BAD (0xFF4040FF)
+
+// one rendered glyph or rectangle, the per-instance vertex data
+typedef struct {
+    float x, y, w, h;       // rectangle in framebuffer pixels
+    float u0, v0, u1, v1;   // texture coordinates in the font atlas
+    uint32_t color;
+} _shud_quad_t;
+
+typedef struct {
+    float disp_size_rcp[4]; // xy: 1.0 / framebuffer size
+} _shud_vs_params_t;
+
+typedef struct {
+    bool valid;
+    bool visible;
+    bool has_resources;     // false if the sokol-gfx resources couldn't be created
+    bool quads_full;
+    shud_desc desc;
+    uint64_t last_time;
+    float* frame_times;     // ring buffer of frame durations in milliseconds
+    int frame_pos;          // next write position in frame_times
+    int num_frame_times;
+    uint32_t frame_count;
+    uint64_t draw_ticks;    // time spent in shud_draw() since the last text update
+    uint32_t num_draws;
+    _shud_quad_t* quads;
+    int num_quads;
+    char lines[_SHUD_NUM_LINES][_SHUD_LINE_LENGTH + 1];
+    sg_buffer buf;
+    sg_image img;
+    sg_view view;
+    sg_sampler smp;
+    sg_shader shd;
+    sg_pipeline pip;
+} _shud_t;
+static _shud_t _shud;
+
+// the 5x7 font for ASCII 32..95, one byte per row, bit 4 is the leftmost pixel
+static const uint8_t _shud_font[_SHUD_NUM_GLYPHS * _SHUD_GLYPH_HEIGHT] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04,  // ' ' '!'
+    0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x0A, 0x1F, 0x0A, 0x1F, 0x0A, 0x0A,  // '"' '#'
+    0x04, 0x0F, 0x14, 0x0E, 0x05, 0x1E, 0x04, 0x18, 0x19, 0x02, 0x04, 0x08, 0x13, 0x03,  // '$' '%'
+    0x0C, 0x12, 0x14, 0x08, 0x15, 0x12, 0x0D, 0x0C, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00,  // '&' '''
+    0x02, 0x04, 0x08, 0x08, 0x08, 0x04, 0x02, 0x08, 0x04, 0x02, 0x02, 0x02, 0x04, 0x08,  // '(' ')'
+    0x00, 0x04, 0x15, 0x0E, 0x15, 0x04, 0x00, 0x00, 0x04, 0x04, 0x1F, 0x04, 0x04, 0x00,  // '*' '+'
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0x04, 0x08, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,  // ',' '-'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00,  // '.' '/'
+    0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E, 0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E,  // '0' '1'
+    0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F, 0x1F, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0E,  // '2' '3'
+    0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02, 0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E,  // '4' '5'
+    0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E, 0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08,  // '6' '7'
+    0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E, 0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C,  // '8' '9'
+    0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x04, 0x08,  // ':' ';'
+    0x02, 0x04, 0x08, 0x10, 0x08, 0x04, 0x02, 0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x00,  // '<' '='
+    0x08, 0x04, 0x02, 0x01, 0x02, 0x04, 0x08, 0x0E, 0x11, 0x01, 0x02, 0x04, 0x00, 0x04,  // '>' '?'
+    0x0E, 0x11, 0x01, 0x0D, 0x15, 0x15, 0x0E, 0x0E, 0x11, 0x11, 0x11, 0x1F, 0x11, 0x11,  // '@' 'A'
+    0x1E, 0x11, 0x11, 0x1E, 0x11, 0x11, 0x1E, 0x0E, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0E,  // 'B' 'C'
+    0x1C, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1C, 0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x1F,  // 'D' 'E'
+    0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10, 0x0E, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0F,  // 'F' 'G'
+    0x11, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11, 0x0E, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E,  // 'H' 'I'
+    0x07, 0x02, 0x02, 0x02, 0x02, 0x12, 0x0C, 0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11,  // 'J' 'K'
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F, 0x11, 0x1B, 0x15, 0x15, 0x11, 0x11, 0x11,  // 'L' 'M'
+    0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E,  // 'N' 'O'
+    0x1E, 0x11, 0x11, 0x1E, 0x10, 0x10, 0x10, 0x0E, 0x11, 0x11, 0x11, 0x15, 0x12, 0x0D,  // 'P' 'Q'
+    0x1E, 0x11, 0x11, 0x1E, 0x14, 0x12, 0x11, 0x0F, 0x10, 0x10, 0x0E, 0x01, 0x01, 0x1E,  // 'R' 'S'
+    0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E,  // 'T' 'U'
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x0A, 0x04, 0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0A,  // 'V' 'W'
+    0x11, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0A, 0x04, 0x04, 0x04,  // 'X' 'Y'
+    0x1F, 0x01, 0x02, 0x04, 0x08, 0x10, 0x1F, 0x0E, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0E,  // 'Z' '['
+    0x00, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0x0E, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0E,  // '\' ']'
+    0x04, 0x0A, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,  // '^' '_'
+};
+
+// ██       ██████   ██████   ██████  ██ ███    ██  ██████
+// ██      ██    ██ ██       ██       ██ ████   ██ ██
+// ██      ██    ██ ██   ███ ██   ███ ██ ██ ██  ██ ██   ███
+// ██      ██    ██ ██    ██ ██    ██ ██ ██  ██ ██ ██    ██
+// ███████  ██████   ██████   ██████  ██ ██   ████  ██████
+//
+// >>logging
+#if defined(SOKOL_DEBUG)
+#define _SHUD_LOGITEM_XMACRO(item,msg) #item ": " msg,
+static const char* _shud_log_messages[] = {
+    _SHUD_LOG_ITEMS
+};
+#undef _SHUD_LOGITEM_XMACRO
+#endif // SOKOL_DEBUG
+
+#define _SHUD_PANIC(code) _shud_log(SHUD_LOGITEM_ ##code, 0, __LINE__)
+#define _SHUD_ERROR(code) _shud_log(SHUD_LOGITEM_ ##code, 1, __LINE__)
+#define _SHUD_WARN(code) _shud_log(SHUD_LOGITEM_ ##code, 2, __LINE__)
+#define _SHUD_INFO(code) _shud_log(SHUD_LOGITEM_ ##code, 3, __LINE__)
+
+static void _shud_log(shud_log_item_t log_item, uint32_t log_level, uint32_t line_nr) {
+    if (_shud.desc.logger.func) {
+        #if defined(SOKOL_DEBUG)
+            const char* filename = __FILE__;
+            const char* message = _shud_log_messages[log_item];
+        #else
+            const char* filename = 0;
+            const char* message = 0;
+        #endif
+        _shud.desc.logger.func("shud", log_level, (uint32_t)log_item, message, line_nr, filename, _shud.desc.logger.user_data);
+    } else {
+        // for log level PANIC it would be 'undefined behaviour' to continue
+        if (log_level == 0) {
+            abort();
+        }
+    }
+}
+
+// ███    ███ ███████ ███    ███  ██████  ██████  ██    ██
+// ████  ████ ██      ████  ████ ██    ██ ██   ██  ██  ██
+// ██ ████ ██ █████   ██ ████ ██ ██    ██ ██████    ████
+// ██  ██  ██ ██      ██  ██  ██ ██    ██ ██   ██    ██
+// ██      ██ ███████ ██      ██  ██████  ██   ██    ██
+//
+// >>memory
+_SOKOL_PRIVATE void _shud_clear(void* ptr, size_t size) {
+    SOKOL_ASSERT(ptr && (size > 0));
+    memset(ptr, 0, size);
+}
+
+_SOKOL_PRIVATE void* _shud_malloc(size_t size) {
+    SOKOL_ASSERT(size > 0);
+    void* ptr;
+    if (_shud.desc.allocator.alloc_fn) {
+        ptr = _shud.desc.allocator.alloc_fn(size, _shud.desc.allocator.user_data);
+    } else {
+        ptr = malloc(size);
+    }
+    if (0 == ptr) {
+        _SHUD_PANIC(MALLOC_FAILED);
+    }
+    return ptr;
+}
+
+_SOKOL_PRIVATE void* _shud_malloc_clear(size_t size) {
+    void* ptr = _shud_malloc(size);
+    _shud_clear(ptr, size);
+    return ptr;
+}
+
+_SOKOL_PRIVATE void _shud_free(void* ptr) {
+    if (_shud.desc.allocator.free_fn) {
+        _shud.desc.allocator.free_fn(ptr, _shud.desc.allocator.user_data);
+    } else {
+        free(ptr);
+    }
+}
+
+// ██████  ███████ ███████  ██████  ██    ██ ██████   ██████ ███████ ███████
+// ██   ██ ██      ██      ██    ██ ██    ██ ██   ██ ██      ██      ██
+// ██████  █████   ███████ ██    ██ ██    ██ ██████  ██      █████   ███████
+// ██   ██ ██           ██ ██    ██ ██    ██ ██   ██ ██      ██           ██
+// ██   ██ ███████ ███████  ██████   ██████  ██   ██  ██████ ███████ ███████
+//
+// >>resources
+static const char* _shud_vs_source_glsl410 =
+    "#version 410\n"
+    "uniform vec4 vs_params;\n"
+    "layout(location=0) in vec4 rect;\n"
+    "layout(location=1) in vec4 uv_rect;\n"
+    "layout(location=2) in vec4 color0;\n"
+    "out vec2 uv;\n"
+    "out vec4 color;\n"
+    "void main() {\n"
+    "    vec2 corner = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1));\n"
+    "    vec2 pos = (rect.xy + rect.zw * corner) * vs_params.xy;\n"
+    "    gl_Position = vec4(pos.x * 2.0 - 1.0, 1.0 - pos.y * 2.0, 0.0, 1.0);\n"
+    "    uv = mix(uv_rect.xy, uv_rect.zw, corner);\n"
+    "    color = color0;\n"
+    "}\n";
+
+static const char* _shud_fs_source_glsl410 =
+    "#version 410\n"
+    "uniform sampler2D tex;\n"
+    "in vec2 uv;\n"
+    "in vec4 color;\n"
+    "layout(location=0) out vec4 frag_color;\n"
+    "void main() {\n"
+    "    frag_color = vec4(color.rgb, color.a * texture(tex, uv).r);\n"
+    "}\n";
+
+static const char* _shud_vs_source_glsl300es =
+    "#version 300 es\n"
+    "uniform vec4 vs_params;\n"
+    "layout(location=0) in vec4 rect;\n"
+    "layout(location=1) in vec4 uv_rect;\n"
+    "layout(location=2) in vec4 color0;\n"
+    "out vec2 uv;\n"
+    "out vec4 color;\n"
+    "void main() {\n"
+    "    vec2 corner = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1));\n"
+    "    vec2 pos = (rect.xy + rect.zw * corner) * vs_params.xy;\n"
+    "    gl_Position = vec4(pos.x * 2.0 - 1.0, 1.0 - pos.y * 2.0, 0.0, 1.0);\n"
+    "    uv = mix(uv_rect.xy, uv_rect.zw, corner);\n"
+    "    color = color0;\n"
+    "}\n";
+
+static const char* _shud_fs_source_glsl300es =
+    "#version 300 es\n"
+    "precision mediump float;\n"
+    "uniform sampler2D tex;\n"
+    "in vec2 uv;\n"
+    "in vec4 color;\n"
+    "layout(location=0) out vec4 frag_color;\n"
+    "void main() {\n"
+    "    frag_color = vec4(color.rgb, color.a * texture(tex, uv).r);\n"
+    "}\n";
+
+// expand the 1-bit font into an R8 atlas with a solid cell at the end
+_SOKOL_PRIVATE void _shud_init_atlas(uint8_t* pixels) {
+    for (int glyph = 0; glyph < _SHUD_NUM_GLYPHS; glyph++) {
+        const int x0 = (glyph % _SHUD_ATLAS_COLUMNS) * _SHUD_CELL_SIZE;
+        const int y0 = (glyph / _SHUD_ATLAS_COLUMNS) * _SHUD_CELL_SIZE;
+        for (int y = 0; y < _SHUD_GLYPH_HEIGHT; y++) {
+            const uint8_t bits = _shud_font[glyph * _SHUD_GLYPH_HEIGHT + y];
+            for (int x = 0; x < _SHUD_GLYPH_WIDTH; x++) {
+                if (bits & (0x10 >> x)) {
+                    pixels[(y0 + y) * _SHUD_ATLAS_WIDTH + x0 + x] = 0xFF;
+                }
+            }
+        }
+    }
+    const int x0 = (_SHUD_SOLID_CELL % _SHUD_ATLAS_COLUMNS) * _SHUD_CELL_SIZE;
+    const int y0 = (_SHUD_SOLID_CELL / _SHUD_ATLAS_COLUMNS) * _SHUD_CELL_SIZE;
+    for (int y = 0; y < _SHUD_CELL_SIZE; y++) {
+        memset(&pixels[(y0 + y) * _SHUD_ATLAS_WIDTH + x0], 0xFF, _SHUD_CELL_SIZE);
+    }
+}
+
+_SOKOL_PRIVATE bool _shud_setup_resources(void) {
+    const sg_backend backend = sg_query_backend();
+    const bool gles = (SG_BACKEND_GLES3 == backend);
+    if (!gles && (SG_BACKEND_GLCORE != backend) && (SG_BACKEND_DUMMY != backend)) {
+        _SHUD_ERROR(UNSUPPORTED_BACKEND);
+        return false;
+    }
+
+    sg_buffer_desc buf_desc;
+    _shud_clear(&buf_desc, sizeof(buf_desc));
+    buf_desc.size = (size_t)_shud.desc.max_quads * sizeof(_shud_quad_t);
+    buf_desc.usage.stream_update = true;
+    buf_desc.label = "shud-quads";
+    _shud.buf = sg_make_buffer(&buf_desc);
+
+    const size_t atlas_size = _SHUD_ATLAS_WIDTH * _SHUD_ATLAS_HEIGHT;
+    uint8_t* pixels = (uint8_t*) _shud_malloc_clear(atlas_size);
+    _shud_init_atlas(pixels);
+    sg_image_desc img_desc;
+    _shud_clear(&img_desc, sizeof(img_desc));
+    img_desc.width = _SHUD_ATLAS_WIDTH;
+    img_desc.height = _SHUD_ATLAS_HEIGHT;
+    img_desc.pixel_format = SG_PIXELFORMAT_R8;
+    img_desc.data.mip_levels[0].ptr = pixels;
+    img_desc.data.mip_levels[0].size = atlas_size;
+    img_desc.label = "shud-font";
+    _shud.img = sg_make_image(&img_desc);
+    _shud_free(pixels);
+
+    sg_view_desc view_desc;
+    _shud_clear(&view_desc, sizeof(view_desc));
+    view_desc.texture.image = _shud.img;
+    view_desc.label = "shud-font-view";
+    _shud.view = sg_make_view(&view_desc);
+
+    sg_sampler_desc smp_desc;
+    _shud_clear(&smp_desc, sizeof(smp_desc));
+    smp_desc.min_filter = SG_FILTER_NEAREST;
+    smp_desc.mag_filter = SG_FILTER_NEAREST;
+    smp_desc.wrap_u = SG_WRAP_CLAMP_TO_EDGE;
+    smp_desc.wrap_v = SG_WRAP_CLAMP_TO_EDGE;
+    smp_desc.label = "shud-sampler";
+    _shud.smp = sg_make_sampler(&smp_desc);
+
+    sg_shader_desc shd_desc;
+    _shud_clear(&shd_desc, sizeof(shd_desc));
+    shd_desc.vertex_func.source = gles ? _shud_vs_source_glsl300es : _shud_vs_source_glsl410;
+    shd_desc.fragment_func.source = gles ? _shud_fs_source_glsl300es : _shud_fs_source_glsl410;
+    shd_desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+    shd_desc.attrs[0].glsl_name = "rect";
+    shd_desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+    shd_desc.attrs[1].glsl_name = "uv_rect";
+    shd_desc.attrs[2].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+    shd_desc.attrs[2].glsl_name = "color0";
+    shd_desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+    shd_desc.uniform_blocks[0].size = sizeof(_shud_vs_params_t);
+    shd_desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+    shd_desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
+    shd_desc.views[0].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+    shd_desc.views[0].texture.image_type = SG_IMAGETYPE_2D;
+    shd_desc.views[0].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+    shd_desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+    shd_desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+    shd_desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+    shd_desc.texture_sampler_pairs[0].view_slot = 0;
+    shd_desc.texture_sampler_pairs[0].sampler_slot = 0;
+    shd_desc.texture_sampler_pairs[0].glsl_name = "tex";
+    shd_desc.label = "shud-shader";
+    _shud.shd = sg_make_shader(&shd_desc);
+
+    // one instance per quad, the quad corners are derived from gl_VertexID
+    sg_pipeline_desc pip_desc;
+    _shud_clear(&pip_desc, sizeof(pip_desc));
+    pip_desc.shader = _shud.shd;
+    pip_desc.layout.buffers[0].stride = sizeof(_shud_quad_t);
+    pip_desc.layout.buffers[0].step_func = SG_VERTEXSTEP_PER_INSTANCE;
+    pip_desc.layout.attrs[0].offset = offsetof(_shud_quad_t, x);
+    pip_desc.layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT4;
+    pip_desc.layout.attrs[1].offset = offsetof(_shud_quad_t, u0);
+    pip_desc.layout.attrs[1].format = SG_VERTEXFORMAT_FLOAT4;
+    pip_desc.layout.attrs[2].offset = offsetof(_shud_quad_t, color);
+    pip_desc.layout.attrs[2].format = SG_VERTEXFORMAT_UBYTE4N;
+    pip_desc.primitive_type = SG_PRIMITIVETYPE_TRIANGLE_STRIP;
+    pip_desc.depth.pixel_format = _shud.desc.depth_format;
+    pip_desc.depth.compare = SG_COMPAREFUNC_ALWAYS;
+    pip_desc.colors[0].pixel_format = _shud.desc.color_format;
+    pip_desc.colors[0].blend.enabled = true;
+    pip_desc.colors[0].blend.src_factor_rgb = SG_BLENDFACTOR_SRC_ALPHA;
+    pip_desc.colors[0].blend.dst_factor_rgb = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
+    pip_desc.colors[0].blend.src_factor_alpha = SG_BLENDFACTOR_ONE;
+    pip_desc.colors[0].blend.dst_factor_alpha = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
+    pip_desc.sample_count = _shud.desc.sample_count;
+    pip_desc.label = "shud-pipeline";
+    _shud.pip = sg_make_pipeline(&pip_desc);
+
+    if ((SG_RESOURCESTATE_VALID != sg_query_pipeline_state(_shud.pip)) ||
+        (SG_RESOURCESTATE_VALID != sg_query_buffer_state(_shud.buf)) ||
+        (SG_RESOURCESTATE_VALID != sg_query_view_state(_shud.view)) ||
+        (SG_RESOURCESTATE_VALID != sg_query_sampler_state(_shud.smp)))
+    {
+        _SHUD_ERROR(CREATE_RESOURCES_FAILED);
+        return false;
+    }
+    return true;
+}
+
+_SOKOL_PRIVATE void _shud_discard_resources(void) {
+    // NOTE: destroying invalid handles is a no-op
+    sg_destroy_pipeline(_shud.pip);
+    sg_destroy_shader(_shud.shd);
+    sg_destroy_sampler(_shud.smp);
+    sg_destroy_view(_shud.view);
+    sg_destroy_image(_shud.img);
+    sg_destroy_buffer(_shud.buf);
+}
+
+// ██   ██ ███████ ██      ██████  ███████ ██████  ███████
+// ██   ██ ██      ██      ██   ██ ██      ██   ██ ██
+// ███████ █████   ██      ██████  █████   ██████  ███████
+// ██   ██ ██      ██      ██      ██      ██   ██      ██
+// ██   ██ ███████ ███████ ██      ███████ ██   ██ ███████
+//
+// >>helpers
+// format a counter with a K/M/G suffix
+_SOKOL_PRIVATE void _shud_format_count(char* buf, size_t buf_size, uint64_t val) {
+    if (val < 10000) {
+        snprintf(buf, buf_size, "%u", (unsigned)val);
+    } else if (val < 10000000) {
+        snprintf(buf, buf_size, "%.1fK", (double)val / 1e3);
+    } else if (val < 10000000000ULL) {
+        snprintf(buf, buf_size, "%.1fM", (double)val / 1e6);
+    } else {
+        snprintf(buf, buf_size, "%.1fG", (double)val / 1e9);
+    }
+}
+
+_SOKOL_PRIVATE void _shud_format_bytes(char* buf, size_t buf_size, uint64_t val) {
+    if (val < 1024) {
+        snprintf(buf, buf_size, "%u B", (unsigned)val);
+    } else if (val < (1024 * 1024)) {
+        snprintf(buf, buf_size, "%.1f KB", (double)val / 1024.0);
+    } else if (val < (1024 * 1024 * 1024)) {
+        snprintf(buf, buf_size, "%.1f MB", (double)val / (1024.0 * 1024.0));
+    } else {
+        snprintf(buf, buf_size, "%.2f GB", (double)val / (1024.0 * 1024.0 * 1024.0));
+    }
+}
+
+// the resident memory of the process in bytes, or 0 if unknown
+_SOKOL_PRIVATE uint64_t _shud_resident_bytes(void) {
+    #if defined(__linux__)
+        uint64_t res = 0;
+        FILE* fp = fopen("/proc/self/statm", "r");
+        if (fp) {
+            unsigned long size = 0, resident = 0;
+            if (2 == fscanf(fp, "%lu %lu", &size, &resident)) {
+                const long page_size = sysconf(_SC_PAGESIZE);
+                res = (uint64_t)resident * (uint64_t)((page_size > 0) ? page_size : 4096);
+            }
+            fclose(fp);
+        }
+        return res;
+    #elif defined(__APPLE__)
+        mach_task_basic_info_data_t info;
+        mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+        if (KERN_SUCCESS == task_info(mach_task_self(), MACH_TASK_BASIC_INFO, (task_info_t)&info, &count)) {
+            return (uint64_t)info.resident_size;
+        }
+        return 0;
+    #else
+        return 0;
+    #endif
+}
+
+_SOKOL_PRIVATE float _shud_last_frame_time(void) {
+    if (0 == _shud.num_frame_times) {
+        return 0.0f;
+    }
+    const int max_frames = _shud.desc.max_frames;
+    return _shud.frame_times[(_shud.frame_pos + max_frames - 1) % max_frames];
+}
+
+_SOKOL_PRIVATE void _shud_update_text(void) {
+    float sum = 0.0f;
+    float min = 0.0f;
+    float max = 0.0f;
+    for (int i = 0; i < _shud.num_frame_times; i++) {
+        const float t = _shud.frame_times[i];
+        sum += t;
+        min = ((0 == i) || (t < min)) ? t : min;
+        max = ((0 == i) || (t > max)) ? t : max;
+    }
+    const float avg = (_shud.num_frame_times > 0) ? (sum / (float)_shud.num_frame_times) : 0.0f;
+    const float last = _shud_last_frame_time();
+    const double draw_ms = (_shud.num_draws > 0) ? (stm_ms(_shud.draw_ticks) / (double)_shud.num_draws) : 0.0;
+    _shud.draw_ticks = 0;
+    _shud.num_draws = 0;
+
+    // NOTE: the frame stats are from the previous frame
+    const sg_frame_stats stats = sg_query_frame_stats();
+    char str0[10], str1[10];
+    const size_t len = sizeof(_shud.lines[0]);
+    snprintf(_shud.lines[0], len, "FRAME %6.2f MS %6.1f FPS", (double)last, (last > 0.0f) ? (1000.0 / (double)last) : 0.0);
+    snprintf(_shud.lines[1], len, "AVG %.2f MIN %.2f MAX %.2f", (double)avg, (double)min, (double)max);
+    _shud_format_count(str0, sizeof(str0), stats.num_primitives);
+    snprintf(_shud.lines[2], len, "DRAW %u PRIM %s", stats.num_draw + stats.num_draw_ex, str0);
+    _shud_format_count(str0, sizeof(str0), stats.num_elements);
+    _shud_format_count(str1, sizeof(str1), stats.num_instances);
+    snprintf(_shud.lines[3], len, "ELEM %s INST %s", str0, str1);
+    snprintf(_shud.lines[4], len, "PIP %u/%u BIND %u/%u",
+        stats.num_pipeline_switches, stats.num_apply_pipeline,
+        stats.num_bindings_switches, stats.num_apply_bindings);
+    _shud_format_bytes(str0, sizeof(str0), stats.size_uploaded);
+    snprintf(_shud.lines[5], len, "UPLOAD %s", str0);
+    snprintf(_shud.lines[6], len, "BUF %u IMG %u PIP %u",
+        stats.buffers.total_alive, stats.images.total_alive, stats.pipelines.total_alive);
+    const uint64_t resident = _shud_resident_bytes();
+    if (resident > 0) {
+        _shud_format_bytes(str0, sizeof(str0), resident);
+    } else {
+        snprintf(str0, sizeof(str0), "N/A");
+    }
+    snprintf(_shud.lines[7], len, "MEM %s HUD %.3f MS", str0, draw_ms);
+}
+
+_SOKOL_PRIVATE _shud_quad_t* _shud_next_quad(void) {
+    if (_shud.num_quads >= _shud.desc.max_quads) {
+        if (!_shud.quads_full) {
+            _SHUD_WARN(QUADS_FULL);
+            _shud.quads_full = true;
+        }
+        return 0;
+    }
+    return &_shud.quads[_shud.num_quads++];
+}
+
+_SOKOL_PRIVATE void _shud_rect(float x, float y, float w, float h, uint32_t color) {
+    _shud_quad_t* q = _shud_next_quad();
+    if (q) {
+        // sample the middle of the solid atlas cell
+        const float u = (float)((_SHUD_SOLID_CELL % _SHUD_ATLAS_COLUMNS) * _SHUD_CELL_SIZE + _SHUD_CELL_SIZE / 2) / (float)_SHUD_ATLAS_WIDTH;
+        const float v = (float)((_SHUD_SOLID_CELL / _SHUD_ATLAS_COLUMNS) * _SHUD_CELL_SIZE + _SHUD_CELL_SIZE / 2) / (float)_SHUD_ATLAS_HEIGHT;
+        q->x = x; q->y = y; q->w = w; q->h = h;
+        q->u0 = u; q->v0 = v; q->u1 = u; q->v1 = v;
+        q->color = color;
+    }
+}
+
+_SOKOL_PRIVATE void _shud_text(float x, float y, const char* str, uint32_t color) {
+    const float s = _shud.desc.scale;
+    for (; *str; str++, x += _SHUD_ADVANCE_X * s) {
+        int c = (unsigned char)*str;
+        if ((c >= 'a') && (c <= 'z')) {
+            c -= 'a' - 'A';
+        }
+        if (c == ' ') {
+            continue;
+        }
+        if ((c < 32) || (c >= (32 + _SHUD_NUM_GLYPHS))) {
+            c = '?';
+        }
+        _shud_quad_t* q = _shud_next_quad();
+        if (0 == q) {
+            return;
+        }
+        const int glyph = c - 32;
+        q->x = x; q->y = y;
+        q->w = _SHUD_GLYPH_WIDTH * s;
+        q->h = _SHUD_GLYPH_HEIGHT * s;
+        q->u0 = (float)((glyph % _SHUD_ATLAS_COLUMNS) * _SHUD_CELL_SIZE) / (float)_SHUD_ATLAS_WIDTH;
+        q->v0 = (float)((glyph / _SHUD_ATLAS_COLUMNS) * _SHUD_CELL_SIZE) / (float)_SHUD_ATLAS_HEIGHT;
+        q->u1 = q->u0 + (float)_SHUD_GLYPH_WIDTH / (float)_SHUD_ATLAS_WIDTH;
+        q->v1 = q->v0 + (float)_SHUD_GLYPH_HEIGHT / (float)_SHUD_ATLAS_HEIGHT;
+        q->color = color;
+    }
+}
+
+_SOKOL_PRIVATE void _shud_graph(float x, float y, float w, float h) {
+    _shud_rect(x, y, w, h, _SHUD_COLOR_GRAPH);
+    // the graph range is twice the target frame time, the newest frame is on the right
+    const int max_frames = _shud.desc.max_frames;
+    const float target = _shud.desc.target_frame_time_ms;
+    const float bar_w = w / (float)max_frames;
+    const int first = _shud.frame_pos + max_frames - _shud.num_frame_times;
+    for (int i = 0; i < _shud.num_frame_times; i++) {
+        const float t = _shud.frame_times[(first + i) % max_frames];
+        const float bar_h = (t < 2.0f * target) ? (h * t / (2.0f * target)) : h;
+        uint32_t color = _SHUD_COLOR_GOOD;
+        if (t > 2.0f * target) {
+            color = _SHUD_COLOR_BAD;
+        } else if (t > target) {
+            color = _SHUD_COLOR_SLOW;
+        }
+        const float bar_x = x + (float)(max_frames - _shud.num_frame_times + i) * bar_w;
+        _shud_rect(bar_x, y + h - bar_h, bar_w, bar_h, color);
+    }
+    const float line_h = (_shud.desc.scale > 2.0f) ? (_shud.desc.scale * 0.5f) : 1.0f;
+    _shud_rect(x, y + h * 0.5f, w, line_h, _SHUD_COLOR_TARGET);
+}
+
+_SOKOL_PRIVATE void _shud_build_quads(int width, int height) {
+    const float s = _shud.desc.scale;
+    const float panel_w = (float)(2 * _SHUD_PADDING + _SHUD_LINE_LENGTH * _SHUD_ADVANCE_X - 1) * s;
+    const float panel_h = (float)(2 * _SHUD_PADDING + _SHUD_NUM_LINES * _SHUD_ADVANCE_Y + _SHUD_GRAPH_HEIGHT) * s;
+    const float margin = _SHUD_MARGIN * s;
+    const bool right = (SHUD_CORNER_TOP_RIGHT == _shud.desc.corner) || (SHUD_CORNER_BOTTOM_RIGHT == _shud.desc.corner);
+    const bool bottom = (SHUD_CORNER_BOTTOM_LEFT == _shud.desc.corner) || (SHUD_CORNER_BOTTOM_RIGHT == _shud.desc.corner);
+    const float x0 = right ? ((float)width - margin - panel_w) : margin;
+    const float y0 = bottom ? ((float)height - margin - panel_h) : margin;
+
+    _shud.num_quads = 0;
+    _shud_rect(x0, y0, panel_w, panel_h, _SHUD_COLOR_PANEL);
+    const float x = x0 + _SHUD_PADDING * s;
+    float y = y0 + _SHUD_PADDING * s;
+    for (int i = 0; i < _SHUD_NUM_LINES; i++) {
+        if (i == _SHUD_NUM_HEADER_LINES) {
+            _shud_graph(x, y, (float)(_SHUD_LINE_LENGTH * _SHUD_ADVANCE_X - 1) * s, _SHUD_GRAPH_HEIGHT * s);
+            y += (float)(_SHUD_GRAPH_HEIGHT + _SHUD_ADVANCE_Y - _SHUD_GLYPH_HEIGHT) * s;
+        }
+        _shud_text(x, y, _shud.lines[i], _SHUD_COLOR_TEXT);
+        y += _SHUD_ADVANCE_Y * s;
+    }
+}
+
+// ██████  ██    ██ ██████  ██      ██  ██████
+// ██   ██ ██    ██ ██   ██ ██      ██ ██
+// ██████  ██    ██ ██████  ██      ██ ██
+// ██      ██    ██ ██   ██ ██      ██ ██
+// ██       ██████  ██████  ███████ ██  ██████
+//
+// >>public
+_SOKOL_PRIVATE shud_desc _shud_desc_defaults(const shud_desc* desc) {
+    SOKOL_ASSERT((desc->allocator.alloc_fn && desc->allocator.free_fn) || (!desc->allocator.alloc_fn && !desc->allocator.free_fn));
+    shud_desc res = *desc;
+    res.corner = (_SHUD_CORNER_DEFAULT == res.corner) ? SHUD_CORNER_TOP_LEFT : res.corner;
+    res.scale = (0.0f == res.scale) ? _SHUD_DEFAULT_SCALE : res.scale;
+    res.max_frames = (0 == res.max_frames) ? _SHUD_DEFAULT_MAX_FRAMES : res.max_frames;
+    res.max_quads = (0 == res.max_quads) ? _SHUD_DEFAULT_MAX_QUADS : res.max_quads;
+    res.target_frame_time_ms = (0.0f == res.target_frame_time_ms) ? _SHUD_DEFAULT_TARGET_FRAME_TIME_MS : res.target_frame_time_ms;
+    res.text_update_interval = (0 == res.text_update_interval) ? _SHUD_DEFAULT_TEXT_UPDATE_INTERVAL : res.text_update_interval;
+    res.toggle_key = (0 == res.toggle_key) ? _SHUD_DEFAULT_TOGGLE_KEY : res.toggle_key;
+    return res;
+}
+
+SOKOL_API_IMPL void shud_setup(const shud_desc* desc) {
+    SOKOL_ASSERT(desc);
+    SOKOL_ASSERT(!_shud.valid);
+    _shud_clear(&_shud, sizeof(_shud));
+    _shud.desc = _shud_desc_defaults(desc);
+    SOKOL_ASSERT((_shud.desc.scale > 0.0f) && (_shud.desc.max_frames > 0) && (_shud.desc.max_quads > 0));
+    SOKOL_ASSERT((_shud.desc.target_frame_time_ms > 0.0f) && (_shud.desc.text_update_interval > 0));
+    _shud.valid = true;
+    _shud.visible = true;
+    _shud.frame_times = (float*) _shud_malloc_clear((size_t)_shud.desc.max_frames * sizeof(float));
+    _shud.quads = (_shud_quad_t*) _shud_malloc_clear((size_t)_shud.desc.max_quads * sizeof(_shud_quad_t));
+    _shud.has_resources = _shud_setup_resources();
+    _shud_update_text();
+}
+
+SOKOL_API_IMPL void shud_shutdown(void) {
+    SOKOL_ASSERT(_shud.valid);
+    _shud_discard_resources();
+    _shud_free(_shud.frame_times);
+    _shud_free(_shud.quads);
+    _shud.valid = false;
+}
+
+SOKOL_API_IMPL void shud_draw(int width, int height) {
+    SOKOL_ASSERT(_shud.valid);
+    SOKOL_ASSERT((width > 0) && (height > 0));
+    const uint64_t start = stm_now();
+    // the first call has no previous frame to measure
+    if (0 != _shud.last_time) {
+        const float t = (float) stm_ms(stm_diff(start, _shud.last_time));
+        _shud.frame_times[_shud.frame_pos] = t;
+        _shud.frame_pos = (_shud.frame_pos + 1) % _shud.desc.max_frames;
+        if (_shud.num_frame_times < _shud.desc.max_frames) {
+            _shud.num_frame_times++;
+        }
+    }
+    _shud.last_time = start;
+    _shud.frame_count++;
+    if (!_shud.visible || !_shud.has_resources) {
+        return;
+    }
+    if (0 == (_shud.frame_count % (uint32_t)_shud.desc.text_update_interval)) {
+        _shud_update_text();
+    }
+    _shud_build_quads(width, height);
+
+    const sg_range quads = { _shud.quads, (size_t)_shud.num_quads * sizeof(_shud_quad_t) };
+    sg_update_buffer(_shud.buf, &quads);
+    sg_apply_viewport(0, 0, width, height, true);
+    sg_apply_scissor_rect(0, 0, width, height, true);
+    sg_apply_pipeline(_shud.pip);
+    sg_bindings bind;
+    _shud_clear(&bind, sizeof(bind));
+    bind.vertex_buffers[0] = _shud.buf;
+    bind.views[0] = _shud.view;
+    bind.samplers[0] = _shud.smp;
+    sg_apply_bindings(&bind);
+    _shud_vs_params_t vs_params;
+    _shud_clear(&vs_params, sizeof(vs_params));
+    vs_params.disp_size_rcp[0] = 1.0f / (float)width;
+    vs_params.disp_size_rcp[1] = 1.0f / (float)height;
+    const sg_range vs_params_range = { &vs_params, sizeof(vs_params) };
+    sg_apply_uniforms(0, &vs_params_range);
+    sg_draw(0, 4, _shud.num_quads);
+
+    _shud.draw_ticks += stm_since(start);
+    _shud.num_draws++;
+}
+
+SOKOL_API_IMPL void shud_set_visible(bool visible) {
+    SOKOL_ASSERT(_shud.valid);
+    _shud.visible = visible;
+}
+
+SOKOL_API_IMPL bool shud_visible(void) {
+    SOKOL_ASSERT(_shud.valid);
+    return _shud.visible;
+}
+
+#if defined(SOKOL_APP_INCLUDED)
+SOKOL_API_IMPL bool shud_handle_event(const sapp_event* ev) {
+    SOKOL_ASSERT(_shud.valid && ev);
+    if ((ev->type == SAPP_EVENTTYPE_KEY_DOWN) && ((int)ev->key_code == _shud.desc.toggle_key)) {
+        if (!ev->key_repeat) {
+            _shud.visible = !_shud.visible;
+        }
+        return true;
+    }
+    return false;
+}
+#endif
+
+#endif // SOKOL_HUD_IMPL
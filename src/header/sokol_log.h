@@ -69,6 +69,109 @@
 
         [sspine][error][id:12][line:3472]
 
+    ASYNCHRONOUS LOGGING
+    ====================
+    slog_func() formats and writes each message synchronously, which may
+    cause frame time spikes when messages are logged from within the frame
+    callback. For an asynchronous logging backend, call once at startup
+    (before any sokol header is setup with the async logging function):
+
+        slog_async_setup(&(slog_async_desc){0});
+
+    ...and plug slog_async_func instead of slog_func into the sokol headers:
+
+        sg_setup(&(sg_desc){ .logger.func = slog_async_func, ... });
+
+    slog_async_func() may be called from any thread, it only copies the log
+    message into a fixed-size record (the tag and filename pointers are
+    stored as is, since sokol headers always pass string literals) and
+    pushes the record into a lock-free ring buffer. A background thread
+    pops the records, formats them exactly like slog_func() and writes
+    them out in batches.
+
+    If the ring buffer is full, the message is dropped and a drop counter is
+    incremented, the background thread reports the number of dropped
+    messages with a warning. The total number of dropped messages can be
+    queried with:
+
+        uint64_t slog_async_num_dropped(void)
+
+    Messages with log level panic are not queued, instead all queued
+    messages are written first, and then the panic message is written
+    synchronously before the application is aborted.
+
+    To wait until all messages logged so far have been written, call:
+
+        slog_async_flush()
+
+    ...and at shutdown (after the sokol headers using the logger are shut down):
+
+        slog_async_shutdown()
+
+    The following slog_async_desc items can be provided:
+
+        .ring_size      - the number of records in the ring buffer, rounded
+                          up to the next power of two (default: 1024)
+        .message_length - the max length of a log message in bytes, longer
+                          messages are truncated (default: 192)
+
+    If slog_async_setup() hasn't been called, or on platforms without
+    async logging support (currently everything except Linux and macOS),
+    slog_async_func() simply forwards to slog_func().
+
+    RATE LIMITING AND DEDUPLICATION
+    ===============================
+    Some errors (for instance sokol_gfx.h validation errors caused by a
+    misconfigured resource binding) are logged on every draw call of every
+    frame, which floods the log output and may slow down the application
+    to a crawl. To limit the number of identical messages call:
+
+        slog_limit_setup(&(slog_limit_desc){0});
+
+    ...after this, slog_func() and slog_async_func() filter messages in two
+    stages:
+
+    - messages which are identical to a message written less than
+      .window_ms milliseconds ago are suppressed (where 'identical' means
+      the same tag, log item and line number)
+    - each log item (identified by tag and log item) has a token bucket
+      with room for .burst tokens which is refilled with .rate tokens
+      per second, each written message takes one token, when the bucket
+      is empty, messages of this log item are suppressed
+
+    Suppressed messages are counted, and the next written message from the
+    same location reports the number of messages which have been suppressed
+    since the last time this message was written:
+
+        [sg][error][id:234][line:16782]
+            VALIDATE_ABND_VS_EXPECTED_IMAGE_BINDING: ...
+            (+59 identical messages suppressed)
+
+    Messages with log level panic are never suppressed.
+
+    Suppressed messages which have not been reported yet (because the
+    message didn't show up again), can be written with:
+
+        slog_limit_flush()
+
+    ...and slog_limit_shutdown() writes any pending suppression reports
+    and turns off rate limiting.
+
+    The total number of suppressed messages can be queried with:
+
+        uint64_t slog_limit_num_suppressed(void)
+
+    The following slog_limit_desc items can be provided:
+
+        .window_ms  - the deduplication time window in milliseconds
+                      (default: 1000)
+        .burst      - the size of the per-item token buckets (default: 8)
+        .rate       - the per-item token bucket refill rate in tokens per
+                      second (default: 4)
+
+    The rate limiter tracks up to 512 distinct message locations, messages
+    from any additional locations are written without filtering.
+
     RULES FOR WRITING YOUR OWN LOGGING FUNCTION
     ===========================================
     - must be re-entrant because it might be called from different threads
@@ -133,6 +236,49 @@ extern "C" {
 */
 SOKOL_LOG_API_DECL void slog_func(const char* tag, uint32_t log_level, uint32_t log_item, const char* message, uint32_t line_nr, const char* filename, void* user_data);
 
+/*
+    slog_async_desc
+
+    Setup parameters for slog_async_setup(), see the section
+    ASYNCHRONOUS LOGGING for details.
+*/
+typedef struct slog_async_desc {
+    int ring_size;          // number of records in the ring buffer (default: 1024)
+    int message_length;     // max message length in bytes (default: 192)
+} slog_async_desc;
+
+/* start the background logging thread */
+SOKOL_LOG_API_DECL void slog_async_setup(const slog_async_desc* desc);
+/* write all pending messages and stop the background logging thread */
+SOKOL_LOG_API_DECL void slog_async_shutdown(void);
+/* the asynchronous logging function, use instead of slog_func */
+SOKOL_LOG_API_DECL void slog_async_func(const char* tag, uint32_t log_level, uint32_t log_item, const char* message, uint32_t line_nr, const char* filename, void* user_data);
+/* wait until all messages logged so far have been written */
+SOKOL_LOG_API_DECL void slog_async_flush(void);
+/* get the number of messages dropped because the ring buffer was full */
+SOKOL_LOG_API_DECL uint64_t slog_async_num_dropped(void);
+
+/*
+    slog_limit_desc
+
+    Setup parameters for slog_limit_setup(), see the section
+    RATE LIMITING AND DEDUPLICATION for details.
+*/
+typedef struct slog_limit_desc {
+    int window_ms;          // deduplication time window in milliseconds (default: 1000)
+    int burst;              // per-item token bucket size (default: 8)
+    int rate;               // per-item token bucket refill rate in tokens per second (default: 4)
+} slog_limit_desc;
+
+/* turn on rate limiting and deduplication in slog_func and slog_async_func */
+SOKOL_LOG_API_DECL void slog_limit_setup(const slog_limit_desc* desc);
+/* write pending suppression reports and turn off rate limiting */
+SOKOL_LOG_API_DECL void slog_limit_shutdown(void);
+/* write pending suppression reports */
+SOKOL_LOG_API_DECL void slog_limit_flush(void);
+/* get the total number of suppressed messages */
+SOKOL_LOG_API_DECL uint64_t slog_limit_num_suppressed(void);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
@@ -191,6 +337,15 @@ SOKOL_LOG_API_DECL void slog_func(const char* tag, uint32_t log_level, uint32_t
 #include <stdlib.h> // abort
 #include <stdio.h>  // fputs
 #include <stddef.h> // size_t
+#include <string.h> // memset
+#include <stdbool.h>
+
+// the asynchronous logging backend needs pthreads and GCC-style atomics
+#if (defined(_SLOG_LINUX) || defined(_SLOG_APPLE)) && (defined(__GNUC__) || defined(__clang__))
+    #define _SLOG_ASYNC (1)
+    #include <pthread.h>
+    #include <sched.h>  // sched_yield
+#endif
 
 #if defined(_SLOG_EMSCRIPTEN)
 #include <emscripten/emscripten.h>
@@ -207,6 +362,9 @@ SOKOL_LOG_API_DECL void slog_func(const char* tag, uint32_t log_level, uint32_t
 #elif defined(_SLOG_LINUX) || defined(_SLOG_APPLE)
 #include <syslog.h>
 #endif
+#if !defined(_SLOG_WINDOWS) && !defined(_SLOG_EMSCRIPTEN)
+#include <time.h>   // clock_gettime
+#endif
 
 // size of line buffer (on stack!) in bytes including terminating zero
 #define _SLOG_LINE_LENGTH (512)
@@ -248,9 +406,8 @@ EM_JS(void, slog_js_log, (uint32_t level, const char* c_str), {
 })
 #endif
 
-SOKOL_API_IMPL void slog_func(const char* tag, uint32_t log_level, uint32_t log_item, const char* message, uint32_t line_nr, const char* filename, void* user_data) {
-    _SOKOL_UNUSED(user_data);
-
+// format a log message into a zero-terminated line, returns a pointer to the terminating zero
+_SOKOL_PRIVATE char* _slog_format(const char* tag, uint32_t log_level, uint32_t log_item, const char* message, uint32_t line_nr, const char* filename, uint32_t num_suppressed, char* line_buf, char* end) {
     const char* log_level_str;
     switch (log_level) {
         case 0: log_level_str = "panic"; break;
@@ -260,9 +417,7 @@ SOKOL_API_IMPL void slog_func(const char* tag, uint32_t log_level, uint32_t log_
     }
 
     // build log output line
-    char line_buf[_SLOG_LINE_LENGTH];
     char* str = line_buf;
-    char* end = line_buf + sizeof(line_buf);
     char num_buf[32];
     if (tag) {
         str = _slog_append("[", str, end);
@@ -301,12 +456,20 @@ SOKOL_API_IMPL void slog_func(const char* tag, uint32_t log_level, uint32_t log_
         str = _slog_append("\n\t", str, end);
         str = _slog_append(message, str, end);
     }
+    if (num_suppressed > 0) {
+        str = _slog_append("\n\t(+", str, end);
+        str = _slog_append(_slog_itoa(num_suppressed, num_buf, sizeof(num_buf)), str, end);
+        str = _slog_append(" identical messages suppressed)", str, end);
+    }
     str = _slog_append("\n\n", str, end);
     if (0 == log_level) {
         str = _slog_append("ABORTING because of [panic]\n", str, end);
-        (void)str;
     }
+    return str;
+}
 
+// write one or more formatted log lines to the platform's log outputs
+_SOKOL_PRIVATE void _slog_output(uint32_t log_level, const char* line_buf) {
     // print to stderr?
     #if defined(_SLOG_LINUX) || defined(_SLOG_WINDOWS) || defined(_SLOG_APPLE)
         fputs(line_buf, stderr);
@@ -327,8 +490,517 @@ SOKOL_API_IMPL void slog_func(const char* tag, uint32_t log_level, uint32_t log_
     #elif defined(_SLOG_EMSCRIPTEN)
         slog_js_log(log_level, line_buf);
     #endif
+    _SOKOL_UNUSED(log_level);
+}
+
+_SOKOL_PRIVATE void _slog_write(const char* tag, uint32_t log_level, uint32_t log_item, const char* message, uint32_t line_nr, const char* filename, uint32_t num_suppressed) {
+    char line_buf[_SLOG_LINE_LENGTH];
+    _slog_format(tag, log_level, log_item, message, line_nr, filename, num_suppressed, line_buf, line_buf + sizeof(line_buf));
+    _slog_output(log_level, line_buf);
     if (0 == log_level) {
         abort();
     }
 }
+
+// ██      ██ ███    ███ ██ ████████
+// ██      ██ ████  ████ ██    ██
+// ██      ██ ██ ████ ██ ██    ██
+// ██      ██ ██  ██  ██ ██    ██
+// ███████ ██ ██      ██ ██    ██
+//
+// >>limit
+#define _SLOG_LIMIT_DEFAULT_WINDOW_MS (1000)
+#define _SLOG_LIMIT_DEFAULT_BURST (8)
+#define _SLOG_LIMIT_DEFAULT_RATE (4)
+// number of hash table slots, must be a power of two
+#define _SLOG_LIMIT_NUM_SLOTS (1024)
+// max number of tracked message locations (the rest of the slots is used by the token buckets)
+#define _SLOG_LIMIT_MAX_LOCATIONS (512)
+// line number of token bucket slots, which are shared by all lines of the same log item
+#define _SLOG_LIMIT_BUCKET_LINE (0xFFFFFFFF)
+// token buckets count in millitokens
+#define _SLOG_LIMIT_TOKEN (1000)
+
+typedef struct {
+    const char* tag;            // null: unused slot
+    const char* filename;
+    uint32_t log_item;
+    uint32_t line_nr;
+    uint32_t log_level;
+    uint32_t num_suppressed;
+    bool written;
+    uint64_t last_ms;           // last written message, or last token bucket refill
+    uint64_t tokens;
+} _slog_limit_slot_t;
+
+typedef struct {
+    bool valid;
+    int lock;                   // spinlock (accessed via atomics)
+    uint64_t window_ms;
+    uint64_t burst;
+    uint64_t rate;
+    int num_locations;
+    int num_buckets;
+    uint64_t num_suppressed;
+    _slog_limit_slot_t slots[_SLOG_LIMIT_NUM_SLOTS];
+} _slog_limit_t;
+static _slog_limit_t _slog_limit;
+
+_SOKOL_PRIVATE uint64_t _slog_now_ms(void) {
+    #if defined(_SLOG_WINDOWS)
+        return (uint64_t) GetTickCount64();
+    #elif defined(_SLOG_EMSCRIPTEN)
+        return (uint64_t) emscripten_get_now();
+    #else
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (uint64_t)ts.tv_sec * 1000 + (uint64_t)ts.tv_nsec / 1000000;
+    #endif
+}
+
+// the critical sections are only a hash table lookup, so a spinlock is good enough
+_SOKOL_PRIVATE void _slog_limit_lock(void) {
+    #if defined(_MSC_VER)
+        while (0 != InterlockedExchange((volatile LONG*)&_slog_limit.lock, 1)) {
+            YieldProcessor();
+        }
+    #else
+        while (0 != __atomic_exchange_n(&_slog_limit.lock, 1, __ATOMIC_ACQUIRE)) {
+            #if defined(__i386__) || defined(__x86_64__)
+                __builtin_ia32_pause();
+            #elif defined(__aarch64__) || (defined(__ARM_ARCH) && (__ARM_ARCH >= 7))
+                __asm__ __volatile__("yield");
+            #endif
+        }
+    #endif
+}
+
+_SOKOL_PRIVATE void _slog_limit_unlock(void) {
+    #if defined(_MSC_VER)
+        InterlockedExchange((volatile LONG*)&_slog_limit.lock, 0);
+    #else
+        __atomic_store_n(&_slog_limit.lock, 0, __ATOMIC_RELEASE);
+    #endif
+}
+
+// find or create the hash table slot for a message location or token bucket, may return null
+_SOKOL_PRIVATE _slog_limit_slot_t* _slog_limit_lookup(const char* tag, uint32_t log_item, uint32_t line_nr) {
+    const bool is_bucket = line_nr == _SLOG_LIMIT_BUCKET_LINE;
+    uint64_t hash = ((uint64_t)(uintptr_t)tag * 0x9E3779B97F4A7C15ULL) ^ ((uint64_t)log_item << 32) ^ line_nr;
+    hash ^= hash >> 29;
+    hash *= 0xBF58476D1CE4E5B9ULL;
+    hash ^= hash >> 32;
+    const uint32_t mask = _SLOG_LIMIT_NUM_SLOTS - 1;
+    for (uint32_t i = 0; i < _SLOG_LIMIT_NUM_SLOTS; i++) {
+        _slog_limit_slot_t* slot = &_slog_limit.slots[(hash + i) & mask];
+        if (0 == slot->tag) {
+            // NOTE: there are never more than _SLOG_LIMIT_NUM_SLOTS/2 slots of either kind in use
+            int* num = is_bucket ? &_slog_limit.num_buckets : &_slog_limit.num_locations;
+            if (*num >= _SLOG_LIMIT_MAX_LOCATIONS) {
+                return 0;
+            }
+            (*num)++;
+            // the slot may have been used before slog_limit_setup() was called again
+            memset(slot, 0, sizeof(_slog_limit_slot_t));
+            slot->tag = tag;
+            slot->log_item = log_item;
+            slot->line_nr = line_nr;
+            slot->tokens = _slog_limit.burst * _SLOG_LIMIT_TOKEN;
+            return slot;
+        }
+        if ((slot->tag == tag) && (slot->log_item == log_item) && (slot->line_nr == line_nr)) {
+            return slot;
+        }
+    }
+    return 0;
+}
+
+// returns true if a message should be written, and the number of identical
+// messages which have been suppressed since the message was last written
+_SOKOL_PRIVATE bool _slog_limit_check(const char* tag, uint32_t log_level, uint32_t log_item, uint32_t line_nr, const char* filename, uint32_t* out_num_suppressed) {
+    *out_num_suppressed = 0;
+    if ((0 == log_level) || !_slog_limit.valid) {
+        return true;
+    }
+    // sokol headers always provide a tag, treat a missing tag like any other string
+    if (0 == tag) {
+        tag = "";
+    }
+    const uint64_t now = _slog_now_ms();
+    _slog_limit_lock();
+    bool do_write = true;
+    _slog_limit_slot_t* loc = _slog_limit_lookup(tag, log_item, line_nr);
+    if (loc) {
+        if (loc->written && ((now - loc->last_ms) < _slog_limit.window_ms)) {
+            do_write = false;
+        } else {
+            _slog_limit_slot_t* bucket = _slog_limit_lookup(tag, log_item, _SLOG_LIMIT_BUCKET_LINE);
+            if (bucket) {
+                const uint64_t max_tokens = _slog_limit.burst * _SLOG_LIMIT_TOKEN;
+                bucket->tokens += (now - bucket->last_ms) * _slog_limit.rate;
+                if (bucket->tokens > max_tokens) {
+                    bucket->tokens = max_tokens;
+                }
+                bucket->last_ms = now;
+                if (bucket->tokens >= _SLOG_LIMIT_TOKEN) {
+                    bucket->tokens -= _SLOG_LIMIT_TOKEN;
+                } else {
+                    do_write = false;
+                }
+            }
+        }
+        if (do_write) {
+            *out_num_suppressed = loc->num_suppressed;
+            loc->num_suppressed = 0;
+            loc->written = true;
+            loc->last_ms = now;
+        } else {
+            // remember the details for slog_limit_flush()
+            loc->filename = filename;
+            loc->log_level = log_level;
+            loc->num_suppressed++;
+            _slog_limit.num_suppressed++;
+        }
+    }
+    _slog_limit_unlock();
+    return do_write;
+}
+
+SOKOL_API_IMPL void slog_limit_setup(const slog_limit_desc* desc) {
+    SOKOL_ASSERT(desc);
+    SOKOL_ASSERT((desc->window_ms >= 0) && (desc->burst >= 0) && (desc->rate >= 0));
+    _slog_limit_lock();
+    memset(_slog_limit.slots, 0, sizeof(_slog_limit.slots));
+    _slog_limit.num_locations = 0;
+    _slog_limit.num_buckets = 0;
+    _slog_limit.num_suppressed = 0;
+    _slog_limit.window_ms = (uint64_t)((desc->window_ms > 0) ? desc->window_ms : _SLOG_LIMIT_DEFAULT_WINDOW_MS);
+    _slog_limit.burst = (uint64_t)((desc->burst > 0) ? desc->burst : _SLOG_LIMIT_DEFAULT_BURST);
+    _slog_limit.rate = (uint64_t)((desc->rate > 0) ? desc->rate : _SLOG_LIMIT_DEFAULT_RATE);
+    _slog_limit.valid = true;
+    _slog_limit_unlock();
+}
+
+SOKOL_API_IMPL void slog_limit_flush(void) {
+    if (!_slog_limit.valid) {
+        return;
+    }
+    // keep the output in order with messages still queued in the async logger
+    slog_async_flush();
+    for (int i = 0; i < _SLOG_LIMIT_NUM_SLOTS; i++) {
+        _slog_limit_lock();
+        const _slog_limit_slot_t slot = _slog_limit.slots[i];
+        _slog_limit.slots[i].num_suppressed = 0;
+        _slog_limit_unlock();
+        if ((0 != slot.tag) && (slot.num_suppressed > 0)) {
+            _slog_write(slot.tag, slot.log_level, slot.log_item, 0, slot.line_nr, slot.filename, slot.num_suppressed);
+        }
+    }
+}
+
+SOKOL_API_IMPL void slog_limit_shutdown(void) {
+    slog_limit_flush();
+    _slog_limit.valid = false;
+}
+
+SOKOL_API_IMPL uint64_t slog_limit_num_suppressed(void) {
+    _slog_limit_lock();
+    const uint64_t num = _slog_limit.num_suppressed;
+    _slog_limit_unlock();
+    return num;
+}
+
+SOKOL_API_IMPL void slog_func(const char* tag, uint32_t log_level, uint32_t log_item, const char* message, uint32_t line_nr, const char* filename, void* user_data) {
+    _SOKOL_UNUSED(user_data);
+    uint32_t num_suppressed;
+    if (_slog_limit_check(tag, log_level, log_item, line_nr, filename, &num_suppressed)) {
+        _slog_write(tag, log_level, log_item, message, line_nr, filename, num_suppressed);
+    }
+}
+
+//  █████  ███████ ██    ██ ███    ██  ██████
+// ██   ██ ██       ██  ██  ████   ██ ██
+// ███████ ███████   ████   ██ ██  ██ ██
+// ██   ██      ██    ██    ██  ██ ██ ██
+// ██   ██ ███████    ██    ██   ████  ██████
+//
+// >>async
+#if defined(_SLOG_ASYNC)
+#define _SLOG_ASYNC_DEFAULT_RING_SIZE (1024)
+#define _SLOG_ASYNC_DEFAULT_MESSAGE_LENGTH (192)
+// size of the output batch buffer of the background thread
+#define _SLOG_ASYNC_BATCH_SIZE (16 * 1024)
+
+// a fixed-size log record, followed by the message string
+typedef struct {
+    uint64_t seq;           // ring buffer sequence number (accessed via atomics)
+    const char* tag;
+    const char* filename;
+    uint32_t log_level;
+    uint32_t log_item;
+    uint32_t line_nr;
+    uint32_t num_suppressed;
+    bool has_message;
+} _slog_record_t;
+
+typedef struct {
+    bool valid;
+    bool running;           // accessed via atomics
+    bool sleeping;          // background thread waits for wakeup (accessed via atomics)
+    int num_producers;      // threads currently pushing a record (accessed via atomics)
+    pthread_t thread;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    uint8_t* records;
+    size_t record_size;     // sizeof(_slog_record_t) + message_length, rounded up to 64 bytes
+    size_t message_length;
+    uint64_t mask;
+    uint64_t push_pos;      // next record to push (accessed via atomics by producers)
+    uint64_t pop_pos;       // next record to pop (only written by the background thread)
+    uint64_t written_pos;   // all records before this have been written (accessed via atomics)
+    uint64_t num_dropped;   // accessed via atomics
+    uint64_t num_reported_dropped;
+    char batch[_SLOG_ASYNC_BATCH_SIZE];
+} _slog_async_t;
+static _slog_async_t _slog_async;
+
+_SOKOL_PRIVATE _slog_record_t* _slog_async_record(uint64_t pos) {
+    return (_slog_record_t*) (_slog_async.records + (pos & _slog_async.mask) * _slog_async.record_size);
+}
+
+// wake up the background thread if it is waiting for new records
+_SOKOL_PRIVATE void _slog_async_wakeup(void) {
+    // NOTE: the full fence orders the record publish before the sleeping flag check,
+    // the background thread does the same in reverse order in _slog_async_wait()
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&_slog_async.sleeping, __ATOMIC_RELAXED)) {
+        pthread_mutex_lock(&_slog_async.mutex);
+        __atomic_store_n(&_slog_async.sleeping, false, __ATOMIC_RELAXED);
+        pthread_cond_signal(&_slog_async.cond);
+        pthread_mutex_unlock(&_slog_async.mutex);
+    }
+}
+
+// called by the background thread when the ring buffer is empty
+_SOKOL_PRIVATE void _slog_async_wait(void) {
+    pthread_mutex_lock(&_slog_async.mutex);
+    __atomic_store_n(&_slog_async.sleeping, true, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    // re-check after announcing the wait, a producer may have pushed a record in between
+    const uint64_t seq = __atomic_load_n(&_slog_async_record(_slog_async.pop_pos)->seq, __ATOMIC_ACQUIRE);
+    if (seq != (_slog_async.pop_pos + 1)) {
+        // the sleeping flag is cleared by producers, the running flag by slog_async_shutdown()
+        while (__atomic_load_n(&_slog_async.sleeping, __ATOMIC_RELAXED) && __atomic_load_n(&_slog_async.running, __ATOMIC_ACQUIRE)) {
+            pthread_cond_wait(&_slog_async.cond, &_slog_async.mutex);
+        }
+    }
+    __atomic_store_n(&_slog_async.sleeping, false, __ATOMIC_RELAXED);
+    pthread_mutex_unlock(&_slog_async.mutex);
+}
+
+// a bounded multi-producer queue (after Dmitry Vyukov), the sequence number of each
+// record tells whether it's free for the producer at a position, or ready for the consumer
+_SOKOL_PRIVATE bool _slog_async_push(const char* tag, uint32_t log_level, uint32_t log_item, const char* message, uint32_t line_nr, const char* filename, uint32_t num_suppressed) {
+    uint64_t pos = __atomic_load_n(&_slog_async.push_pos, __ATOMIC_RELAXED);
+    _slog_record_t* rec;
+    for (;;) {
+        rec = _slog_async_record(pos);
+        const uint64_t seq = __atomic_load_n(&rec->seq, __ATOMIC_ACQUIRE);
+        if (seq == pos) {
+            // on failure, 'pos' is updated with the current push position
+            if (__atomic_compare_exchange_n(&_slog_async.push_pos, &pos, pos + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                break;
+            }
+        } else if (seq < pos) {
+            // the ring buffer is full
+            return false;
+        } else {
+            pos = __atomic_load_n(&_slog_async.push_pos, __ATOMIC_RELAXED);
+        }
+    }
+    rec->tag = tag;
+    rec->filename = filename;
+    rec->log_level = log_level;
+    rec->log_item = log_item;
+    rec->line_nr = line_nr;
+    rec->num_suppressed = num_suppressed;
+    rec->has_message = 0 != message;
+    if (message) {
+        char* dst = (char*)(rec + 1);
+        _slog_append(message, dst, dst + _slog_async.message_length);
+    }
+    __atomic_store_n(&rec->seq, pos + 1, __ATOMIC_RELEASE);
+    _slog_async_wakeup();
+    return true;
+}
+
+// wait until no producer is inside slog_async_func(), call after clearing the valid flag
+_SOKOL_PRIVATE void _slog_async_wait_producers(void) {
+    while (__atomic_load_n(&_slog_async.num_producers, __ATOMIC_SEQ_CST) > 0) {
+        sched_yield();
+    }
+}
+
+// pop and write all ready records, returns the number of written records
+_SOKOL_PRIVATE int _slog_async_drain(void) {
+    char* str = _slog_async.batch;
+    char* end = _slog_async.batch + sizeof(_slog_async.batch);
+    int num_records = 0;
+    for (;;) {
+        _slog_record_t* rec = _slog_async_record(_slog_async.pop_pos);
+        const uint64_t seq = __atomic_load_n(&rec->seq, __ATOMIC_ACQUIRE);
+        if (seq != (_slog_async.pop_pos + 1)) {
+            break;
+        }
+        // flush the batch if the next line might not fit
+        if ((end - str) < _SLOG_LINE_LENGTH) {
+            _slog_output(1, _slog_async.batch);
+            str = _slog_async.batch;
+        }
+        const char* message = rec->has_message ? (const char*)(rec + 1) : 0;
+        str = _slog_format(rec->tag, rec->log_level, rec->log_item, message, rec->line_nr, rec->filename, rec->num_suppressed, str, str + _SLOG_LINE_LENGTH);
+        // release the record to the producers
+        __atomic_store_n(&rec->seq, _slog_async.pop_pos + _slog_async.mask + 1, __ATOMIC_RELEASE);
+        _slog_async.pop_pos++;
+        num_records++;
+    }
+    const uint64_t num_dropped = __atomic_load_n(&_slog_async.num_dropped, __ATOMIC_RELAXED);
+    if (num_dropped != _slog_async.num_reported_dropped) {
+        char num_buf[32];
+        str = _slog_append("[slog][warning] dropped ", str, end);
+        str = _slog_append(_slog_itoa((uint32_t)(num_dropped - _slog_async.num_reported_dropped), num_buf, sizeof(num_buf)), str, end);
+        str = _slog_append(" log messages (ring buffer full)\n\n", str, end);
+        _slog_async.num_reported_dropped = num_dropped;
+    }
+    if (str != _slog_async.batch) {
+        _slog_output(1, _slog_async.batch);
+    }
+    __atomic_store_n(&_slog_async.written_pos, _slog_async.pop_pos, __ATOMIC_RELEASE);
+    return num_records;
+}
+
+_SOKOL_PRIVATE void* _slog_async_thread(void* arg) {
+    _SOKOL_UNUSED(arg);
+    for (;;) {
+        // NOTE: check the running flag before draining, so that records
+        // pushed before slog_async_shutdown() are always written
+        const bool running = __atomic_load_n(&_slog_async.running, __ATOMIC_ACQUIRE);
+        if (0 == _slog_async_drain()) {
+            if (!running) {
+                break;
+            }
+            _slog_async_wait();
+        }
+    }
+    return 0;
+}
+#endif // _SLOG_ASYNC
+
+SOKOL_API_IMPL void slog_async_setup(const slog_async_desc* desc) {
+    SOKOL_ASSERT(desc);
+    #if defined(_SLOG_ASYNC)
+        SOKOL_ASSERT(!_slog_async.valid);
+        SOKOL_ASSERT((desc->ring_size >= 0) && (desc->message_length >= 0));
+        uint64_t ring_size = 1;
+        while (ring_size < (uint64_t)((desc->ring_size > 0) ? desc->ring_size : _SLOG_ASYNC_DEFAULT_RING_SIZE)) {
+            ring_size <<= 1;
+        }
+        _slog_async.message_length = (size_t)((desc->message_length > 0) ? desc->message_length : _SLOG_ASYNC_DEFAULT_MESSAGE_LENGTH);
+        _slog_async.record_size = (sizeof(_slog_record_t) + _slog_async.message_length + 63) & ~(size_t)63;
+        _slog_async.mask = ring_size - 1;
+        _slog_async.records = (uint8_t*) calloc((size_t)ring_size, _slog_async.record_size);
+        SOKOL_ASSERT(_slog_async.records);
+        for (uint64_t i = 0; i < ring_size; i++) {
+            _slog_async_record(i)->seq = i;
+        }
+        _slog_async.push_pos = 0;
+        _slog_async.pop_pos = 0;
+        _slog_async.written_pos = 0;
+        _slog_async.num_dropped = 0;
+        _slog_async.num_reported_dropped = 0;
+        _slog_async.running = true;
+        _slog_async.sleeping = false;
+        pthread_mutex_init(&_slog_async.mutex, 0);
+        pthread_cond_init(&_slog_async.cond, 0);
+        if (0 != pthread_create(&_slog_async.thread, 0, _slog_async_thread, 0)) {
+            _slog_async_wait_producers();
+            pthread_cond_destroy(&_slog_async.cond);
+            pthread_mutex_destroy(&_slog_async.mutex);
+            free(_slog_async.records);
+            _slog_async.records = 0;
+            _slog_async.running = false;
+            return;
+        }
+        __atomic_store_n(&_slog_async.valid, true, __ATOMIC_RELEASE);
+    #endif
+}
+
+SOKOL_API_IMPL void slog_async_shutdown(void) {
+    #if defined(_SLOG_ASYNC)
+        if (!_slog_async.valid) {
+            return;
+        }
+        // stop new producers and let the ones which already passed the valid
+        // check finish their push, before the ring buffer and mutex go away
+        __atomic_store_n(&_slog_async.valid, false, __ATOMIC_SEQ_CST);
+        _slog_async_wait_producers();
+        __atomic_store_n(&_slog_async.running, false, __ATOMIC_RELEASE);
+        pthread_mutex_lock(&_slog_async.mutex);
+        pthread_cond_signal(&_slog_async.cond);
+        pthread_mutex_unlock(&_slog_async.mutex);
+        pthread_join(_slog_async.thread, 0);
+        pthread_cond_destroy(&_slog_async.cond);
+        pthread_mutex_destroy(&_slog_async.mutex);
+        free(_slog_async.records);
+        _slog_async.records = 0;
+    #endif
+}
+
+SOKOL_API_IMPL void slog_async_flush(void) {
+    #if defined(_SLOG_ASYNC)
+        if (!__atomic_load_n(&_slog_async.valid, __ATOMIC_ACQUIRE)) {
+            return;
+        }
+        const uint64_t pos = __atomic_load_n(&_slog_async.push_pos, __ATOMIC_ACQUIRE);
+        while (__atomic_load_n(&_slog_async.written_pos, __ATOMIC_ACQUIRE) < pos) {
+            sched_yield();
+        }
+    #endif
+}
+
+SOKOL_API_IMPL uint64_t slog_async_num_dropped(void) {
+    #if defined(_SLOG_ASYNC)
+        return __atomic_load_n(&_slog_async.num_dropped, __ATOMIC_RELAXED);
+    #else
+        return 0;
+    #endif
+}
+
+SOKOL_API_IMPL void slog_async_func(const char* tag, uint32_t log_level, uint32_t log_item, const char* message, uint32_t line_nr, const char* filename, void* user_data) {
+    _SOKOL_UNUSED(user_data);
+    uint32_t num_suppressed;
+    if (!_slog_limit_check(tag, log_level, log_item, line_nr, filename, &num_suppressed)) {
+        return;
+    }
+    #if defined(_SLOG_ASYNC)
+        if (0 != log_level) {
+            // register as producer before checking valid, slog_async_shutdown()
+            // waits for all registered producers before freeing the ring buffer
+            __atomic_add_fetch(&_slog_async.num_producers, 1, __ATOMIC_SEQ_CST);
+            if (__atomic_load_n(&_slog_async.valid, __ATOMIC_SEQ_CST)) {
+                if (!_slog_async_push(tag, log_level, log_item, message, line_nr, filename, num_suppressed)) {
+                    __atomic_add_fetch(&_slog_async.num_dropped, 1, __ATOMIC_RELAXED);
+                }
+                __atomic_sub_fetch(&_slog_async.num_producers, 1, __ATOMIC_SEQ_CST);
+                return;
+            }
+            __atomic_sub_fetch(&_slog_async.num_producers, 1, __ATOMIC_SEQ_CST);
+        }
+        // a panic must not return, write all queued messages first
+        if (0 == log_level) {
+            slog_async_flush();
+        }
+    #endif
+    _slog_write(tag, log_level, log_item, message, line_nr, filename, num_suppressed);
+}
 #endif // SOKOL_LOG_IMPL
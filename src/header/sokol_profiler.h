@@ -0,0 +1,1052 @@
+#if defined(SOKOL_IMPL) && !defined(SOKOL_PROFILER_IMPL)
+#define SOKOL_PROFILER_IMPL
+#endif
+#ifndef SOKOL_PROFILER_INCLUDED
+/*
+    sokol_profiler.h -- record sokol_gfx.h calls and CPU zones into a Chrome trace file
+
+    Project URL: https://github.com/floooh/sokol
+
+    Do this:
+        #define SOKOL_IMPL or
+        #define SOKOL_PROFILER_IMPL
+    before you include this file in *one* C or C++ file to create the
+    implementation.
+
+    The sokol_gfx.h implementation must be compiled with SOKOL_TRACE_HOOKS,
+    since the profiler is built on top of sg_install_trace_hooks().
+
+    ...optionally provide the following macros to override defaults:
+
+    SOKOL_ASSERT(c)         - your own assert macro (default: assert(c))
+    SOKOL_PROFILER_API_DECL - public function declaration prefix (default: extern)
+    SOKOL_API_DECL          - same as SOKOL_PROFILER_API_DECL
+    SOKOL_API_IMPL          - public function implementation prefix (default: -)
+    SOKOL_UNREACHABLE()     - a guard macro for unreachable code (default: assert(false))
+
+    If sokol_profiler.h is compiled as a DLL, define the following before
+    including the declaration or implementation:
+
+    SOKOL_DLL
+
+    On Windows, SOKOL_DLL will define SOKOL_PROFILER_API_DECL as __declspec(dllexport)
+    or __declspec(dllimport) as needed.
+
+    Include the following headers before including sokol_profiler.h:
+
+        sokol_gfx.h
+        sokol_time.h
+        sokol_app.h (optional, for sprof_handle_event())
+
+    OVERVIEW
+    ========
+    sokol_profiler.h continuously records the last N frames of an application
+    into a memory ring buffer, and writes them as a Chrome trace event JSON
+    file on request (for instance when a hotkey is pressed). The trace file
+    can be inspected in the Perfetto UI (https://ui.perfetto.dev) or in
+    chrome://tracing.
+
+    The following things are recorded:
+
+    - the sokol-gfx functions sg_make_*(), sg_destroy_*(), sg_update_*(),
+      sg_append_buffer(), sg_apply_*(), sg_draw(), sg_draw_ex(), sg_dispatch()
+      and sg_commit(), these show up as instant events at the time the
+      function returned, with the most important parameters as event arguments
+    - render passes (from sg_begin_pass() to sg_end_pass()) and frames
+      (from one sg_commit() to the next) as duration events
+    - CPU zones recorded with the sokol_time.h functions stm_zone_begin()
+      and stm_zone_end() on any thread, as duration events on one track
+      per thread
+
+    All timestamps are taken with stm_now() from sokol_time.h.
+
+    STEP BY STEP
+    ============
+    --- after stm_setup() and sg_setup(), call sprof_setup():
+
+            sprof_setup(&(sprof_desc){
+                .logger.func = slog_func,
+            });
+
+        The following sprof_desc items are optional:
+
+        .max_frames     - the number of most recent frames to keep (default: 120)
+        .max_events     - the size of the event ring buffer (default: 65536), if
+                          the recorded frames contain more events, the oldest
+                          events are missing from the trace
+        .path           - the trace file path (default: "sokol_trace.json")
+        .dump_key       - the sokol_app.h keycode which triggers writing the trace
+                          file in sprof_handle_event() (default: SAPP_KEYCODE_F9)
+        .dump_cb        - a callback which receives the trace JSON data instead
+                          of writing a file
+        .user_data      - a user data pointer passed into the dump callback
+        .allocator      - optional memory allocation callbacks
+        .logger         - optional logging callback
+
+    --- instrument your code with zones:
+
+            stm_zone_begin("culling");
+            ...
+            stm_zone_end();
+
+        ...zone names must be strings with static lifetime. The recorded
+        zones are collected with stm_zones_drain() in sg_commit(), so don't
+        drain zones anywhere else while sokol_profiler.h is active.
+
+    --- write the recorded frames into the trace file with:
+
+            sprof_dump()
+
+        ...or with sokol_app.h, forward input events to sprof_handle_event()
+        which calls sprof_dump() when the dump key is pressed:
+
+            static void event(const sapp_event* ev) {
+                if (sprof_handle_event(ev)) {
+                    return;
+                }
+                ...
+            }
+
+    --- before sg_shutdown(), call:
+
+            sprof_shutdown();
+
+        ...this restores the previously installed sokol-gfx trace hooks.
+
+    MEMORY ALLOCATION OVERRIDE
+    ==========================
+    You can override the memory allocation functions at initialization time
+    like this:
+
+        void* my_alloc(size_t size, void* user_data) {
+            return malloc(size);
+        }
+
+        void my_free(void* ptr, void* user_data) {
+            free(ptr);
+        }
+
+        ...
+            sprof_setup(&(sprof_desc){
+                // ...
+                .allocator = {
+                    .alloc_fn = my_alloc,
+                    .free_fn = my_free,
+                    .user_data = ...,
+                }
+            });
+        ...
+
+    If no overrides are provided, malloc and free will be used.
+
+    ERROR REPORTING AND LOGGING
+    ===========================
+    To get any logging information at all you need to provide a logging callback in the setup call,
+    the easiest way is to use sokol_log.h:
+
+        #include "sokol_log.h"
+
+        sprof_setup(&(sprof_desc){
+            .logger.func = slog_func
+        });
+
+    LICENSE
+    =======
+    zlib/libpng license
+
+    Copyright (c) 2026 the sokol contributors
+
+    This software is provided 'as-is', without any express or implied warranty.
+    In no event will the authors be held liable for any damages arising from the
+    use of this software.
+
+    Permission is granted to anyone to use this software for any purpose,
+    including commercial applications, and to alter it and redistribute it
+    freely, subject to the following restrictions:
+
+        1. The origin of this software must not be misrepresented; you must not
+        claim that you wrote the original software. If you use this software in a
+        product, an acknowledgment in the product documentation would be
+        appreciated but is not required.
+
+        2. Altered source versions must be plainly marked as such, and must not
+        be misrepresented as being the original software.
+
+        3. This notice may not be removed or altered from any source
+        distribution.
+*/
+#define SOKOL_PROFILER_INCLUDED (1)
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h> // size_t
+
+#if !defined(SOKOL_GFX_INCLUDED)
+#error "Please include sokol_gfx.h before sokol_profiler.h"
+#endif
+#if !defined(SOKOL_TIME_INCLUDED)
+#error "Please include sokol_time.h before sokol_profiler.h"
+#endif
+
+#if defined(SOKOL_API_DECL) && !defined(SOKOL_PROFILER_API_DECL)
+#define SOKOL_PROFILER_API_DECL SOKOL_API_DECL
+#endif
+#ifndef SOKOL_PROFILER_API_DECL
+#if defined(_WIN32) && defined(SOKOL_DLL) && defined(SOKOL_PROFILER_IMPL)
+#define SOKOL_PROFILER_API_DECL __declspec(dllexport)
+#elif defined(_WIN32) && defined(SOKOL_DLL)
+#define SOKOL_PROFILER_API_DECL __declspec(dllimport)
+#else
+#define SOKOL_PROFILER_API_DECL extern
+#endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+    sprof_log_item_t
+
+    Log items are defined via X-Macros, and expanded to an
+    enum 'sprof_log_item' - and in debug mode only - corresponding strings.
+
+    Used as parameter in the logging callback.
+*/
+#define _SPROF_LOG_ITEMS \
+    _SPROF_LOGITEM_XMACRO(OK, "Ok") \
+    _SPROF_LOGITEM_XMACRO(MALLOC_FAILED, "memory allocation failed") \
+    _SPROF_LOGITEM_XMACRO(FILE_OPEN_FAILED, "sprof_dump(): failed to open trace file for writing") \
+    _SPROF_LOGITEM_XMACRO(FILE_WRITE_FAILED, "sprof_dump(): failed to write trace file") \
+    _SPROF_LOGITEM_XMACRO(FRAMES_DROPPED, "sprof_dump(): event ring buffer too small for sprof_desc.max_frames, oldest events dropped (increase sprof_desc.max_events)") \
+    _SPROF_LOGITEM_XMACRO(TRACE_WRITTEN, "sprof_dump(): trace file written") \
+
+#define _SPROF_LOGITEM_XMACRO(item,msg) SPROF_LOGITEM_##item,
+typedef enum sprof_log_item_t {
+    _SPROF_LOG_ITEMS
+} sprof_log_item_t;
+#undef _SPROF_LOGITEM_XMACRO
+
+/*
+    sprof_allocator_t
+
+    Used in sprof_desc to provide custom memory-alloc and -free functions
+    to sokol_profiler.h. If memory management should be overridden, both the
+    alloc_fn and free_fn function must be provided (e.g. it's not valid to
+    override one function but not the other).
+*/
+typedef struct sprof_allocator_t {
+    void* (*alloc_fn)(size_t size, void* user_data);
+    void (*free_fn)(void* ptr, void* user_data);
+    void* user_data;
+} sprof_allocator_t;
+
+/*
+    sprof_logger_t
+
+    Used in sprof_desc to provide a logging function. Please be aware that
+    without logging function, sokol-profiler will be completely silent, e.g. it will
+    not report errors or warnings. For maximum error verbosity, compile in
+    debug mode (e.g. NDEBUG *not* defined) and install a logger (for instance
+    the standard logging function from sokol_log.h).
+*/
+typedef struct sprof_logger_t {
+    void (*func)(
+        const char* tag,                // always "sprof"
+        uint32_t log_level,             // 0=panic, 1=error, 2=warning, 3=info
+        uint32_t log_item_id,           // SPROF_LOGITEM_*
+        const char* message_or_null,    // a message string, may be nullptr in release mode
+        uint32_t line_nr,               // line number in sokol_profiler.h
+        const char* filename_or_null,   // source filename, may be nullptr in release mode
+        void* user_data);
+    void* user_data;
+} sprof_logger_t;
+
+/*
+    sprof_desc
+
+    The setup parameters for sprof_setup(), see the documentation
+    section STEP BY STEP for details.
+*/
+typedef struct sprof_desc {
+    int max_frames;             // number of most recent frames to keep (default: 120)
+    int max_events;             // size of the event ring buffer (default: 65536)
+    const char* path;           // trace file path (default: "sokol_trace.json")
+    int dump_key;               // sapp_keycode for sprof_handle_event() (default: SAPP_KEYCODE_F9)
+    void (*dump_cb)(sg_range json_data, void* user_data);   // optional, called instead of writing a file
+    void* user_data;
+    sprof_allocator_t allocator;
+    sprof_logger_t logger;
+} sprof_desc;
+
+/* setup and shutdown */
+SOKOL_PROFILER_API_DECL void sprof_setup(const sprof_desc* desc);
+SOKOL_PROFILER_API_DECL void sprof_shutdown(void);
+/* write the recorded frames as Chrome trace JSON */
+SOKOL_PROFILER_API_DECL bool sprof_dump(void);
+#if defined(SOKOL_APP_INCLUDED)
+/* call sprof_dump() when the dump key is pressed, returns true if the event was handled */
+SOKOL_PROFILER_API_DECL bool sprof_handle_event(const sapp_event* ev);
+#endif
+
+#ifdef __cplusplus
+} // extern "C"
+
+// reference-based equivalents for C++
+inline void sprof_setup(const sprof_desc& desc) { return sprof_setup(&desc); }
+
+#endif
+#endif // SOKOL_PROFILER_INCLUDED
+
+// ██ ███    ███ ██████  ██      ███████ ███    ███ ███████ ███    ██ ████████  █████  ████████ ██  ██████  ███    ██
+// ██ ████  ████ ██   ██ ██      ██      ████  ████ ██      ████   ██    ██    ██   ██    ██    ██ ██    ██ ████   ██
+// ██ ██ ████ ██ ██████  ██      █████   ██ ████ ██ █████   ██ ██  ██    ██    ███████    ██    ██ ██    ██ ██ ██  ██
+// ██ ██  ██  ██ ██      ██      ██      ██  ██  ██ ██      ██  ██ ██    ██    ██   ██    ██    ██ ██    ██ ██  ██ ██
+// ██ ██      ██ ██      ███████ ███████ ██      ██ ███████ ██   ████    ██    ██   ██    ██    ██  ██████  ██   ████
+//
+// >>implementation
+#ifdef SOKOL_PROFILER_IMPL
+#define SOKOL_PROFILER_IMPL_INCLUDED (1)
+
+#if defined(SOKOL_GFX_IMPL_INCLUDED) && !defined(SOKOL_TRACE_HOOKS)
+#error "sokol_profiler.h requires the sokol_gfx.h implementation to be compiled with SOKOL_TRACE_HOOKS"
+#endif
+
+#include <stdlib.h> // malloc, free
+#include <string.h> // memset, memcpy, strlen
+#include <stdio.h>  // fopen, fwrite, fclose, snprintf
+
+#ifndef SOKOL_API_IMPL
+    #define SOKOL_API_IMPL
+#endif
+#ifndef SOKOL_DEBUG
+    #ifndef NDEBUG
+        #define SOKOL_DEBUG
+    #endif
+#endif
+#ifndef SOKOL_ASSERT
+    #include <assert.h>
+    #define SOKOL_ASSERT(c) assert(c)
+#endif
+#ifndef _SOKOL_PRIVATE
+    #if defined(__GNUC__) || defined(__clang__)
+        #define _SOKOL_PRIVATE __attribute__((unused)) static
+    #else
+        #define _SOKOL_PRIVATE static
+    #endif
+#endif
+#ifndef _SOKOL_UNUSED
+    #define _SOKOL_UNUSED(x) (void)(x)
+#endif
+
+#define _SPROF_DEFAULT_MAX_FRAMES (120)
+#define _SPROF_DEFAULT_MAX_EVENTS (65536)
+#define _SPROF_DEFAULT_PATH "sokol_trace.json"
+#define _SPROF_DEFAULT_DUMP_KEY (298)   // SAPP_KEYCODE_F9
+#define _SPROF_MAX_ARGS (3)
+// number of zones copied out of sokol_time.h per stm_zones_drain() call
+#define _SPROF_ZONE_BATCH_SIZE (256)
+// track ids, zone tracks use 1 + stm_zone.thread_index
+#define _SPROF_TID_GFX (0)
+
+// the recorded sokol-gfx calls, with the names of the event arguments
+#define _SPROF_GFX_EVENTS \
+    _SPROF_GFX_EVENT_XMACRO(MAKE_BUFFER, "sg_make_buffer", "id", 0, 0) \
+    _SPROF_GFX_EVENT_XMACRO(MAKE_IMAGE, "sg_make_image", "id", 0, 0) \
+    _SPROF_GFX_EVENT_XMACRO(MAKE_SAMPLER, "sg_make_sampler", "id", 0, 0) \
+    _SPROF_GFX_EVENT_XMACRO(MAKE_SHADER, "sg_make_shader", "id", 0, 0) \
+    _SPROF_GFX_EVENT_XMACRO(MAKE_PIPELINE, "sg_make_pipeline", "id", 0, 0) \
+    _SPROF_GFX_EVENT_XMACRO(MAKE_VIEW, "sg_make_view", "id", 0, 0) \
+    _SPROF_GFX_EVENT_XMACRO(DESTROY_BUFFER, "sg_destroy_buffer", "id", 0, 0) \
+    _SPROF_GFX_EVENT_XMACRO(DESTROY_IMAGE, "sg_destroy_image", "id", 0, 0) \
+    _SPROF_GFX_EVENT_XMACRO(DESTROY_SAMPLER, "sg_destroy_sampler", "id", 0, 0) \
+    _SPROF_GFX_EVENT_XMACRO(DESTROY_SHADER, "sg_destroy_shader", "id", 0, 0) \
+    _SPROF_GFX_EVENT_XMACRO(DESTROY_PIPELINE, "sg_destroy_pipeline", "id", 0, 0) \
+    _SPROF_GFX_EVENT_XMACRO(DESTROY_VIEW, "sg_destroy_view", "id", 0, 0) \
+    _SPROF_GFX_EVENT_XMACRO(UPDATE_BUFFER, "sg_update_buffer", "id", "size", 0) \
+    _SPROF_GFX_EVENT_XMACRO(UPDATE_IMAGE, "sg_update_image", "id", 0, 0) \
+    _SPROF_GFX_EVENT_XMACRO(APPEND_BUFFER, "sg_append_buffer", "id", "size", "offset") \
+    _SPROF_GFX_EVENT_XMACRO(APPLY_VIEWPORT, "sg_apply_viewport", "width", "height", 0) \
+    _SPROF_GFX_EVENT_XMACRO(APPLY_SCISSOR_RECT, "sg_apply_scissor_rect", "width", "height", 0) \
+    _SPROF_GFX_EVENT_XMACRO(APPLY_PIPELINE, "sg_apply_pipeline", "id", 0, 0) \
+    _SPROF_GFX_EVENT_XMACRO(APPLY_BINDINGS, "sg_apply_bindings", 0, 0, 0) \
+    _SPROF_GFX_EVENT_XMACRO(APPLY_UNIFORMS, "sg_apply_uniforms", "ub_index", "size", 0) \
+    _SPROF_GFX_EVENT_XMACRO(DRAW, "sg_draw", "base_element", "num_elements", "num_instances") \
+    _SPROF_GFX_EVENT_XMACRO(DRAW_EX, "sg_draw_ex", "base_element", "num_elements", "num_instances") \
+    _SPROF_GFX_EVENT_XMACRO(DISPATCH, "sg_dispatch", "num_groups_x", "num_groups_y", "num_groups_z") \
+    _SPROF_GFX_EVENT_XMACRO(COMMIT, "sg_commit", 0, 0, 0) \
+    _SPROF_GFX_EVENT_XMACRO(PASS, "sg_pass", "num_draws", 0, 0) \
+    _SPROF_GFX_EVENT_XMACRO(FRAME, "frame", "frame_index", "num_draws", 0) \
+
+#define _SPROF_GFX_EVENT_XMACRO(item,name,arg0,arg1,arg2) _SPROF_GFX_EVENT_##item,
+typedef enum {
+    _SPROF_GFX_EVENT_ZONE,      // a CPU zone, the event name is stored in the event
+    _SPROF_GFX_EVENTS
+    _SPROF_GFX_EVENT_NUM,
+} _sprof_gfx_event_t;
+#undef _SPROF_GFX_EVENT_XMACRO
+
+typedef struct {
+    const char* name;
+    const char* arg_names[_SPROF_MAX_ARGS];
+} _sprof_event_info_t;
+
+#define _SPROF_GFX_EVENT_XMACRO(item,name,arg0,arg1,arg2) { name, { arg0, arg1, arg2 } },
+static const _sprof_event_info_t _sprof_event_infos[_SPROF_GFX_EVENT_NUM] = {
+    { 0, { 0, 0, 0 } },
+    _SPROF_GFX_EVENTS
+};
+#undef _SPROF_GFX_EVENT_XMACRO
+
+typedef struct {
+    const char* name;           // only for zones
+    uint64_t ts;                // start time in sokol_time.h ticks
+    uint64_t dur;               // duration in ticks, 0 for instant events
+    uint32_t tid;
+    uint16_t type;              // _sprof_gfx_event_t
+    bool instant;
+    int32_t args[_SPROF_MAX_ARGS];
+} _sprof_event_t;
+
+// a growable string buffer for the JSON output
+typedef struct {
+    char* ptr;
+    size_t size;
+    size_t pos;
+} _sprof_str_t;
+
+typedef struct {
+    bool valid;
+    sprof_desc desc;
+    sg_trace_hooks hooks;           // the previously installed trace hooks
+    _sprof_event_t* events;         // the event ring buffer
+    uint64_t num_events;            // total number of recorded events
+    uint64_t* frame_first_event;    // for each frame in the frame ring: index of the first event
+    uint64_t frame_index;           // index of the current frame
+    uint64_t frame_start;
+    uint32_t frame_num_draws;
+    uint64_t pass_start;
+    uint32_t pass_num_draws;
+    uint32_t max_zone_tid;
+    stm_zone zones[_SPROF_ZONE_BATCH_SIZE];
+    _sprof_str_t json;
+} _sprof_t;
+static _sprof_t _sprof;
+
+// ██       ██████   ██████   ██████  ██ ███    ██  ██████
+// ██      ██    ██ ██       ██       ██ ████   ██ ██
+// ██      ██    ██ ██   ███ ██   ███ ██ ██ ██  ██ ██   ███
+// ██      ██    ██ ██    ██ ██    ██ ██ ██  ██ ██ ██    ██
+// ███████  ██████   ██████   ██████  ██ ██   ████  ██████
+//
+// >>logging
+#if defined(SOKOL_DEBUG)
+#define _SPROF_LOGITEM_XMACRO(item,msg) #item ": " msg,
+static const char* _sprof_log_messages[] = {
+    _SPROF_LOG_ITEMS
+};
+#undef _SPROF_LOGITEM_XMACRO
+#endif // SOKOL_DEBUG
+
+#define _SPROF_PANIC(code) _sprof_log(SPROF_LOGITEM_ ##code, 0, __LINE__)
+#define _SPROF_ERROR(code) _sprof_log(SPROF_LOGITEM_ ##code, 1, __LINE__)
+#define _SPROF_WARN(code) _sprof_log(SPROF_LOGITEM_ ##code, 2, __LINE__)
+#define _SPROF_INFO(code) _sprof_log(SPROF_LOGITEM_ ##code, 3, __LINE__)
+
+static void _sprof_log(sprof_log_item_t log_item, uint32_t log_level, uint32_t line_nr) {
+    if (_sprof.desc.logger.func) {
+        #if defined(SOKOL_DEBUG)
+            const char* filename = __FILE__;
+            const char* message = _sprof_log_messages[log_item];
+        #else
+            const char* filename = 0;
+            const char* message = 0;
+        #endif
+        _sprof.desc.logger.func("sprof", log_level, (uint32_t)log_item, message, line_nr, filename, _sprof.desc.logger.user_data);
+    } else {
+        // for log level PANIC it would be 'undefined behaviour' to continue
+        if (log_level == 0) {
+            abort();
+        }
+    }
+}
+
+// ███    ███ ███████ ███    ███  ██████  ██████  ██    ██
+// ████  ████ ██      ████  ████ ██    ██ ██   ██  ██  ██
+// ██ ████ ██ █████   ██ ████ ██ ██    ██ ██████    ████
+// ██  ██  ██ ██      ██  ██  ██ ██    ██ ██   ██    ██
+// ██      ██ ███████ ██      ██  ██████  ██   ██    ██
+//
+// >>memory
+_SOKOL_PRIVATE void _sprof_clear(void* ptr, size_t size) {
+    SOKOL_ASSERT(ptr && (size > 0));
+    memset(ptr, 0, size);
+}
+
+_SOKOL_PRIVATE void* _sprof_malloc(size_t size) {
+    SOKOL_ASSERT(size > 0);
+    void* ptr;
+    if (_sprof.desc.allocator.alloc_fn) {
+        ptr = _sprof.desc.allocator.alloc_fn(size, _sprof.desc.allocator.user_data);
+    } else {
+        ptr = malloc(size);
+    }
+    if (0 == ptr) {
+        _SPROF_PANIC(MALLOC_FAILED);
+    }
+    return ptr;
+}
+
+_SOKOL_PRIVATE void* _sprof_malloc_clear(size_t size) {
+    void* ptr = _sprof_malloc(size);
+    _sprof_clear(ptr, size);
+    return ptr;
+}
+
+_SOKOL_PRIVATE void _sprof_free(void* ptr) {
+    if (_sprof.desc.allocator.free_fn) {
+        _sprof.desc.allocator.free_fn(ptr, _sprof.desc.allocator.user_data);
+    } else {
+        free(ptr);
+    }
+}
+
+// ██████  ███████  ██████  ██████  ██████  ██████  ██ ███    ██  ██████
+// ██   ██ ██      ██      ██    ██ ██   ██ ██   ██ ██ ████   ██ ██
+// ██████  █████   ██      ██    ██ ██████  ██   ██ ██ ██ ██  ██ ██   ███
+// ██   ██ ██      ██      ██    ██ ██   ██ ██   ██ ██ ██  ██ ██ ██    ██
+// ██   ██ ███████  ██████  ██████  ██   ██ ██████  ██ ██   ████  ██████
+//
+// >>recording
+_SOKOL_PRIVATE _sprof_event_t* _sprof_next_event(_sprof_gfx_event_t type, uint32_t tid) {
+    _sprof_event_t* ev = &_sprof.events[_sprof.num_events % (uint64_t)_sprof.desc.max_events];
+    _sprof.num_events++;
+    _sprof_clear(ev, sizeof(_sprof_event_t));
+    ev->type = (uint16_t)type;
+    ev->tid = tid;
+    return ev;
+}
+
+_SOKOL_PRIVATE void _sprof_instant(_sprof_gfx_event_t type, int arg0, int arg1, int arg2) {
+    _sprof_event_t* ev = _sprof_next_event(type, _SPROF_TID_GFX);
+    ev->ts = stm_now();
+    ev->instant = true;
+    ev->args[0] = arg0;
+    ev->args[1] = arg1;
+    ev->args[2] = arg2;
+}
+
+_SOKOL_PRIVATE void _sprof_duration(_sprof_gfx_event_t type, uint64_t start, uint64_t end, int arg0, int arg1) {
+    _sprof_event_t* ev = _sprof_next_event(type, _SPROF_TID_GFX);
+    ev->ts = start;
+    ev->dur = stm_diff(end, start);
+    ev->args[0] = arg0;
+    ev->args[1] = arg1;
+}
+
+_SOKOL_PRIVATE void _sprof_record_zones(void) {
+    int num_zones;
+    while ((num_zones = stm_zones_drain(_sprof.zones, _SPROF_ZONE_BATCH_SIZE)) > 0) {
+        for (int i = 0; i < num_zones; i++) {
+            const stm_zone* zone = &_sprof.zones[i];
+            const uint32_t tid = 1 + zone->thread_index;
+            _sprof_event_t* ev = _sprof_next_event(_SPROF_GFX_EVENT_ZONE, tid);
+            ev->name = zone->name;
+            ev->ts = zone->start;
+            ev->dur = stm_diff(zone->end, zone->start);
+            ev->args[0] = (int32_t)zone->depth;
+            if (tid > _sprof.max_zone_tid) {
+                _sprof.max_zone_tid = tid;
+            }
+        }
+        if (num_zones < _SPROF_ZONE_BATCH_SIZE) {
+            break;
+        }
+    }
+}
+
+// ██   ██  ██████   ██████  ██   ██ ███████
+// ██   ██ ██    ██ ██    ██ ██  ██  ██
+// ███████ ██    ██ ██    ██ █████   ███████
+// ██   ██ ██    ██ ██    ██ ██  ██       ██
+// ██   ██  ██████   ██████  ██   ██ ███████
+//
+// >>hooks
+_SOKOL_PRIVATE void _sprof_make_buffer(const sg_buffer_desc* desc, sg_buffer result, void* user_data) {
+    _SOKOL_UNUSED(user_data);
+    _sprof_instant(_SPROF_GFX_EVENT_MAKE_BUFFER, (int)result.id, 0, 0);
+    if (_sprof.hooks.make_buffer) {
+        _sprof.hooks.make_buffer(desc, result, _sprof.hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sprof_make_image(const sg_image_desc* desc, sg_image result, void* user_data) {
+    _SOKOL_UNUSED(user_data);
+    _sprof_instant(_SPROF_GFX_EVENT_MAKE_IMAGE, (int)result.id, 0, 0);
+    if (_sprof.hooks.make_image) {
+        _sprof.hooks.make_image(desc, result, _sprof.hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sprof_make_sampler(const sg_sampler_desc* desc, sg_sampler result, void* user_data) {
+    _SOKOL_UNUSED(user_data);
+    _sprof_instant(_SPROF_GFX_EVENT_MAKE_SAMPLER, (int)result.id, 0, 0);
+    if (_sprof.hooks.make_sampler) {
+        _sprof.hooks.make_sampler(desc, result, _sprof.hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sprof_make_shader(const sg_shader_desc* desc, sg_shader result, void* user_data) {
+    _SOKOL_UNUSED(user_data);
+    _sprof_instant(_SPROF_GFX_EVENT_MAKE_SHADER, (int)result.id, 0, 0);
+    if (_sprof.hooks.make_shader) {
+        _sprof.hooks.make_shader(desc, result, _sprof.hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sprof_make_pipeline(const sg_pipeline_desc* desc, sg_pipeline result, void* user_data) {
+    _SOKOL_UNUSED(user_data);
+    _sprof_instant(_SPROF_GFX_EVENT_MAKE_PIPELINE, (int)result.id, 0, 0);
+    if (_sprof.hooks.make_pipeline) {
+        _sprof.hooks.make_pipeline(desc, result, _sprof.hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sprof_make_view(const sg_view_desc* desc, sg_view result, void* user_data) {
+    _SOKOL_UNUSED(user_data);
+    _sprof_instant(_SPROF_GFX_EVENT_MAKE_VIEW, (int)result.id, 0, 0);
+    if (_sprof.hooks.make_view) {
+        _sprof.hooks.make_view(desc, result, _sprof.hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sprof_destroy_buffer(sg_buffer buf, void* user_data) {
+    _SOKOL_UNUSED(user_data);
+    _sprof_instant(_SPROF_GFX_EVENT_DESTROY_BUFFER, (int)buf.id, 0, 0);
+    if (_sprof.hooks.destroy_buffer) {
+        _sprof.hooks.destroy_buffer(buf, _sprof.hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sprof_destroy_image(sg_image img, void* user_data) {
+    _SOKOL_UNUSED(user_data);
+    _sprof_instant(_SPROF_GFX_EVENT_DESTROY_IMAGE, (int)img.id, 0, 0);
+    if (_sprof.hooks.destroy_image) {
+        _sprof.hooks.destroy_image(img, _sprof.hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sprof_destroy_sampler(sg_sampler smp, void* user_data) {
+    _SOKOL_UNUSED(user_data);
+    _sprof_instant(_SPROF_GFX_EVENT_DESTROY_SAMPLER, (int)smp.id, 0, 0);
+    if (_sprof.hooks.destroy_sampler) {
+        _sprof.hooks.destroy_sampler(smp, _sprof.hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sprof_destroy_shader(sg_shader shd, void* user_data) {
+    _SOKOL_UNUSED(user_data);
+    _sprof_instant(_SPROF_GFX_EVENT_DESTROY_SHADER, (int)shd.id, 0, 0);
+    if (_sprof.hooks.destroy_shader) {
+        _sprof.hooks.destroy_shader(shd, _sprof.hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sprof_destroy_pipeline(sg_pipeline pip, void* user_data) {
+    _SOKOL_UNUSED(user_data);
+    _sprof_instant(_SPROF_GFX_EVENT_DESTROY_PIPELINE, (int)pip.id, 0, 0);
+    if (_sprof.hooks.destroy_pipeline) {
+        _sprof.hooks.destroy_pipeline(pip, _sprof.hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sprof_destroy_view(sg_view view, void* user_data) {
+    _SOKOL_UNUSED(user_data);
+    _sprof_instant(_SPROF_GFX_EVENT_DESTROY_VIEW, (int)view.id, 0, 0);
+    if (_sprof.hooks.destroy_view) {
+        _sprof.hooks.destroy_view(view, _sprof.hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sprof_update_buffer(sg_buffer buf, const sg_range* data, void* user_data) {
+    _SOKOL_UNUSED(user_data);
+    _sprof_instant(_SPROF_GFX_EVENT_UPDATE_BUFFER, (int)buf.id, (int)data->size, 0);
+    if (_sprof.hooks.update_buffer) {
+        _sprof.hooks.update_buffer(buf, data, _sprof.hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sprof_update_image(sg_image img, const sg_image_data* data, void* user_data) {
+    _SOKOL_UNUSED(user_data);
+    _sprof_instant(_SPROF_GFX_EVENT_UPDATE_IMAGE, (int)img.id, 0, 0);
+    if (_sprof.hooks.update_image) {
+        _sprof.hooks.update_image(img, data, _sprof.hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sprof_append_buffer(sg_buffer buf, const sg_range* data, int result, void* user_data) {
+    _SOKOL_UNUSED(user_data);
+    _sprof_instant(_SPROF_GFX_EVENT_APPEND_BUFFER, (int)buf.id, (int)data->size, result);
+    if (_sprof.hooks.append_buffer) {
+        _sprof.hooks.append_buffer(buf, data, result, _sprof.hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sprof_begin_pass(const sg_pass* pass, void* user_data) {
+    _SOKOL_UNUSED(user_data);
+    _sprof.pass_start = stm_now();
+    _sprof.pass_num_draws = 0;
+    if (_sprof.hooks.begin_pass) {
+        _sprof.hooks.begin_pass(pass, _sprof.hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sprof_apply_viewport(int x, int y, int width, int height, bool origin_top_left, void* user_data) {
+    _SOKOL_UNUSED(user_data);
+    _sprof_instant(_SPROF_GFX_EVENT_APPLY_VIEWPORT, width, height, 0);
+    if (_sprof.hooks.apply_viewport) {
+        _sprof.hooks.apply_viewport(x, y, width, height, origin_top_left, _sprof.hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sprof_apply_scissor_rect(int x, int y, int width, int height, bool origin_top_left, void* user_data) {
+    _SOKOL_UNUSED(user_data);
+    _sprof_instant(_SPROF_GFX_EVENT_APPLY_SCISSOR_RECT, width, height, 0);
+    if (_sprof.hooks.apply_scissor_rect) {
+        _sprof.hooks.apply_scissor_rect(x, y, width, height, origin_top_left, _sprof.hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sprof_apply_pipeline(sg_pipeline pip, void* user_data) {
+    _SOKOL_UNUSED(user_data);
+    _sprof_instant(_SPROF_GFX_EVENT_APPLY_PIPELINE, (int)pip.id, 0, 0);
+    if (_sprof.hooks.apply_pipeline) {
+        _sprof.hooks.apply_pipeline(pip, _sprof.hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sprof_apply_bindings(const sg_bindings* bindings, void* user_data) {
+    _SOKOL_UNUSED(user_data);
+    _sprof_instant(_SPROF_GFX_EVENT_APPLY_BINDINGS, 0, 0, 0);
+    if (_sprof.hooks.apply_bindings) {
+        _sprof.hooks.apply_bindings(bindings, _sprof.hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sprof_apply_uniforms(int ub_index, const sg_range* data, void* user_data) {
+    _SOKOL_UNUSED(user_data);
+    _sprof_instant(_SPROF_GFX_EVENT_APPLY_UNIFORMS, ub_index, (int)data->size, 0);
+    if (_sprof.hooks.apply_uniforms) {
+        _sprof.hooks.apply_uniforms(ub_index, data, _sprof.hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sprof_draw(int base_element, int num_elements, int num_instances, void* user_data) {
+    _SOKOL_UNUSED(user_data);
+    _sprof_instant(_SPROF_GFX_EVENT_DRAW, base_element, num_elements, num_instances);
+    _sprof.pass_num_draws++;
+    _sprof.frame_num_draws++;
+    if (_sprof.hooks.draw) {
+        _sprof.hooks.draw(base_element, num_elements, num_instances, _sprof.hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sprof_draw_ex(int base_element, int num_elements, int num_instances, int base_vertex, int base_instance, void* user_data) {
+    _SOKOL_UNUSED(user_data);
+    _sprof_instant(_SPROF_GFX_EVENT_DRAW_EX, base_element, num_elements, num_instances);
+    _sprof.pass_num_draws++;
+    _sprof.frame_num_draws++;
+    if (_sprof.hooks.draw_ex) {
+        _sprof.hooks.draw_ex(base_element, num_elements, num_instances, base_vertex, base_instance, _sprof.hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sprof_dispatch(int num_groups_x, int num_groups_y, int num_groups_z, void* user_data) {
+    _SOKOL_UNUSED(user_data);
+    _sprof_instant(_SPROF_GFX_EVENT_DISPATCH, num_groups_x, num_groups_y, num_groups_z);
+    if (_sprof.hooks.dispatch) {
+        _sprof.hooks.dispatch(num_groups_x, num_groups_y, num_groups_z, _sprof.hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sprof_end_pass(void* user_data) {
+    _SOKOL_UNUSED(user_data);
+    _sprof_duration(_SPROF_GFX_EVENT_PASS, _sprof.pass_start, stm_now(), (int)_sprof.pass_num_draws, 0);
+    if (_sprof.hooks.end_pass) {
+        _sprof.hooks.end_pass(_sprof.hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sprof_commit(void* user_data) {
+    _SOKOL_UNUSED(user_data);
+    _sprof_instant(_SPROF_GFX_EVENT_COMMIT, 0, 0, 0);
+    const uint64_t now = stm_now();
+    _sprof_record_zones();
+    _sprof_duration(_SPROF_GFX_EVENT_FRAME, _sprof.frame_start, now, (int)_sprof.frame_index, (int)_sprof.frame_num_draws);
+    // start the next frame
+    _sprof.frame_index++;
+    _sprof.frame_first_event[_sprof.frame_index % (uint64_t)_sprof.desc.max_frames] = _sprof.num_events;
+    _sprof.frame_start = now;
+    _sprof.frame_num_draws = 0;
+    if (_sprof.hooks.commit) {
+        _sprof.hooks.commit(_sprof.hooks.user_data);
+    }
+}
+
+//      ██ ███████  ██████  ███    ██
+//      ██ ██      ██    ██ ████   ██
+//      ██ ███████ ██    ██ ██ ██  ██
+// ██   ██      ██ ██    ██ ██  ██ ██
+//  █████  ███████  ██████  ██   ████
+//
+// >>json
+_SOKOL_PRIVATE void _sprof_json_reserve(size_t num_bytes) {
+    _sprof_str_t* s = &_sprof.json;
+    if ((s->pos + num_bytes) > s->size) {
+        size_t new_size = (s->size > 0) ? s->size * 2 : (64 * 1024);
+        while (new_size < (s->pos + num_bytes)) {
+            new_size *= 2;
+        }
+        char* new_ptr = (char*) _sprof_malloc(new_size);
+        if (s->ptr) {
+            memcpy(new_ptr, s->ptr, s->pos);
+            _sprof_free(s->ptr);
+        }
+        s->ptr = new_ptr;
+        s->size = new_size;
+    }
+}
+
+_SOKOL_PRIVATE void _sprof_json_str(const char* str) {
+    const size_t len = strlen(str);
+    _sprof_json_reserve(len);
+    memcpy(_sprof.json.ptr + _sprof.json.pos, str, len);
+    _sprof.json.pos += len;
+}
+
+// a quoted JSON string, escaping quotes, backslashes and control characters
+_SOKOL_PRIVATE void _sprof_json_quoted(const char* str) {
+    const size_t len = strlen(str);
+    _sprof_json_reserve(len * 6 + 2);
+    char* dst = _sprof.json.ptr + _sprof.json.pos;
+    *dst++ = '"';
+    for (size_t i = 0; i < len; i++) {
+        const char c = str[i];
+        if ((c == '"') || (c == '\\')) {
+            *dst++ = '\\';
+            *dst++ = c;
+        } else if ((unsigned char)c < 0x20) {
+            static const char hex[] = "0123456789abcdef";
+            *dst++ = '\\'; *dst++ = 'u'; *dst++ = '0'; *dst++ = '0';
+            *dst++ = hex[(c >> 4) & 0xF];
+            *dst++ = hex[c & 0xF];
+        } else {
+            *dst++ = c;
+        }
+    }
+    *dst++ = '"';
+    _sprof.json.pos = (size_t)(dst - _sprof.json.ptr);
+}
+
+_SOKOL_PRIVATE void _sprof_json_int(int64_t val) {
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%lld", (long long)val);
+    _sprof_json_str(buf);
+}
+
+// Chrome trace timestamps are in microseconds
+_SOKOL_PRIVATE void _sprof_json_us(uint64_t ticks) {
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%.3f", stm_us(ticks));
+    _sprof_json_str(buf);
+}
+
+_SOKOL_PRIVATE void _sprof_json_thread_name(uint32_t tid, const char* name) {
+    _sprof_json_str("{\"ph\":\"M\",\"pid\":1,\"tid\":");
+    _sprof_json_int(tid);
+    _sprof_json_str(",\"name\":\"thread_name\",\"args\":{\"name\":");
+    _sprof_json_quoted(name);
+    _sprof_json_str("}},\n");
+}
+
+_SOKOL_PRIVATE void _sprof_json_event(const _sprof_event_t* ev, uint64_t base_ts) {
+    const _sprof_event_info_t* info = &_sprof_event_infos[ev->type];
+    _sprof_json_str("{\"ph\":");
+    _sprof_json_str(ev->instant ? "\"i\",\"s\":\"t\"" : "\"X\"");
+    _sprof_json_str(",\"pid\":1,\"tid\":");
+    _sprof_json_int(ev->tid);
+    _sprof_json_str(",\"ts\":");
+    _sprof_json_us((ev->ts > base_ts) ? (ev->ts - base_ts) : 0);
+    if (!ev->instant) {
+        _sprof_json_str(",\"dur\":");
+        _sprof_json_us(ev->dur);
+    }
+    _sprof_json_str(",\"cat\":");
+    _sprof_json_str((ev->type == _SPROF_GFX_EVENT_ZONE) ? "\"cpu\"" : "\"sg\"");
+    _sprof_json_str(",\"name\":");
+    _sprof_json_quoted((ev->type == _SPROF_GFX_EVENT_ZONE) ? (ev->name ? ev->name : "zone") : info->name);
+    if (ev->type == _SPROF_GFX_EVENT_ZONE) {
+        _sprof_json_str(",\"args\":{\"depth\":");
+        _sprof_json_int(ev->args[0]);
+        _sprof_json_str("}");
+    } else if (info->arg_names[0]) {
+        _sprof_json_str(",\"args\":{");
+        for (int i = 0; (i < _SPROF_MAX_ARGS) && info->arg_names[i]; i++) {
+            if (i > 0) {
+                _sprof_json_str(",");
+            }
+            _sprof_json_quoted(info->arg_names[i]);
+            _sprof_json_str(":");
+            _sprof_json_int(ev->args[i]);
+        }
+        _sprof_json_str("}");
+    }
+    _sprof_json_str("},\n");
+}
+
+_SOKOL_PRIVATE void _sprof_write_file(const char* path, sg_range data) {
+    FILE* fp = fopen(path, "wb");
+    if (0 == fp) {
+        _SPROF_ERROR(FILE_OPEN_FAILED);
+        return;
+    }
+    if (fwrite(data.ptr, data.size, 1, fp) != 1) {
+        _SPROF_ERROR(FILE_WRITE_FAILED);
+    } else {
+        _SPROF_INFO(TRACE_WRITTEN);
+    }
+    fclose(fp);
+}
+
+// ██████  ██    ██ ██████  ██      ██  ██████
+// ██   ██ ██    ██ ██   ██ ██      ██ ██
+// ██████  ██    ██ ██████  ██      ██ ██
+// ██      ██    ██ ██   ██ ██      ██ ██
+// ██       ██████  ██████  ███████ ██  ██████
+//
+// >>public
+_SOKOL_PRIVATE sprof_desc _sprof_desc_defaults(const sprof_desc* desc) {
+    SOKOL_ASSERT((desc->allocator.alloc_fn && desc->allocator.free_fn) || (!desc->allocator.alloc_fn && !desc->allocator.free_fn));
+    sprof_desc res = *desc;
+    res.max_frames = (0 == res.max_frames) ? _SPROF_DEFAULT_MAX_FRAMES : res.max_frames;
+    res.max_events = (0 == res.max_events) ? _SPROF_DEFAULT_MAX_EVENTS : res.max_events;
+    res.path = (0 == res.path) ? _SPROF_DEFAULT_PATH : res.path;
+    res.dump_key = (0 == res.dump_key) ? _SPROF_DEFAULT_DUMP_KEY : res.dump_key;
+    return res;
+}
+
+SOKOL_API_IMPL void sprof_setup(const sprof_desc* desc) {
+    SOKOL_ASSERT(desc);
+    SOKOL_ASSERT(!_sprof.valid);
+    _sprof_clear(&_sprof, sizeof(_sprof));
+    _sprof.desc = _sprof_desc_defaults(desc);
+    SOKOL_ASSERT((_sprof.desc.max_frames > 0) && (_sprof.desc.max_events > 0));
+    _sprof.valid = true;
+    _sprof.events = (_sprof_event_t*) _sprof_malloc_clear((size_t)_sprof.desc.max_events * sizeof(_sprof_event_t));
+    _sprof.frame_first_event = (uint64_t*) _sprof_malloc_clear((size_t)_sprof.desc.max_frames * sizeof(uint64_t));
+    _sprof.frame_start = stm_now();
+
+    sg_trace_hooks hooks;
+    _sprof_clear(&hooks, sizeof(hooks));
+    hooks.make_buffer = _sprof_make_buffer;
+    hooks.make_image = _sprof_make_image;
+    hooks.make_sampler = _sprof_make_sampler;
+    hooks.make_shader = _sprof_make_shader;
+    hooks.make_pipeline = _sprof_make_pipeline;
+    hooks.make_view = _sprof_make_view;
+    hooks.destroy_buffer = _sprof_destroy_buffer;
+    hooks.destroy_image = _sprof_destroy_image;
+    hooks.destroy_sampler = _sprof_destroy_sampler;
+    hooks.destroy_shader = _sprof_destroy_shader;
+    hooks.destroy_pipeline = _sprof_destroy_pipeline;
+    hooks.destroy_view = _sprof_destroy_view;
+    hooks.update_buffer = _sprof_update_buffer;
+    hooks.update_image = _sprof_update_image;
+    hooks.append_buffer = _sprof_append_buffer;
+    hooks.begin_pass = _sprof_begin_pass;
+    hooks.apply_viewport = _sprof_apply_viewport;
+    hooks.apply_scissor_rect = _sprof_apply_scissor_rect;
+    hooks.apply_pipeline = _sprof_apply_pipeline;
+    hooks.apply_bindings = _sprof_apply_bindings;
+    hooks.apply_uniforms = _sprof_apply_uniforms;
+    hooks.draw = _sprof_draw;
+    hooks.draw_ex = _sprof_draw_ex;
+    hooks.dispatch = _sprof_dispatch;
+    hooks.end_pass = _sprof_end_pass;
+    hooks.commit = _sprof_commit;
+    // the previous hooks are called from our hooks for proper chaining
+    _sprof.hooks = sg_install_trace_hooks(&hooks);
+}
+
+SOKOL_API_IMPL void sprof_shutdown(void) {
+    SOKOL_ASSERT(_sprof.valid);
+    sg_install_trace_hooks(&_sprof.hooks);
+    _sprof_free(_sprof.events);
+    _sprof_free(_sprof.frame_first_event);
+    if (_sprof.json.ptr) {
+        _sprof_free(_sprof.json.ptr);
+    }
+    _sprof.valid = false;
+}
+
+SOKOL_API_IMPL bool sprof_dump(void) {
+    SOKOL_ASSERT(_sprof.valid);
+    const uint64_t max_events = (uint64_t)_sprof.desc.max_events;
+    const uint64_t max_frames = (uint64_t)_sprof.desc.max_frames;
+
+    // the first event of the oldest recorded frame, unless it has already been overwritten
+    const uint64_t first_frame = (_sprof.frame_index >= max_frames) ? (_sprof.frame_index + 1 - max_frames) : 0;
+    uint64_t first_event = _sprof.frame_first_event[first_frame % max_frames];
+    const uint64_t oldest_event = (_sprof.num_events > max_events) ? (_sprof.num_events - max_events) : 0;
+    if (first_event < oldest_event) {
+        _SPROF_WARN(FRAMES_DROPPED);
+        first_event = oldest_event;
+    }
+    // timestamps relative to the start of the first event, so the trace starts at zero
+    uint64_t base_ts = UINT64_MAX;
+    for (uint64_t i = first_event; i < _sprof.num_events; i++) {
+        const _sprof_event_t* ev = &_sprof.events[i % max_events];
+        if (ev->ts < base_ts) {
+            base_ts = ev->ts;
+        }
+    }
+
+    _sprof.json.pos = 0;
+    _sprof_json_str("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    _sprof_json_str("{\"ph\":\"M\",\"pid\":1,\"name\":\"process_name\",\"args\":{\"name\":\"sokol\"}},\n");
+    _sprof_json_thread_name(_SPROF_TID_GFX, "sokol-gfx");
+    for (uint32_t tid = 1; tid <= _sprof.max_zone_tid; tid++) {
+        char name[32];
+        snprintf(name, sizeof(name), "thread %u", tid - 1);
+        _sprof_json_thread_name(tid, name);
+    }
+    for (uint64_t i = first_event; i < _sprof.num_events; i++) {
+        _sprof_json_event(&_sprof.events[i % max_events], base_ts);
+    }
+    // remove the trailing comma
+    SOKOL_ASSERT(_sprof.json.pos >= 2);
+    _sprof.json.pos -= 2;
+    _sprof_json_str("\n]}\n");
+
+    const sg_range data = { _sprof.json.ptr, _sprof.json.pos };
+    if (_sprof.desc.dump_cb) {
+        _sprof.desc.dump_cb(data, _sprof.desc.user_data);
+    } else {
+        _sprof_write_file(_sprof.desc.path, data);
+    }
+    return true;
+}
+
+#if defined(SOKOL_APP_INCLUDED)
+SOKOL_API_IMPL bool sprof_handle_event(const sapp_event* ev) {
+    SOKOL_ASSERT(_sprof.valid && ev);
+    if ((ev->type == SAPP_EVENTTYPE_KEY_DOWN) && ((int)ev->key_code == _sprof.desc.dump_key)) {
+        if (!ev->key_repeat) {
+            sprof_dump();
+        }
+        return true;
+    }
+    return false;
+}
+#endif
+
+#endif // SOKOL_PROFILER_IMPL
@@ -0,0 +1,1379 @@
+#if defined(SOKOL_IMPL) && !defined(SOKOL_SNAPSHOT_IMPL)
+#define SOKOL_SNAPSHOT_IMPL
+#endif
+#ifndef SOKOL_SNAPSHOT_INCLUDED
+/*
+    sokol_snapshot.h -- render PNG image snapshots with sokol_gfx.h
+
+    Project URL: https://github.com/floooh/sokol
+
+    Do this:
+        #define SOKOL_IMPL or
+        #define SOKOL_SNAPSHOT_IMPL
+    before you include this file in *one* C or C++ file to create the
+    implementation.
+
+    The implementation must be compiled together with the GL backend of
+    sokol_gfx.h (SOKOL_GLCORE or SOKOL_GLES3), since the image readback
+    is built on top of the sg_gl_*_readback() functions.
+
+    ...optionally provide the following macros to override defaults:
+
+    SOKOL_ASSERT(c)         - your own assert macro (default: assert(c))
+    SOKOL_SNAPSHOT_API_DECL - public function declaration prefix (default: extern)
+    SOKOL_API_DECL          - same as SOKOL_SNAPSHOT_API_DECL
+    SOKOL_API_IMPL          - public function implementation prefix (default: -)
+    SOKOL_UNREACHABLE()     - a guard macro for unreachable code (default: assert(false))
+    SOKOL_SNAPSHOT_THREAD_LOCAL - keep the sokol-snapshot state in thread-local storage
+    SOKOL_SNAPSHOT_WORKERS  - enable ssnap_run_workers() (Linux with EGL only, implies
+                              SOKOL_SNAPSHOT_THREAD_LOCAL, see PARALLEL SNAPSHOT WORKERS)
+
+    If sokol_snapshot.h is compiled as a DLL, define the following before
+    including the declaration or implementation:
+
+    SOKOL_DLL
+
+    On Windows, SOKOL_DLL will define SOKOL_SNAPSHOT_API_DECL as __declspec(dllexport)
+    or __declspec(dllimport) as needed.
+
+    Include the following headers before including sokol_snapshot.h:
+
+        sokol_gfx.h
+
+    OVERVIEW
+    ========
+    sokol_snapshot.h renders a batch of images (for instance chart
+    thumbnails) into an offscreen render target, reads the result back
+    into CPU memory asynchronously, encodes it as PNG and writes it into
+    a file (or hands the PNG data to a callback).
+
+    All GPU resources (render target images, attachment views and readback
+    buffers) and all CPU side buffers are created once in ssnap_setup() and
+    are reused for all snapshots, so that rendering thousands of snapshots
+    in one process doesn't cause any resource churn.
+
+    Together with the headless mode of sokol_app.h (sapp_desc.headless),
+    snapshots can be rendered on servers without display and GPU (with
+    Mesa's llvmpipe software rasterizer).
+
+    STEP BY STEP
+    ============
+    --- after sg_setup(), call ssnap_setup() with the snapshot size:
+
+            ssnap_setup(&(ssnap_desc){
+                .width = 320,
+                .height = 200,
+                .logger.func = slog_func,
+            });
+
+        The following ssnap_desc items are optional:
+
+        .sample_count   - the MSAA sample count (default: 1)
+        .depth_format   - the depth-stencil pixel format (default: SG_PIXELFORMAT_DEPTH_STENCIL),
+                          use SG_PIXELFORMAT_NONE for no depth-stencil buffer
+        .max_inflight   - the max number of readbacks in flight (default: 3)
+        .snapshot_cb    - a callback which receives the PNG data instead of writing a file
+        .user_data      - a user data pointer passed into the snapshot callback
+        .allocator      - optional memory allocation callbacks
+        .logger         - optional logging callback
+
+        The color pixel format is always SG_PIXELFORMAT_RGBA8. Pipeline objects
+        which are used in snapshot passes must be created with matching
+        pixel formats and sample count. With the default ssnap_desc values
+        and sokol_app.h on GL, these match the sokol-gfx defaults.
+
+    --- for each snapshot, render into the snapshot render target:
+
+            ssnap_begin_pass(&pass_action);
+            sg_apply_pipeline(...);
+            ...
+            ssnap_end_pass("charts/AAPL.png");
+
+        ssnap_begin_pass() and ssnap_end_pass() replace the sg_begin_pass() and
+        sg_end_pass() calls. ssnap_end_pass() starts an asynchronous
+        readback of the rendered image and returns immediately, unless all
+        readback slots are busy, in which case the oldest snapshot is
+        finished first (which may wait for the GPU).
+
+        Any number of snapshots can be rendered per frame, and sg_commit()
+        must be called at the end of the frame as usual.
+
+    --- once per frame, finish those snapshots which are ready without waiting:
+
+            ssnap_poll();
+
+    --- before shutting down (or when all snapshots must have been written),
+        wait for and finish all pending snapshots:
+
+            ssnap_flush();
+
+    --- finally, before sg_shutdown(), call:
+
+            ssnap_shutdown();
+
+    Finishing a snapshot means copying the pixel data out of the readback
+    buffer, encoding it as PNG and either writing the PNG file or calling
+    the snapshot callback with the path string and the PNG data (the PNG
+    data is only valid until the callback returns).
+
+    The built-in PNG encoder can also be used directly:
+
+        sg_range ssnap_encode_png(const void* pixels, int width, int height)
+
+    This encodes tightly packed RGBA8 pixels in top-to-bottom row order,
+    the returned memory is owned by sokol_snapshot.h and is only valid
+    until the next call. The PNG encoder is tuned for speed over size (it
+    uses a single pass LZ77 matcher and fixed Huffman codes), which works
+    well for images with large uniformly colored areas like charts.
+
+    PARALLEL SNAPSHOT WORKERS
+    =========================
+    A single GL context serializes all rendering, which leaves most CPU cores
+    idle when rendering with a software rasterizer like llvmpipe on a
+    many-core server. To render snapshots in parallel, compile the
+    sokol_snapshot.h implementation with SOKOL_SNAPSHOT_WORKERS and the
+    sokol_gfx.h implementation with SOKOL_GFX_THREAD_LOCAL (so that each
+    thread can have its own sokol-gfx instance), and link with -lEGL
+    and -pthread. Then call:
+
+        bool ssnap_run_workers(const ssnap_workers_desc* desc)
+
+    This starts a number of worker threads, and each worker thread:
+
+        - creates its own EGL context without surface (EGL_KHR_surfaceless_context)
+        - calls sg_setup() with ssnap_workers_desc.gfx, and ssnap_setup() with
+          ssnap_workers_desc.snapshot
+        - calls the optional init callback to create per-worker resources
+          (shaders, pipelines, buffers...)
+        - calls the job callback for each job it takes from the job queue,
+          followed by sg_commit() and ssnap_poll()
+        - finally calls ssnap_flush(), the optional cleanup callback,
+          ssnap_shutdown() and sg_shutdown() and destroys its context
+
+    Jobs are identified by an index in the range 0..num_jobs-1. Each worker
+    starts with an equally sized range of jobs, and a worker which runs out
+    of jobs steals half of the remaining jobs from the worker with the most
+    remaining jobs, so that the workload is balanced even if jobs take a
+    very different amount of time.
+
+        ssnap_run_workers(&(ssnap_workers_desc){
+            .num_jobs = num_charts,
+            .init_cb = worker_init,     // void worker_init(int worker_index, void* user_data)
+            .job_cb = render_chart,     // void render_chart(int job_index, int worker_index, void* user_data)
+            .cleanup_cb = worker_cleanup,
+            .user_data = &charts,
+            .gfx = { .logger.func = slog_func },
+            .snapshot = { .width = 320, .height = 200, .logger.func = slog_func },
+        });
+
+    Inside the job callback, render the snapshot with ssnap_begin_pass()
+    and ssnap_end_pass() as usual. All callbacks are called on the worker
+    threads, so any state shared between jobs must be thread-safe.
+
+    Optional ssnap_workers_desc items:
+
+        .num_workers        - the number of worker threads (default: number of online CPU cores)
+        .egl_display        - an initialized EGLDisplay to use (for instance from sapp_egl_get_display()),
+                              by default the workers use their own EGL display (with
+                              the Mesa surfaceless platform if available)
+        .gl_major_version   - the requested GL version (default: 4.1 for GL, 3.0 for GLES3)
+        .gl_minor_version
+
+    The function returns after all jobs have been processed and all
+    worker threads have finished, the return value is false if not all
+    jobs could be processed (for instance because no worker thread was
+    able to create a GL context).
+
+    Without SOKOL_SNAPSHOT_WORKERS, ssnap_run_workers() runs all jobs
+    sequentially on the calling thread with the sokol-gfx and sokol-snapshot
+    instances which have already been set up there (the worker index is
+    always 0, and the .gfx and .snapshot items are ignored).
+
+    MEMORY ALLOCATION OVERRIDE
+    ==========================
+    You can override the memory allocation functions at initialization time
+    like this:
+
+        void* my_alloc(size_t size, void* user_data) {
+            return malloc(size);
+        }
+
+        void my_free(void* ptr, void* user_data) {
+            free(ptr);
+        }
+
+        ...
+            ssnap_setup(&(ssnap_desc){
+                // ...
+                .allocator = {
+                    .alloc_fn = my_alloc,
+                    .free_fn = my_free,
+                    .user_data = ...,
+                }
+            });
+        ...
+
+    If no overrides are provided, malloc and free will be used.
+
+    ERROR REPORTING AND LOGGING
+    ===========================
+    To get any logging information at all you need to provide a logging callback in the setup call,
+    the easiest way is to use sokol_log.h:
+
+        #include "sokol_log.h"
+
+        ssnap_setup(&(ssnap_desc){
+            .logger.func = slog_func
+        });
+
+    LICENSE
+    =======
+    zlib/libpng license
+
+    Copyright (c) 2026 the sokol contributors
+
+    This software is provided 'as-is', without any express or implied warranty.
+    In no event will the authors be held liable for any damages arising from the
+    use of this software.
+
+    Permission is granted to anyone to use this software for any purpose,
+    including commercial applications, and to alter it and redistribute it
+    freely, subject to the following restrictions:
+
+        1. The origin of this software must not be misrepresented; you must not
+        claim that you wrote the original software. If you use this software in a
+        product, an acknowledgment in the product documentation would be
+        appreciated but is not required.
+
+        2. Altered source versions must be plainly marked as such, and must not
+        be misrepresented as being the original software.
+
+        3. This notice may not be removed or altered from any source
+        distribution.
+*/
+#define SOKOL_SNAPSHOT_INCLUDED (1)
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h> // size_t
+
+#if !defined(SOKOL_GFX_INCLUDED)
+#error "Please include sokol_gfx.h before sokol_snapshot.h"
+#endif
+
+#if defined(SOKOL_API_DECL) && !defined(SOKOL_SNAPSHOT_API_DECL)
+#define SOKOL_SNAPSHOT_API_DECL SOKOL_API_DECL
+#endif
+#ifndef SOKOL_SNAPSHOT_API_DECL
+#if defined(_WIN32) && defined(SOKOL_DLL) && defined(SOKOL_SNAPSHOT_IMPL)
+#define SOKOL_SNAPSHOT_API_DECL __declspec(dllexport)
+#elif defined(_WIN32) && defined(SOKOL_DLL)
+#define SOKOL_SNAPSHOT_API_DECL __declspec(dllimport)
+#else
+#define SOKOL_SNAPSHOT_API_DECL extern
+#endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SSNAP_MAX_PATH_LENGTH (512)
+
+/*
+    ssnap_log_item_t
+
+    Log items are defined via X-Macros, and expanded to an
+    enum 'ssnap_log_item' - and in debug mode only - corresponding strings.
+
+    Used as parameter in the logging callback.
+*/
+#define _SSNAP_LOG_ITEMS \
+    _SSNAP_LOGITEM_XMACRO(OK, "Ok") \
+    _SSNAP_LOGITEM_XMACRO(MALLOC_FAILED, "memory allocation failed") \
+    _SSNAP_LOGITEM_XMACRO(ALREADY_IN_PASS, "ssnap_begin_pass(): already inside a snapshot pass") \
+    _SSNAP_LOGITEM_XMACRO(NOT_IN_PASS, "ssnap_end_pass(): not inside a snapshot pass") \
+    _SSNAP_LOGITEM_XMACRO(PATH_TOO_LONG, "ssnap_end_pass(): path string is too long (see SSNAP_MAX_PATH_LENGTH)") \
+    _SSNAP_LOGITEM_XMACRO(READBACK_FAILED, "failed to read back snapshot image (only supported on GL backends)") \
+    _SSNAP_LOGITEM_XMACRO(FILE_OPEN_FAILED, "failed to open snapshot file for writing") \
+    _SSNAP_LOGITEM_XMACRO(FILE_WRITE_FAILED, "failed to write snapshot file") \
+    _SSNAP_LOGITEM_XMACRO(WORKERS_EGL_GET_DISPLAY_FAILED, "ssnap_run_workers(): failed to get EGL display") \
+    _SSNAP_LOGITEM_XMACRO(WORKERS_EGL_NO_SURFACELESS_CONTEXT, "ssnap_run_workers(): EGL_KHR_surfaceless_context not supported") \
+    _SSNAP_LOGITEM_XMACRO(WORKERS_EGL_NO_CONFIG, "ssnap_run_workers(): eglChooseConfig() failed") \
+    _SSNAP_LOGITEM_XMACRO(WORKERS_EGL_CREATE_CONTEXT_FAILED, "ssnap_run_workers(): failed to create EGL context for worker thread") \
+    _SSNAP_LOGITEM_XMACRO(WORKERS_CREATE_THREAD_FAILED, "ssnap_run_workers(): failed to create worker thread") \
+    _SSNAP_LOGITEM_XMACRO(WORKERS_JOBS_NOT_FINISHED, "ssnap_run_workers(): not all jobs have been processed") \
+
+#define _SSNAP_LOGITEM_XMACRO(item,msg) SSNAP_LOGITEM_##item,
+typedef enum ssnap_log_item_t {
+    _SSNAP_LOG_ITEMS
+} ssnap_log_item_t;
+#undef _SSNAP_LOGITEM_XMACRO
+
+/*
+    ssnap_allocator_t
+
+    Used in ssnap_desc to provide custom memory-alloc and -free functions
+    to sokol_snapshot.h. If memory management should be overridden, both the
+    alloc_fn and free_fn function must be provided (e.g. it's not valid to
+    override one function but not the other).
+*/
+typedef struct ssnap_allocator_t {
+    void* (*alloc_fn)(size_t size, void* user_data);
+    void (*free_fn)(void* ptr, void* user_data);
+    void* user_data;
+} ssnap_allocator_t;
+
+/*
+    ssnap_logger_t
+
+    Used in ssnap_desc to provide a logging function. Please be aware that
+    without logging function, sokol-snapshot will be completely silent, e.g. it will
+    not report errors or warnings. For maximum error verbosity, compile in
+    debug mode (e.g. NDEBUG *not* defined) and install a logger (for instance
+    the standard logging function from sokol_log.h).
+*/
+typedef struct ssnap_logger_t {
+    void (*func)(
+        const char* tag,                // always "ssnap"
+        uint32_t log_level,             // 0=panic, 1=error, 2=warning, 3=info
+        uint32_t log_item_id,           // SSNAP_LOGITEM_*
+        const char* message_or_null,    // a message string, may be nullptr in release mode
+        uint32_t line_nr,               // line number in sokol_snapshot.h
+        const char* filename_or_null,   // source filename, may be nullptr in release mode
+        void* user_data);
+    void* user_data;
+} ssnap_logger_t;
+
+/*
+    ssnap_desc
+
+    The setup parameters for ssnap_setup(), see the documentation
+    section STEP BY STEP for details.
+*/
+typedef struct ssnap_desc {
+    int width;                      // snapshot width in pixels (default: 256)
+    int height;                     // snapshot height in pixels (default: 256)
+    int sample_count;               // MSAA sample count (default: 1)
+    sg_pixel_format depth_format;   // default: SG_PIXELFORMAT_DEPTH_STENCIL
+    int max_inflight;               // max number of readbacks in flight (default: 3)
+    void (*snapshot_cb)(const char* path, sg_range png_data, void* user_data);  // optional, called instead of writing a file
+    void* user_data;
+    ssnap_allocator_t allocator;
+    ssnap_logger_t logger;
+} ssnap_desc;
+
+/*
+    ssnap_workers_desc
+
+    The parameters for ssnap_run_workers(), see the documentation
+    section PARALLEL SNAPSHOT WORKERS for details.
+*/
+typedef struct ssnap_workers_desc {
+    int num_workers;            // default: number of online CPU cores
+    int num_jobs;
+    void (*init_cb)(int worker_index, void* user_data);                 // optional
+    void (*job_cb)(int job_index, int worker_index, void* user_data);
+    void (*cleanup_cb)(int worker_index, void* user_data);              // optional
+    void* user_data;
+    const void* egl_display;    // optional, an initialized EGLDisplay
+    int gl_major_version;       // default: 4 (GL) or 3 (GLES3)
+    int gl_minor_version;       // default: 1 (GL) or 0 (GLES3)
+    sg_desc gfx;                // sg_setup() params for each worker
+    ssnap_desc snapshot;        // ssnap_setup() params for each worker
+} ssnap_workers_desc;
+
+/* setup and shutdown */
+SOKOL_SNAPSHOT_API_DECL void ssnap_setup(const ssnap_desc* desc);
+SOKOL_SNAPSHOT_API_DECL void ssnap_shutdown(void);
+/* start a render pass into the snapshot render target */
+SOKOL_SNAPSHOT_API_DECL void ssnap_begin_pass(const sg_pass_action* action);
+/* end the snapshot render pass and start the readback of the snapshot into 'path' */
+SOKOL_SNAPSHOT_API_DECL bool ssnap_end_pass(const char* path);
+/* finish snapshots which are ready without waiting, return number of finished snapshots */
+SOKOL_SNAPSHOT_API_DECL int ssnap_poll(void);
+/* wait for and finish all pending snapshots, return number of finished snapshots */
+SOKOL_SNAPSHOT_API_DECL int ssnap_flush(void);
+/* get the (resolved) snapshot color image */
+SOKOL_SNAPSHOT_API_DECL sg_image ssnap_color_image(void);
+/* encode RGBA8 pixels as PNG, the returned memory is valid until the next call */
+SOKOL_SNAPSHOT_API_DECL sg_range ssnap_encode_png(const void* pixels, int width, int height);
+/* render jobs in parallel on worker threads (needs SOKOL_SNAPSHOT_WORKERS) */
+SOKOL_SNAPSHOT_API_DECL bool ssnap_run_workers(const ssnap_workers_desc* desc);
+
+#ifdef __cplusplus
+} // extern "C"
+
+// reference-based equivalents for C++
+inline void ssnap_setup(const ssnap_desc& desc) { return ssnap_setup(&desc); }
+inline void ssnap_begin_pass(const sg_pass_action& action) { return ssnap_begin_pass(&action); }
+inline bool ssnap_run_workers(const ssnap_workers_desc& desc) { return ssnap_run_workers(&desc); }
+
+#endif
+#endif // SOKOL_SNAPSHOT_INCLUDED
+
+// ██ ███    ███ ██████  ██      ███████ ███    ███ ███████ ███    ██ ████████  █████  ████████ ██  ██████  ███    ██
+// ██ ████  ████ ██   ██ ██      ██      ████  ████ ██      ████   ██    ██    ██   ██    ██    ██ ██    ██ ████   ██
+// ██ ██ ████ ██ ██████  ██      █████   ██ ████ ██ █████   ██ ██  ██    ██    ███████    ██    ██ ██    ██ ██ ██  ██
+// ██ ██  ██  ██ ██      ██      ██      ██  ██  ██ ██      ██  ██ ██    ██    ██   ██    ██    ██ ██    ██ ██  ██ ██
+// ██ ██      ██ ██      ███████ ███████ ██      ██ ███████ ██   ████    ██    ██   ██    ██    ██  ██████  ██   ████
+//
+// >>implementation
+#ifdef SOKOL_SNAPSHOT_IMPL
+#define SOKOL_SNAPSHOT_IMPL_INCLUDED (1)
+
+#include <stdlib.h> // malloc, free
+#include <string.h> // memset, memcpy, strlen
+#include <stdio.h>  // fopen, fwrite, fclose
+
+#if defined(SOKOL_SNAPSHOT_WORKERS)
+    #if !defined(__linux__)
+    #error "sokol_snapshot.h: SOKOL_SNAPSHOT_WORKERS is only supported on Linux"
+    #endif
+    #if !defined(SOKOL_GLCORE) && !defined(SOKOL_GLES3)
+    #error "sokol_snapshot.h: SOKOL_SNAPSHOT_WORKERS requires SOKOL_GLCORE or SOKOL_GLES3"
+    #endif
+    #if defined(SOKOL_GFX_IMPL_INCLUDED) && !defined(SOKOL_GFX_THREAD_LOCAL)
+    #error "sokol_snapshot.h: SOKOL_SNAPSHOT_WORKERS requires the sokol_gfx.h implementation to be compiled with SOKOL_GFX_THREAD_LOCAL"
+    #endif
+    #ifndef SOKOL_SNAPSHOT_THREAD_LOCAL
+    #define SOKOL_SNAPSHOT_THREAD_LOCAL
+    #endif
+    #include <EGL/egl.h>
+    #include <pthread.h>
+    #include <unistd.h> // sysconf
+#endif
+
+#ifndef SOKOL_API_IMPL
+    #define SOKOL_API_IMPL
+#endif
+#ifndef SOKOL_DEBUG
+    #ifndef NDEBUG
+        #define SOKOL_DEBUG
+    #endif
+#endif
+#ifndef SOKOL_ASSERT
+    #include <assert.h>
+    #define SOKOL_ASSERT(c) assert(c)
+#endif
+#ifndef _SOKOL_PRIVATE
+    #if defined(__GNUC__) || defined(__clang__)
+        #define _SOKOL_PRIVATE __attribute__((unused)) static
+    #else
+        #define _SOKOL_PRIVATE static
+    #endif
+#endif
+#ifndef _SOKOL_UNUSED
+    #define _SOKOL_UNUSED(x) (void)(x)
+#endif
+
+#define _SSNAP_DEFAULT_SIZE (256)
+#define _SSNAP_DEFAULT_MAX_INFLIGHT (3)
+#define _SSNAP_HASH_BITS (15)
+#define _SSNAP_HASH_SIZE (1 << _SSNAP_HASH_BITS)
+#define _SSNAP_WINDOW_SIZE (32768)
+#define _SSNAP_MIN_MATCH (3)
+#define _SSNAP_MAX_MATCH (258)
+
+typedef struct {
+    bool pending;
+    sg_gl_readback readback;
+    char path[SSNAP_MAX_PATH_LENGTH];
+} _ssnap_slot_t;
+
+// the PNG encoder scratch buffers and state
+typedef struct {
+    uint8_t* raw;               // filtered scanlines
+    size_t raw_size;
+    uint8_t* buf;               // the encoded PNG
+    size_t buf_size;
+    size_t pos;
+    uint32_t bit_buf;
+    int bit_count;
+    int32_t* hash;              // last position for each 3-byte hash
+    uint32_t crc_table[256];
+} _ssnap_png_t;
+
+typedef struct {
+    bool valid;
+    bool in_pass;
+    ssnap_desc desc;
+    sg_image color_img;
+    sg_image resolve_img;
+    sg_image depth_img;
+    sg_view color_view;
+    sg_view resolve_view;
+    sg_view depth_view;
+    int num_slots;
+    int next_slot;              // the next slot to use, also the oldest pending slot
+    _ssnap_slot_t* slots;
+    uint8_t* pixels;
+    size_t pixels_size;
+    _ssnap_png_t png;
+} _ssnap_t;
+#if defined(SOKOL_SNAPSHOT_THREAD_LOCAL)
+    #if defined(__cplusplus)
+        #define _SSNAP_THREAD_LOCAL thread_local
+    #elif defined(_MSC_VER)
+        #define _SSNAP_THREAD_LOCAL __declspec(thread)
+    #elif defined(__GNUC__) || defined(__clang__)
+        #define _SSNAP_THREAD_LOCAL __thread
+    #else
+        #define _SSNAP_THREAD_LOCAL _Thread_local
+    #endif
+#else
+    #define _SSNAP_THREAD_LOCAL
+#endif
+static _SSNAP_THREAD_LOCAL _ssnap_t _ssnap;
+
+// ██       ██████   ██████   ██████  ██ ███    ██  ██████
+// ██      ██    ██ ██       ██       ██ ████   ██ ██
+// ██      ██    ██ ██   ███ ██   ███ ██ ██ ██  ██ ██   ███
+// ██      ██    ██ ██    ██ ██    ██ ██ ██  ██ ██ ██    ██
+// ███████  ██████   ██████   ██████  ██ ██   ████  ██████
+//
+// >>logging
+#if defined(SOKOL_DEBUG)
+#define _SSNAP_LOGITEM_XMACRO(item,msg) #item ": " msg,
+static const char* _ssnap_log_messages[] = {
+    _SSNAP_LOG_ITEMS
+};
+#undef _SSNAP_LOGITEM_XMACRO
+#endif // SOKOL_DEBUG
+
+#define _SSNAP_PANIC(code) _ssnap_log(&_ssnap.desc.logger, SSNAP_LOGITEM_ ##code, 0, __LINE__)
+#define _SSNAP_ERROR(code) _ssnap_log(&_ssnap.desc.logger, SSNAP_LOGITEM_ ##code, 1, __LINE__)
+#define _SSNAP_WARN(code) _ssnap_log(&_ssnap.desc.logger, SSNAP_LOGITEM_ ##code, 2, __LINE__)
+#define _SSNAP_INFO(code) _ssnap_log(&_ssnap.desc.logger, SSNAP_LOGITEM_ ##code, 3, __LINE__)
+// logging outside of ssnap_setup()/ssnap_shutdown() with an explicit logger
+#define _SSNAP_ERROR_WITH(logger,code) _ssnap_log(logger, SSNAP_LOGITEM_ ##code, 1, __LINE__)
+
+static void _ssnap_log(const ssnap_logger_t* logger, ssnap_log_item_t log_item, uint32_t log_level, uint32_t line_nr) {
+    if (logger->func) {
+        #if defined(SOKOL_DEBUG)
+            const char* filename = __FILE__;
+            const char* message = _ssnap_log_messages[log_item];
+        #else
+            const char* filename = 0;
+            const char* message = 0;
+        #endif
+        logger->func("ssnap", log_level, (uint32_t)log_item, message, line_nr, filename, logger->user_data);
+    } else {
+        // for log level PANIC it would be 'undefined behaviour' to continue
+        if (log_level == 0) {
+            abort();
+        }
+    }
+}
+
+// ███    ███ ███████ ███    ███  ██████  ██████  ██    ██
+// ████  ████ ██      ████  ████ ██    ██ ██   ██  ██  ██
+// ██ ████ ██ █████   ██ ████ ██ ██    ██ ██████    ████
+// ██  ██  ██ ██      ██  ██  ██ ██    ██ ██   ██    ██
+// ██      ██ ███████ ██      ██  ██████  ██   ██    ██
+//
+// >>memory
+_SOKOL_PRIVATE void _ssnap_clear(void* ptr, size_t size) {
+    SOKOL_ASSERT(ptr && (size > 0));
+    memset(ptr, 0, size);
+}
+
+_SOKOL_PRIVATE void* _ssnap_malloc(size_t size) {
+    SOKOL_ASSERT(size > 0);
+    void* ptr;
+    if (_ssnap.desc.allocator.alloc_fn) {
+        ptr = _ssnap.desc.allocator.alloc_fn(size, _ssnap.desc.allocator.user_data);
+    } else {
+        ptr = malloc(size);
+    }
+    if (0 == ptr) {
+        _SSNAP_PANIC(MALLOC_FAILED);
+    }
+    return ptr;
+}
+
+_SOKOL_PRIVATE void* _ssnap_malloc_clear(size_t size) {
+    void* ptr = _ssnap_malloc(size);
+    _ssnap_clear(ptr, size);
+    return ptr;
+}
+
+_SOKOL_PRIVATE void _ssnap_free(void* ptr) {
+    if (_ssnap.desc.allocator.free_fn) {
+        _ssnap.desc.allocator.free_fn(ptr, _ssnap.desc.allocator.user_data);
+    } else {
+        free(ptr);
+    }
+}
+
+// make sure that a scratch buffer has at least the requested size, keeps the
+// buffer if it is big enough, the content is not preserved
+_SOKOL_PRIVATE void _ssnap_reserve(uint8_t** ptr, size_t* cur_size, size_t size) {
+    if (*cur_size < size) {
+        if (*ptr) {
+            _ssnap_free(*ptr);
+        }
+        *ptr = (uint8_t*) _ssnap_malloc(size);
+        *cur_size = size;
+    }
+}
+
+// ██████  ███    ██  ██████
+// ██   ██ ████   ██ ██
+// ██████  ██ ██  ██ ██   ███
+// ██      ██  ██ ██ ██    ██
+// ██      ██   ████  ██████
+//
+// >>png
+static const uint16_t _ssnap_len_base[29] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+static const uint8_t _ssnap_len_extra[29] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+static const uint16_t _ssnap_dist_base[30] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
+};
+static const uint8_t _ssnap_dist_extra[30] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+    7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+
+_SOKOL_PRIVATE void _ssnap_png_init_crc_table(_ssnap_png_t* png) {
+    for (uint32_t n = 0; n < 256; n++) {
+        uint32_t c = n;
+        for (int k = 0; k < 8; k++) {
+            c = (c & 1) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+        }
+        png->crc_table[n] = c;
+    }
+}
+
+_SOKOL_PRIVATE uint32_t _ssnap_png_crc(const _ssnap_png_t* png, const uint8_t* data, size_t len) {
+    uint32_t c = 0xFFFFFFFFu;
+    for (size_t i = 0; i < len; i++) {
+        c = png->crc_table[(c ^ data[i]) & 0xFF] ^ (c >> 8);
+    }
+    return c ^ 0xFFFFFFFFu;
+}
+
+_SOKOL_PRIVATE uint32_t _ssnap_adler32(const uint8_t* data, size_t len) {
+    uint32_t a = 1, b = 0;
+    while (len > 0) {
+        // 5552 is the max number of bytes before the sums must be reduced
+        size_t n = (len < 5552) ? len : 5552;
+        len -= n;
+        while (n--) {
+            a += *data++;
+            b += a;
+        }
+        a %= 65521;
+        b %= 65521;
+    }
+    return (b << 16) | a;
+}
+
+_SOKOL_PRIVATE void _ssnap_png_put_u32(_ssnap_png_t* png, uint32_t val) {
+    png->buf[png->pos++] = (uint8_t)(val >> 24);
+    png->buf[png->pos++] = (uint8_t)(val >> 16);
+    png->buf[png->pos++] = (uint8_t)(val >> 8);
+    png->buf[png->pos++] = (uint8_t)val;
+}
+
+_SOKOL_PRIVATE void _ssnap_png_put_bytes(_ssnap_png_t* png, const void* data, size_t len) {
+    memcpy(png->buf + png->pos, data, len);
+    png->pos += len;
+}
+
+// write bits in deflate's LSB-first bit order
+_SOKOL_PRIVATE void _ssnap_png_put_bits(_ssnap_png_t* png, uint32_t bits, int num_bits) {
+    png->bit_buf |= bits << png->bit_count;
+    png->bit_count += num_bits;
+    while (png->bit_count >= 8) {
+        png->buf[png->pos++] = (uint8_t)png->bit_buf;
+        png->bit_buf >>= 8;
+        png->bit_count -= 8;
+    }
+}
+
+// Huffman codes are stored MSB-first, so they must be bit-reversed
+_SOKOL_PRIVATE void _ssnap_png_put_code(_ssnap_png_t* png, uint32_t code, int num_bits) {
+    uint32_t rev = 0;
+    for (int i = 0; i < num_bits; i++) {
+        rev = (rev << 1) | ((code >> i) & 1);
+    }
+    _ssnap_png_put_bits(png, rev, num_bits);
+}
+
+// write a literal/length symbol with the fixed Huffman code from RFC1951 3.2.6
+_SOKOL_PRIVATE void _ssnap_png_put_litlen(_ssnap_png_t* png, int sym) {
+    if (sym <= 143) {
+        _ssnap_png_put_code(png, (uint32_t)(0x30 + sym), 8);
+    } else if (sym <= 255) {
+        _ssnap_png_put_code(png, (uint32_t)(0x190 + sym - 144), 9);
+    } else if (sym <= 279) {
+        _ssnap_png_put_code(png, (uint32_t)(sym - 256), 7);
+    } else {
+        _ssnap_png_put_code(png, (uint32_t)(0xC0 + sym - 280), 8);
+    }
+}
+
+_SOKOL_PRIVATE void _ssnap_png_put_match(_ssnap_png_t* png, int len, int dist) {
+    int li = 28;
+    while (_ssnap_len_base[li] > len) {
+        li--;
+    }
+    _ssnap_png_put_litlen(png, 257 + li);
+    _ssnap_png_put_bits(png, (uint32_t)(len - _ssnap_len_base[li]), _ssnap_len_extra[li]);
+    int di = 29;
+    while (_ssnap_dist_base[di] > dist) {
+        di--;
+    }
+    _ssnap_png_put_code(png, (uint32_t)di, 5);
+    _ssnap_png_put_bits(png, (uint32_t)(dist - _ssnap_dist_base[di]), _ssnap_dist_extra[di]);
+}
+
+_SOKOL_PRIVATE uint32_t _ssnap_png_hash(const uint8_t* p) {
+    const uint32_t v = (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16);
+    return (v * 2654435761u) >> (32 - _SSNAP_HASH_BITS);
+}
+
+// a single deflate block with fixed Huffman codes, and a greedy LZ77 matcher
+// which only remembers the most recent position for each hash
+_SOKOL_PRIVATE void _ssnap_png_deflate(_ssnap_png_t* png, const uint8_t* data, int len) {
+    for (int i = 0; i < _SSNAP_HASH_SIZE; i++) {
+        png->hash[i] = -1;
+    }
+    png->bit_buf = 0;
+    png->bit_count = 0;
+    _ssnap_png_put_bits(png, 1, 1);     // BFINAL
+    _ssnap_png_put_bits(png, 1, 2);     // BTYPE: fixed Huffman codes
+    int i = 0;
+    while (i < len) {
+        int best_len = 0;
+        int best_dist = 0;
+        if ((i + _SSNAP_MIN_MATCH) <= len) {
+            const uint32_t h = _ssnap_png_hash(data + i);
+            const int cand = png->hash[h];
+            png->hash[h] = i;
+            if ((cand >= 0) && ((i - cand) <= _SSNAP_WINDOW_SIZE)) {
+                const int max_len = ((len - i) < _SSNAP_MAX_MATCH) ? (len - i) : _SSNAP_MAX_MATCH;
+                int l = 0;
+                while ((l < max_len) && (data[cand + l] == data[i + l])) {
+                    l++;
+                }
+                if (l >= _SSNAP_MIN_MATCH) {
+                    best_len = l;
+                    best_dist = i - cand;
+                }
+            }
+        }
+        if (best_len > 0) {
+            _ssnap_png_put_match(png, best_len, best_dist);
+            // update the hash table for the skipped positions
+            const int end = i + best_len;
+            for (i++; (i < end) && ((i + _SSNAP_MIN_MATCH) <= len); i++) {
+                png->hash[_ssnap_png_hash(data + i)] = i;
+            }
+            i = end;
+        } else {
+            _ssnap_png_put_litlen(png, data[i]);
+            i++;
+        }
+    }
+    _ssnap_png_put_litlen(png, 256);    // end of block
+    if (png->bit_count > 0) {
+        _ssnap_png_put_bits(png, 0, 8 - png->bit_count);
+    }
+}
+
+_SOKOL_PRIVATE void _ssnap_png_begin_chunk(_ssnap_png_t* png, const char* type) {
+    png->pos += 4;  // the chunk length is patched in _ssnap_png_end_chunk()
+    _ssnap_png_put_bytes(png, type, 4);
+}
+
+_SOKOL_PRIVATE void _ssnap_png_end_chunk(_ssnap_png_t* png, size_t chunk_start) {
+    const size_t data_len = png->pos - chunk_start - 8;
+    const size_t pos = png->pos;
+    png->pos = chunk_start;
+    _ssnap_png_put_u32(png, (uint32_t)data_len);
+    png->pos = pos;
+    _ssnap_png_put_u32(png, _ssnap_png_crc(png, png->buf + chunk_start + 4, data_len + 4));
+}
+
+_SOKOL_PRIVATE sg_range _ssnap_png_encode(_ssnap_png_t* png, const uint8_t* pixels, int width, int height) {
+    SOKOL_ASSERT(pixels && (width > 0) && (height > 0));
+    const size_t row_size = (size_t)width * 4;
+    const size_t raw_size = (row_size + 1) * (size_t)height;
+    _ssnap_reserve(&png->raw, &png->raw_size, raw_size);
+    // every scanline starts with its filter type, use filter 'none'
+    for (int y = 0; y < height; y++) {
+        uint8_t* dst = png->raw + (size_t)y * (row_size + 1);
+        dst[0] = 0;
+        memcpy(dst + 1, pixels + (size_t)y * row_size, row_size);
+    }
+    // worst case: all literals with 9 bits, plus chunk and zlib overhead
+    _ssnap_reserve(&png->buf, &png->buf_size, raw_size + (raw_size / 8) + 256);
+    png->pos = 0;
+
+    static const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A };
+    _ssnap_png_put_bytes(png, signature, sizeof(signature));
+
+    size_t chunk_start = png->pos;
+    _ssnap_png_begin_chunk(png, "IHDR");
+    _ssnap_png_put_u32(png, (uint32_t)width);
+    _ssnap_png_put_u32(png, (uint32_t)height);
+    static const uint8_t ihdr_tail[5] = {
+        8,  // bit depth
+        6,  // color type: RGBA
+        0,  // compression method
+        0,  // filter method
+        0,  // interlace method
+    };
+    _ssnap_png_put_bytes(png, ihdr_tail, sizeof(ihdr_tail));
+    _ssnap_png_end_chunk(png, chunk_start);
+
+    chunk_start = png->pos;
+    _ssnap_png_begin_chunk(png, "IDAT");
+    static const uint8_t zlib_header[2] = { 0x78, 0x01 };
+    _ssnap_png_put_bytes(png, zlib_header, sizeof(zlib_header));
+    _ssnap_png_deflate(png, png->raw, (int)raw_size);
+    _ssnap_png_put_u32(png, _ssnap_adler32(png->raw, raw_size));
+    _ssnap_png_end_chunk(png, chunk_start);
+
+    chunk_start = png->pos;
+    _ssnap_png_begin_chunk(png, "IEND");
+    _ssnap_png_end_chunk(png, chunk_start);
+
+    SOKOL_ASSERT(png->pos <= png->buf_size);
+    sg_range res = { png->buf, png->pos };
+    return res;
+}
+
+// ███████ ███    ██  █████  ██████  ███████ ██   ██  ██████  ████████ ███████
+// ██      ████   ██ ██   ██ ██   ██ ██      ██   ██ ██    ██    ██    ██
+// ███████ ██ ██  ██ ███████ ██████  ███████ ███████ ██    ██    ██    ███████
+//      ██ ██  ██ ██ ██   ██ ██           ██ ██   ██ ██    ██    ██         ██
+// ███████ ██   ████ ██   ██ ██      ███████ ██   ██  ██████     ██    ███████
+//
+// >>snapshots
+_SOKOL_PRIVATE ssnap_desc _ssnap_desc_defaults(const ssnap_desc* desc) {
+    SOKOL_ASSERT((desc->allocator.alloc_fn && desc->allocator.free_fn) || (!desc->allocator.alloc_fn && !desc->allocator.free_fn));
+    ssnap_desc res = *desc;
+    res.width = (0 == res.width) ? _SSNAP_DEFAULT_SIZE : res.width;
+    res.height = (0 == res.height) ? _SSNAP_DEFAULT_SIZE : res.height;
+    res.sample_count = (0 == res.sample_count) ? 1 : res.sample_count;
+    res.depth_format = (_SG_PIXELFORMAT_DEFAULT == res.depth_format) ? SG_PIXELFORMAT_DEPTH_STENCIL : res.depth_format;
+    res.max_inflight = (0 == res.max_inflight) ? _SSNAP_DEFAULT_MAX_INFLIGHT : res.max_inflight;
+    return res;
+}
+
+_SOKOL_PRIVATE void _ssnap_write_file(const char* path, sg_range data) {
+    FILE* fp = fopen(path, "wb");
+    if (0 == fp) {
+        _SSNAP_ERROR(FILE_OPEN_FAILED);
+        return;
+    }
+    if (fwrite(data.ptr, data.size, 1, fp) != 1) {
+        _SSNAP_ERROR(FILE_WRITE_FAILED);
+    }
+    fclose(fp);
+}
+
+// copy the readback result, encode it as PNG and write it out, this waits
+// for the readback to finish if it hasn't finished yet
+_SOKOL_PRIVATE void _ssnap_finish_slot(_ssnap_slot_t* slot) {
+    SOKOL_ASSERT(slot->pending);
+    slot->pending = false;
+    const sg_range pixels = { _ssnap.pixels, _ssnap.pixels_size };
+    if (!sg_gl_end_readback(&slot->readback, pixels)) {
+        _SSNAP_ERROR(READBACK_FAILED);
+        return;
+    }
+    const sg_range png_data = _ssnap_png_encode(&_ssnap.png, _ssnap.pixels, slot->readback.width, slot->readback.height);
+    if (_ssnap.desc.snapshot_cb) {
+        _ssnap.desc.snapshot_cb(slot->path, png_data, _ssnap.desc.user_data);
+    } else {
+        _ssnap_write_file(slot->path, png_data);
+    }
+}
+
+// finish pending snapshots in the order they were started, if 'wait' is
+// false, stop at the first snapshot which isn't ready yet
+_SOKOL_PRIVATE int _ssnap_finish_pending(bool wait) {
+    int num_finished = 0;
+    for (int i = 0; i < _ssnap.num_slots; i++) {
+        _ssnap_slot_t* slot = &_ssnap.slots[(_ssnap.next_slot + i) % _ssnap.num_slots];
+        if (!slot->pending) {
+            continue;
+        }
+        if (!wait && !sg_gl_readback_ready(&slot->readback)) {
+            break;
+        }
+        _ssnap_finish_slot(slot);
+        num_finished++;
+    }
+    return num_finished;
+}
+
+// ██     ██  ██████  ██████  ██   ██ ███████ ██████  ███████
+// ██     ██ ██    ██ ██   ██ ██  ██  ██      ██   ██ ██
+// ██  █  ██ ██    ██ ██████  █████   █████   ██████  ███████
+// ██ ███ ██ ██    ██ ██   ██ ██  ██  ██      ██   ██      ██
+//  ███ ███   ██████  ██   ██ ██   ██ ███████ ██   ██ ███████
+//
+// >>workers
+#if defined(SOKOL_SNAPSHOT_WORKERS)
+#ifndef EGL_PLATFORM_SURFACELESS_MESA
+#define EGL_PLATFORM_SURFACELESS_MESA 0x31DD
+#endif
+typedef EGLDisplay (*_ssnap_egl_get_platform_display_t)(EGLenum platform, void* native_display, const EGLint* attrib_list);
+
+typedef struct _ssnap_workers_t _ssnap_workers_t;
+
+typedef struct {
+    _ssnap_workers_t* shared;
+    int index;
+    pthread_t thread;
+    bool thread_valid;
+    uint64_t jobs;              // the worker's job range, begin in low 32 bits, end in high 32 bits (accessed via atomics)
+} _ssnap_worker_t;
+
+struct _ssnap_workers_t {
+    ssnap_workers_desc desc;
+    EGLDisplay display;
+    EGLConfig config;
+    int num_workers;
+    _ssnap_worker_t* workers;
+    int num_finished_jobs;      // accessed via atomics
+};
+
+_SOKOL_PRIVATE uint64_t _ssnap_job_range(uint32_t begin, uint32_t end) {
+    return ((uint64_t)end << 32) | begin;
+}
+
+// take the next job from the front of a worker's own job range, returns -1 if empty
+_SOKOL_PRIVATE int _ssnap_pop_job(_ssnap_worker_t* w) {
+    uint64_t range = __atomic_load_n(&w->jobs, __ATOMIC_ACQUIRE);
+    for (;;) {
+        const uint32_t begin = (uint32_t)range;
+        const uint32_t end = (uint32_t)(range >> 32);
+        if (begin >= end) {
+            return -1;
+        }
+        // on failure, 'range' is updated with the current value
+        if (__atomic_compare_exchange_n(&w->jobs, &range, _ssnap_job_range(begin + 1, end), false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            return (int)begin;
+        }
+    }
+}
+
+// steal the back half of the job range of the worker with the most remaining jobs,
+// returns false if there's nothing left to steal
+_SOKOL_PRIVATE bool _ssnap_steal_jobs(_ssnap_worker_t* w) {
+    _ssnap_workers_t* shared = w->shared;
+    for (;;) {
+        _ssnap_worker_t* victim = 0;
+        uint64_t victim_range = 0;
+        uint32_t max_remaining = 0;
+        for (int i = 1; i < shared->num_workers; i++) {
+            _ssnap_worker_t* other = &shared->workers[(w->index + i) % shared->num_workers];
+            const uint64_t range = __atomic_load_n(&other->jobs, __ATOMIC_ACQUIRE);
+            const uint32_t begin = (uint32_t)range;
+            const uint32_t end = (uint32_t)(range >> 32);
+            if ((begin < end) && ((end - begin) > max_remaining)) {
+                victim = other;
+                victim_range = range;
+                max_remaining = end - begin;
+            }
+        }
+        if (0 == victim) {
+            return false;
+        }
+        const uint32_t begin = (uint32_t)victim_range;
+        const uint32_t end = (uint32_t)(victim_range >> 32);
+        const uint32_t mid = begin + (end - begin) / 2;
+        if (__atomic_compare_exchange_n(&victim->jobs, &victim_range, _ssnap_job_range(begin, mid), false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            // the own range is empty, so nobody else is trying to modify it
+            __atomic_store_n(&w->jobs, _ssnap_job_range(mid, end), __ATOMIC_RELEASE);
+            return true;
+        }
+        // the victim's range has changed in the meantime, try again
+    }
+}
+
+_SOKOL_PRIVATE bool _ssnap_egl_has_extension(EGLDisplay display, const char* ext) {
+    const char* exts = eglQueryString(display, EGL_EXTENSIONS);
+    if (0 == exts) {
+        return false;
+    }
+    const size_t len = strlen(ext);
+    const char* p = exts;
+    while ((p = strstr(p, ext)) != 0) {
+        if (((p == exts) || (p[-1] == ' ')) && ((p[len] == ' ') || (p[len] == 0))) {
+            return true;
+        }
+        p += len;
+    }
+    return false;
+}
+
+_SOKOL_PRIVATE EGLDisplay _ssnap_egl_open_display(void) {
+    EGLDisplay display = EGL_NO_DISPLAY;
+    if (_ssnap_egl_has_extension(EGL_NO_DISPLAY, "EGL_MESA_platform_surfaceless")) {
+        _ssnap_egl_get_platform_display_t get_platform_display = (_ssnap_egl_get_platform_display_t) eglGetProcAddress("eglGetPlatformDisplayEXT");
+        if (get_platform_display) {
+            display = get_platform_display(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+        }
+    }
+    if (EGL_NO_DISPLAY == display) {
+        display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    }
+    if ((EGL_NO_DISPLAY != display) && !eglInitialize(display, NULL, NULL)) {
+        display = EGL_NO_DISPLAY;
+    }
+    return display;
+}
+
+_SOKOL_PRIVATE bool _ssnap_egl_bind_api(void) {
+    #if defined(SOKOL_GLCORE)
+        return eglBindAPI(EGL_OPENGL_API);
+    #else
+        return eglBindAPI(EGL_OPENGL_ES_API);
+    #endif
+}
+
+_SOKOL_PRIVATE void* _ssnap_worker_func(void* arg) {
+    _ssnap_worker_t* w = (_ssnap_worker_t*) arg;
+    _ssnap_workers_t* shared = w->shared;
+    const ssnap_workers_desc* desc = &shared->desc;
+
+    // NOTE: the bound client API is per-thread state in EGL
+    _ssnap_egl_bind_api();
+    const EGLint ctx_attrs[] = {
+        EGL_CONTEXT_MAJOR_VERSION, desc->gl_major_version,
+        EGL_CONTEXT_MINOR_VERSION, desc->gl_minor_version,
+        #if defined(SOKOL_GLCORE)
+            EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        #endif
+        EGL_NONE,
+    };
+    EGLContext ctx = eglCreateContext(shared->display, shared->config, EGL_NO_CONTEXT, ctx_attrs);
+    if ((EGL_NO_CONTEXT == ctx) || !eglMakeCurrent(shared->display, EGL_NO_SURFACE, EGL_NO_SURFACE, ctx)) {
+        // the jobs of this worker will be stolen by the other workers
+        _SSNAP_ERROR_WITH(&desc->snapshot.logger, WORKERS_EGL_CREATE_CONTEXT_FAILED);
+        if (EGL_NO_CONTEXT != ctx) {
+            eglDestroyContext(shared->display, ctx);
+        }
+        return 0;
+    }
+
+    sg_desc gfx_desc = desc->gfx;
+    gfx_desc.environment.defaults.color_format = SG_PIXELFORMAT_RGBA8;
+    gfx_desc.environment.defaults.depth_format = SG_PIXELFORMAT_DEPTH_STENCIL;
+    gfx_desc.environment.defaults.sample_count = (desc->snapshot.sample_count > 0) ? desc->snapshot.sample_count : 1;
+    sg_setup(&gfx_desc);
+    ssnap_setup(&desc->snapshot);
+    if (desc->init_cb) {
+        desc->init_cb(w->index, desc->user_data);
+    }
+    for (;;) {
+        int job_index = _ssnap_pop_job(w);
+        if (job_index < 0) {
+            if (!_ssnap_steal_jobs(w)) {
+                break;
+            }
+            continue;
+        }
+        desc->job_cb(job_index, w->index, desc->user_data);
+        sg_commit();
+        ssnap_poll();
+        __atomic_add_fetch(&shared->num_finished_jobs, 1, __ATOMIC_RELAXED);
+    }
+    ssnap_flush();
+    if (desc->cleanup_cb) {
+        desc->cleanup_cb(w->index, desc->user_data);
+    }
+    ssnap_shutdown();
+    sg_shutdown();
+    eglMakeCurrent(shared->display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    eglDestroyContext(shared->display, ctx);
+    eglReleaseThread();
+    return 0;
+}
+
+_SOKOL_PRIVATE bool _ssnap_egl_choose_config(EGLDisplay display, EGLConfig* out_config) {
+    const EGLint config_attrs[] = {
+        EGL_SURFACE_TYPE, 0,
+        #if defined(SOKOL_GLCORE)
+            EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        #else
+            EGL_RENDERABLE_TYPE, EGL_OPENGL_ES3_BIT,
+        #endif
+        EGL_RED_SIZE, 8,
+        EGL_GREEN_SIZE, 8,
+        EGL_BLUE_SIZE, 8,
+        EGL_NONE,
+    };
+    EGLint config_count = 0;
+    return eglChooseConfig(display, config_attrs, out_config, 1, &config_count) && (config_count > 0);
+}
+
+// start the worker threads and wait until all of them have finished
+_SOKOL_PRIVATE bool _ssnap_run_worker_threads(_ssnap_workers_t* shared) {
+    const ssnap_workers_desc* desc = &shared->desc;
+    // NOTE: the snapshot state isn't setup on this thread, so use the plain allocator
+    shared->workers = (_ssnap_worker_t*) calloc((size_t)shared->num_workers, sizeof(_ssnap_worker_t));
+    SOKOL_ASSERT(shared->workers);
+    for (int i = 0; i < shared->num_workers; i++) {
+        _ssnap_worker_t* w = &shared->workers[i];
+        w->shared = shared;
+        w->index = i;
+        const uint32_t begin = (uint32_t)(((int64_t)desc->num_jobs * i) / shared->num_workers);
+        const uint32_t end = (uint32_t)(((int64_t)desc->num_jobs * (i + 1)) / shared->num_workers);
+        w->jobs = _ssnap_job_range(begin, end);
+    }
+    // all job ranges must be initialized before the first worker starts stealing
+    for (int i = 0; i < shared->num_workers; i++) {
+        _ssnap_worker_t* w = &shared->workers[i];
+        w->thread_valid = (0 == pthread_create(&w->thread, NULL, _ssnap_worker_func, w));
+        if (!w->thread_valid) {
+            _SSNAP_ERROR_WITH(&desc->snapshot.logger, WORKERS_CREATE_THREAD_FAILED);
+        }
+    }
+    for (int i = 0; i < shared->num_workers; i++) {
+        if (shared->workers[i].thread_valid) {
+            pthread_join(shared->workers[i].thread, NULL);
+        }
+    }
+    free(shared->workers);
+    shared->workers = 0;
+    const bool res = (shared->num_finished_jobs == desc->num_jobs);
+    if (!res) {
+        _SSNAP_ERROR_WITH(&desc->snapshot.logger, WORKERS_JOBS_NOT_FINISHED);
+    }
+    return res;
+}
+
+_SOKOL_PRIVATE bool _ssnap_run_workers(const ssnap_workers_desc* desc) {
+    const ssnap_logger_t* logger = &desc->snapshot.logger;
+    _ssnap_workers_t shared;
+    memset(&shared, 0, sizeof(shared));
+    shared.desc = *desc;
+    #if defined(SOKOL_GLCORE)
+        shared.desc.gl_major_version = (0 == desc->gl_major_version) ? 4 : desc->gl_major_version;
+        shared.desc.gl_minor_version = (0 == desc->gl_major_version) ? 1 : desc->gl_minor_version;
+    #else
+        shared.desc.gl_major_version = (0 == desc->gl_major_version) ? 3 : desc->gl_major_version;
+        shared.desc.gl_minor_version = (0 == desc->gl_major_version) ? 0 : desc->gl_minor_version;
+    #endif
+    shared.num_workers = desc->num_workers;
+    if (0 == shared.num_workers) {
+        const long num_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        shared.num_workers = (num_cpus > 0) ? (int)num_cpus : 1;
+    }
+    if (shared.num_workers > desc->num_jobs) {
+        shared.num_workers = desc->num_jobs;
+    }
+
+    const bool own_display = (0 == desc->egl_display);
+    shared.display = own_display ? _ssnap_egl_open_display() : (EGLDisplay)desc->egl_display;
+    if (EGL_NO_DISPLAY == shared.display) {
+        _SSNAP_ERROR_WITH(logger, WORKERS_EGL_GET_DISPLAY_FAILED);
+        return false;
+    }
+    bool res = false;
+    if (!_ssnap_egl_has_extension(shared.display, "EGL_KHR_surfaceless_context")) {
+        _SSNAP_ERROR_WITH(logger, WORKERS_EGL_NO_SURFACELESS_CONTEXT);
+    } else if (!_ssnap_egl_choose_config(shared.display, &shared.config)) {
+        _SSNAP_ERROR_WITH(logger, WORKERS_EGL_NO_CONFIG);
+    } else {
+        res = _ssnap_run_worker_threads(&shared);
+    }
+    if (own_display) {
+        eglTerminate(shared.display);
+    }
+    return res;
+}
+#endif // SOKOL_SNAPSHOT_WORKERS
+
+// ██████  ██    ██ ██████  ██      ██  ██████
+// ██   ██ ██    ██ ██   ██ ██      ██ ██
+// ██████  ██    ██ ██████  ██      ██ ██
+// ██      ██    ██ ██   ██ ██      ██ ██
+// ██       ██████  ██████  ███████ ██  ██████
+//
+// >>public
+SOKOL_API_IMPL void ssnap_setup(const ssnap_desc* desc) {
+    SOKOL_ASSERT(desc);
+    SOKOL_ASSERT(!_ssnap.valid);
+    _ssnap_clear(&_ssnap, sizeof(_ssnap));
+    _ssnap.desc = _ssnap_desc_defaults(desc);
+    SOKOL_ASSERT((_ssnap.desc.width > 0) && (_ssnap.desc.height > 0));
+    SOKOL_ASSERT(_ssnap.desc.max_inflight > 0);
+    _ssnap.valid = true;
+
+    const bool msaa = _ssnap.desc.sample_count > 1;
+    sg_image_desc img_desc;
+    _ssnap_clear(&img_desc, sizeof(img_desc));
+    img_desc.usage.color_attachment = true;
+    img_desc.width = _ssnap.desc.width;
+    img_desc.height = _ssnap.desc.height;
+    img_desc.pixel_format = SG_PIXELFORMAT_RGBA8;
+    img_desc.sample_count = _ssnap.desc.sample_count;
+    img_desc.label = "ssnap-color-image";
+    _ssnap.color_img = sg_make_image(&img_desc);
+    sg_view_desc view_desc;
+    _ssnap_clear(&view_desc, sizeof(view_desc));
+    view_desc.color_attachment.image = _ssnap.color_img;
+    _ssnap.color_view = sg_make_view(&view_desc);
+    if (msaa) {
+        // the readback happens from the resolve image
+        img_desc.usage.color_attachment = false;
+        img_desc.usage.resolve_attachment = true;
+        img_desc.sample_count = 1;
+        img_desc.label = "ssnap-resolve-image";
+        _ssnap.resolve_img = sg_make_image(&img_desc);
+        _ssnap_clear(&view_desc, sizeof(view_desc));
+        view_desc.resolve_attachment.image = _ssnap.resolve_img;
+        _ssnap.resolve_view = sg_make_view(&view_desc);
+    }
+    if (_ssnap.desc.depth_format != SG_PIXELFORMAT_NONE) {
+        _ssnap_clear(&img_desc, sizeof(img_desc));
+        img_desc.usage.depth_stencil_attachment = true;
+        img_desc.width = _ssnap.desc.width;
+        img_desc.height = _ssnap.desc.height;
+        img_desc.pixel_format = _ssnap.desc.depth_format;
+        img_desc.sample_count = _ssnap.desc.sample_count;
+        img_desc.label = "ssnap-depth-image";
+        _ssnap.depth_img = sg_make_image(&img_desc);
+        _ssnap_clear(&view_desc, sizeof(view_desc));
+        view_desc.depth_stencil_attachment.image = _ssnap.depth_img;
+        _ssnap.depth_view = sg_make_view(&view_desc);
+    }
+
+    _ssnap.num_slots = _ssnap.desc.max_inflight;
+    _ssnap.slots = (_ssnap_slot_t*) _ssnap_malloc_clear((size_t)_ssnap.num_slots * sizeof(_ssnap_slot_t));
+    _ssnap.pixels_size = (size_t)_ssnap.desc.width * (size_t)_ssnap.desc.height * 4;
+    _ssnap.pixels = (uint8_t*) _ssnap_malloc(_ssnap.pixels_size);
+    _ssnap.png.hash = (int32_t*) _ssnap_malloc(_SSNAP_HASH_SIZE * sizeof(int32_t));
+    _ssnap_png_init_crc_table(&_ssnap.png);
+}
+
+SOKOL_API_IMPL void ssnap_shutdown(void) {
+    SOKOL_ASSERT(_ssnap.valid);
+    for (int i = 0; i < _ssnap.num_slots; i++) {
+        sg_gl_discard_readback(&_ssnap.slots[i].readback);
+    }
+    _ssnap_free(_ssnap.slots);
+    _ssnap_free(_ssnap.pixels);
+    _ssnap_free(_ssnap.png.hash);
+    if (_ssnap.png.raw) {
+        _ssnap_free(_ssnap.png.raw);
+    }
+    if (_ssnap.png.buf) {
+        _ssnap_free(_ssnap.png.buf);
+    }
+    sg_destroy_view(_ssnap.depth_view);
+    sg_destroy_view(_ssnap.resolve_view);
+    sg_destroy_view(_ssnap.color_view);
+    sg_destroy_image(_ssnap.depth_img);
+    sg_destroy_image(_ssnap.resolve_img);
+    sg_destroy_image(_ssnap.color_img);
+    _ssnap.valid = false;
+}
+
+SOKOL_API_IMPL void ssnap_begin_pass(const sg_pass_action* action) {
+    SOKOL_ASSERT(_ssnap.valid && action);
+    if (_ssnap.in_pass) {
+        _SSNAP_ERROR(ALREADY_IN_PASS);
+        return;
+    }
+    _ssnap.in_pass = true;
+    sg_pass pass;
+    _ssnap_clear(&pass, sizeof(pass));
+    pass.action = *action;
+    pass.attachments.colors[0] = _ssnap.color_view;
+    pass.attachments.resolves[0] = _ssnap.resolve_view;
+    pass.attachments.depth_stencil = _ssnap.depth_view;
+    pass.label = "ssnap-pass";
+    sg_begin_pass(&pass);
+}
+
+SOKOL_API_IMPL bool ssnap_end_pass(const char* path) {
+    SOKOL_ASSERT(_ssnap.valid && path);
+    if (!_ssnap.in_pass) {
+        _SSNAP_ERROR(NOT_IN_PASS);
+        return false;
+    }
+    _ssnap.in_pass = false;
+    sg_end_pass();
+    if (strlen(path) >= SSNAP_MAX_PATH_LENGTH) {
+        _SSNAP_ERROR(PATH_TOO_LONG);
+        return false;
+    }
+    _ssnap_slot_t* slot = &_ssnap.slots[_ssnap.next_slot];
+    if (slot->pending) {
+        // all readback slots are busy, finish the oldest snapshot first
+        _ssnap_finish_slot(slot);
+    }
+    if (!sg_gl_begin_readback(&slot->readback, ssnap_color_image())) {
+        _SSNAP_ERROR(READBACK_FAILED);
+        return false;
+    }
+    memcpy(slot->path, path, strlen(path) + 1);
+    slot->pending = true;
+    _ssnap.next_slot = (_ssnap.next_slot + 1) % _ssnap.num_slots;
+    return true;
+}
+
+SOKOL_API_IMPL int ssnap_poll(void) {
+    SOKOL_ASSERT(_ssnap.valid);
+    return _ssnap_finish_pending(false);
+}
+
+SOKOL_API_IMPL int ssnap_flush(void) {
+    SOKOL_ASSERT(_ssnap.valid);
+    return _ssnap_finish_pending(true);
+}
+
+SOKOL_API_IMPL sg_image ssnap_color_image(void) {
+    SOKOL_ASSERT(_ssnap.valid);
+    return (_ssnap.desc.sample_count > 1) ? _ssnap.resolve_img : _ssnap.color_img;
+}
+
+SOKOL_API_IMPL sg_range ssnap_encode_png(const void* pixels, int width, int height) {
+    SOKOL_ASSERT(_ssnap.valid);
+    return _ssnap_png_encode(&_ssnap.png, (const uint8_t*)pixels, width, height);
+}
+
+SOKOL_API_IMPL bool ssnap_run_workers(const ssnap_workers_desc* desc) {
+    SOKOL_ASSERT(desc && desc->job_cb && (desc->num_jobs >= 0) && (desc->num_workers >= 0));
+    if (0 == desc->num_jobs) {
+        return true;
+    }
+    #if defined(SOKOL_SNAPSHOT_WORKERS)
+        return _ssnap_run_workers(desc);
+    #else
+        // without worker support, run all jobs on the calling thread with the
+        // already setup sokol-gfx and sokol-snapshot instances
+        SOKOL_ASSERT(_ssnap.valid);
+        if (desc->init_cb) {
+            desc->init_cb(0, desc->user_data);
+        }
+        for (int i = 0; i < desc->num_jobs; i++) {
+            desc->job_cb(i, 0, desc->user_data);
+            sg_commit();
+            ssnap_poll();
+        }
+        ssnap_flush();
+        if (desc->cleanup_cb) {
+            desc->cleanup_cb(0, desc->user_data);
+        }
+        return true;
+    #endif
+}
+
+#endif // SOKOL_SNAPSHOT_IMPL
@@ -19,6 +19,19 @@
     SOKOL_API_DECL      - same as SOKOL_TIME_API_DECL
     SOKOL_API_IMPL      - public function implementation prefix (default: -)
 
+    Optionally define the following to tweak the profiling zone recorder
+    (see stm_zone_begin() below):
+
+    SOKOL_TIME_ZONE_RING_SIZE       - number of completed zones recorded per thread
+                                      before the oldest are overwritten, must be
+                                      a power of two (default: 8192)
+    SOKOL_TIME_MAX_ZONE_THREADS     - max number of threads recording zones (default: 64)
+    SOKOL_TIME_MAX_ZONE_DEPTH       - max nesting depth of zones per thread (default: 32)
+
+    ...and to disable the TSC-based time measurement on Linux (see below):
+
+    SOKOL_TIME_NO_TSC
+
     If sokol_time.h is compiled as a DLL, define the following before
     including the declaration or implementation:
 
@@ -82,6 +95,59 @@
     emscripten:     emscripten_get_now()
     Linux+others:   clock_gettime(CLOCK_MONOTONIC)
 
+    On Linux x86-64, if the CPU has an invariant time stamp counter (which
+    ticks at a constant rate independent of power states), stm_now() reads
+    the TSC via the rdtsc instruction instead, which is considerably cheaper
+    than calling clock_gettime(). The TSC frequency is calibrated against
+    CLOCK_MONOTONIC during stm_setup(), which busy-waits for 5 milliseconds.
+    Define SOKOL_TIME_NO_TSC to always use clock_gettime().
+
+    PROFILING ZONES
+    ===============
+    For instrumenting code with fine-grained timing zones (for instance
+    the individual phases of a frame callback) without noticeable
+    overhead, sokol_time.h records zones into per-thread ring buffers:
+
+    void stm_zone_begin(const char* name)
+        Begins a new zone on the calling thread, zones can be nested.
+        The name pointer is stored as is, so this must be a string
+        with static lifetime (usually a string literal).
+
+    void stm_zone_end(void)
+        Ends the innermost open zone of the calling thread and
+        records it into the calling thread's ring buffer.
+
+    In C++, the struct stm_zone_scope begins a zone in its constructor and
+    ends it in its destructor:
+
+        void update(void) {
+            stm_zone_scope zone("update");
+            ...
+        }
+
+    int stm_zones_drain(stm_zone* zones, int max_zones)
+        Copies up to max_zones recorded zones of all threads which
+        haven't been drained yet into the zones array and returns
+        the number of copied zones. Call this once per frame from
+        a single thread, for instance at the start of the frame callback.
+        Zones are recorded when they end, so that nested zones are
+        returned before their parent zone.
+
+    uint64_t stm_zones_num_dropped(void)
+        Returns the number of zones which were dropped because they
+        were overwritten in a ring buffer before they were drained, or
+        because the zone nesting depth was exceeded.
+
+    Each stm_zone item contains:
+
+        .name           - the name passed into stm_zone_begin()
+        .start, .end    - the start and end time in ticks (see stm_now())
+        .thread_index   - a sequential index of the recording thread
+        .depth          - the nesting depth of the zone (0 for toplevel zones)
+
+    Ring buffers are allocated when a thread begins its first zone, they
+    are never freed.
+
     zlib/libpng license
 
     Copyright (c) 2018 Andre Weissflog
@@ -136,8 +202,30 @@ SOKOL_TIME_API_DECL double stm_ms(uint64_t ticks);
 SOKOL_TIME_API_DECL double stm_us(uint64_t ticks);
 SOKOL_TIME_API_DECL double stm_ns(uint64_t ticks);
 
+/* a recorded profiling zone */
+typedef struct stm_zone {
+    const char* name;
+    uint64_t start;
+    uint64_t end;
+    uint32_t thread_index;
+    uint32_t depth;
+} stm_zone;
+
+SOKOL_TIME_API_DECL void stm_zone_begin(const char* name);
+SOKOL_TIME_API_DECL void stm_zone_end(void);
+SOKOL_TIME_API_DECL int stm_zones_drain(stm_zone* zones, int max_zones);
+SOKOL_TIME_API_DECL uint64_t stm_zones_num_dropped(void);
+
 #ifdef __cplusplus
 } /* extern "C" */
+
+/* C++ helper to record a zone for the lifetime of a scope */
+struct stm_zone_scope {
+    explicit stm_zone_scope(const char* name) { stm_zone_begin(name); }
+    ~stm_zone_scope() { stm_zone_end(); }
+    stm_zone_scope(const stm_zone_scope&) = delete;
+    stm_zone_scope& operator=(const stm_zone_scope&) = delete;
+};
 #endif
 #endif // SOKOL_TIME_INCLUDED
 
@@ -145,6 +233,7 @@ SOKOL_TIME_API_DECL double stm_ns(uint64_t ticks);
 #ifdef SOKOL_TIME_IMPL
 #define SOKOL_TIME_IMPL_INCLUDED (1)
 #include <string.h> /* memset */
+#include <stdlib.h> /* calloc */
 
 #ifndef SOKOL_API_IMPL
     #define SOKOL_API_IMPL
@@ -190,13 +279,161 @@ typedef struct {
 #define CLOCK_MONOTONIC 0
 #endif
 #include <time.h>
+#if defined(__linux__) && defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && !defined(SOKOL_TIME_NO_TSC)
+#define _STM_TSC (1)
+#include <x86intrin.h>  /* __rdtsc */
+#include <cpuid.h>      /* __get_cpuid */
+__extension__ typedef unsigned __int128 _stm_uint128_t;
+/* duration of the TSC calibration in stm_setup() in nanoseconds */
+#define _STM_TSC_CALIBRATION_NS (5000000)
+#endif
 typedef struct {
     uint32_t initialized;
     uint64_t start;
+    #if defined(_STM_TSC)
+    uint32_t use_tsc;
+    uint64_t tsc_start;
+    uint64_t tsc_mult;      /* nanoseconds per TSC tick as 32.32 fixed point */
+    #endif
 } _stm_state_t;
 #endif
 static _stm_state_t _stm;
 
+#ifndef SOKOL_TIME_ZONE_RING_SIZE
+#define SOKOL_TIME_ZONE_RING_SIZE (8192)
+#endif
+#ifndef SOKOL_TIME_MAX_ZONE_THREADS
+#define SOKOL_TIME_MAX_ZONE_THREADS (64)
+#endif
+#ifndef SOKOL_TIME_MAX_ZONE_DEPTH
+#define SOKOL_TIME_MAX_ZONE_DEPTH (32)
+#endif
+
+#if defined(__cplusplus)
+    #define _STM_THREAD_LOCAL thread_local
+#elif defined(_MSC_VER)
+    #define _STM_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__) || defined(__clang__)
+    #define _STM_THREAD_LOCAL __thread
+#else
+    #define _STM_THREAD_LOCAL _Thread_local
+#endif
+
+/* per-thread zone recorder, only the owning thread writes zones and the head position */
+typedef struct {
+    uint32_t thread_index;
+    uint32_t depth;
+    const char* names[SOKOL_TIME_MAX_ZONE_DEPTH];
+    uint64_t starts[SOKOL_TIME_MAX_ZONE_DEPTH];
+    uint64_t head;          /* number of recorded zones (accessed via atomics) */
+    uint64_t tail;          /* number of drained zones (only accessed by stm_zones_drain) */
+    stm_zone zones[SOKOL_TIME_ZONE_RING_SIZE];
+} _stm_zone_thread_t;
+
+typedef struct {
+    int num_threads;        /* accessed via atomics */
+    uint64_t num_dropped;   /* accessed via atomics */
+    _stm_zone_thread_t* threads[SOKOL_TIME_MAX_ZONE_THREADS];  /* accessed via atomics */
+} _stm_zone_state_t;
+static _stm_zone_state_t _stm_zones;
+static _STM_THREAD_LOCAL _stm_zone_thread_t* _stm_zone_thread;
+/* set when all zone thread slots were taken, so the thread doesn't retry registration */
+static _STM_THREAD_LOCAL int _stm_zone_thread_failed;
+
+#if defined(_MSC_VER)
+_SOKOL_PRIVATE uint64_t _stm_atomic_load(uint64_t* ptr) {
+    return (uint64_t) InterlockedCompareExchange64((volatile LONG64*)ptr, 0, 0);
+}
+_SOKOL_PRIVATE void _stm_atomic_store(uint64_t* ptr, uint64_t val) {
+    InterlockedExchange64((volatile LONG64*)ptr, (LONG64)val);
+}
+_SOKOL_PRIVATE void _stm_atomic_add(uint64_t* ptr, uint64_t val) {
+    InterlockedExchangeAdd64((volatile LONG64*)ptr, (LONG64)val);
+}
+_SOKOL_PRIVATE int _stm_atomic_cas_int(int* ptr, int* expected, int desired) {
+    const int prev = (int) InterlockedCompareExchange((volatile LONG*)ptr, (LONG)desired, (LONG)*expected);
+    if (prev == *expected) {
+        return 1;
+    }
+    *expected = prev;
+    return 0;
+}
+_SOKOL_PRIVATE int _stm_atomic_load_int(int* ptr) {
+    return (int) InterlockedCompareExchange((volatile LONG*)ptr, 0, 0);
+}
+_SOKOL_PRIVATE void* _stm_atomic_load_ptr(void** ptr) {
+    return InterlockedCompareExchangePointer(ptr, 0, 0);
+}
+_SOKOL_PRIVATE void _stm_atomic_store_ptr(void** ptr, void* val) {
+    InterlockedExchangePointer(ptr, val);
+}
+#else
+_SOKOL_PRIVATE uint64_t _stm_atomic_load(uint64_t* ptr) {
+    return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+}
+_SOKOL_PRIVATE void _stm_atomic_store(uint64_t* ptr, uint64_t val) {
+    __atomic_store_n(ptr, val, __ATOMIC_RELEASE);
+}
+_SOKOL_PRIVATE void _stm_atomic_add(uint64_t* ptr, uint64_t val) {
+    __atomic_add_fetch(ptr, val, __ATOMIC_RELAXED);
+}
+/* returns 1 on success, on failure stores the current value in 'expected' */
+_SOKOL_PRIVATE int _stm_atomic_cas_int(int* ptr, int* expected, int desired) {
+    return __atomic_compare_exchange_n(ptr, expected, desired, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) ? 1 : 0;
+}
+_SOKOL_PRIVATE int _stm_atomic_load_int(int* ptr) {
+    return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+}
+_SOKOL_PRIVATE void* _stm_atomic_load_ptr(void** ptr) {
+    return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+}
+_SOKOL_PRIVATE void _stm_atomic_store_ptr(void** ptr, void* val) {
+    __atomic_store_n(ptr, val, __ATOMIC_RELEASE);
+}
+#endif
+
+#if defined(_STM_TSC)
+_SOKOL_PRIVATE uint64_t _stm_clock_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec*1000000000 + (uint64_t)ts.tv_nsec;
+}
+
+/* take a (clock, tsc) sample pair, bracketing the clock_gettime() call with rdtsc */
+_SOKOL_PRIVATE void _stm_tsc_sample(uint64_t* out_ns, uint64_t* out_tsc) {
+    uint64_t min_delta = UINT64_MAX;
+    for (int i = 0; i < 8; i++) {
+        const uint64_t tsc0 = __rdtsc();
+        const uint64_t ns = _stm_clock_ns();
+        const uint64_t tsc1 = __rdtsc();
+        if ((tsc1 - tsc0) < min_delta) {
+            min_delta = tsc1 - tsc0;
+            *out_ns = ns;
+            *out_tsc = tsc0 + (tsc1 - tsc0) / 2;
+        }
+    }
+}
+
+_SOKOL_PRIVATE void _stm_tsc_setup(void) {
+    /* only use the TSC if it's invariant (CPUID.80000007H:EDX[8]) */
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) || (0 == (edx & (1 << 8)))) {
+        return;
+    }
+    uint64_t ns0, tsc0, ns1, tsc1;
+    _stm_tsc_sample(&ns0, &tsc0);
+    do {
+        _stm_tsc_sample(&ns1, &tsc1);
+    } while ((ns1 - ns0) < _STM_TSC_CALIBRATION_NS);
+    if (tsc1 <= tsc0) {
+        return;
+    }
+    _stm.tsc_mult = ((ns1 - ns0) << 32) / (tsc1 - tsc0);
+    _stm.tsc_start = tsc1;
+    _stm.use_tsc = 1;
+}
+#endif
+
 /* prevent 64-bit overflow when computing relative timestamp
     see https://gist.github.com/jspohr/3dc4f00033d79ec5bdaf67bc46c813e3
 */
@@ -223,6 +460,9 @@ SOKOL_API_IMPL void stm_setup(void) {
         struct timespec ts;
         clock_gettime(CLOCK_MONOTONIC, &ts);
         _stm.start = (uint64_t)ts.tv_sec*1000000000 + (uint64_t)ts.tv_nsec;
+        #if defined(_STM_TSC)
+            _stm_tsc_setup();
+        #endif
     #endif
 }
 
@@ -240,6 +480,11 @@ SOKOL_API_IMPL uint64_t stm_now(void) {
         double js_now = emscripten_get_now() - _stm.start;
         now = (uint64_t) (js_now * 1000000.0);
     #else
+        #if defined(_STM_TSC)
+        if (_stm.use_tsc) {
+            return (uint64_t) (((_stm_uint128_t)(__rdtsc() - _stm.tsc_start) * _stm.tsc_mult) >> 32);
+        }
+        #endif
         struct timespec ts;
         clock_gettime(CLOCK_MONOTONIC, &ts);
         now = ((uint64_t)ts.tv_sec*1000000000 + (uint64_t)ts.tv_nsec) - _stm.start;
@@ -315,5 +560,111 @@ SOKOL_API_IMPL double stm_us(uint64_t ticks) {
 SOKOL_API_IMPL double stm_ns(uint64_t ticks) {
     return (double)ticks;
 }
-#endif /* SOKOL_TIME_IMPL */
+_SOKOL_PRIVATE _stm_zone_thread_t* _stm_zone_thread_register(void) {
+    /* reserve a slot, but never count past the maximum number of threads */
+    int index = _stm_atomic_load_int(&_stm_zones.num_threads);
+    do {
+        if (index >= SOKOL_TIME_MAX_ZONE_THREADS) {
+            return 0;
+        }
+    } while (!_stm_atomic_cas_int(&_stm_zones.num_threads, &index, index + 1));
+    _stm_zone_thread_t* zt = (_stm_zone_thread_t*) calloc(1, sizeof(_stm_zone_thread_t));
+    SOKOL_ASSERT(zt);
+    zt->thread_index = (uint32_t)index;
+    _stm_atomic_store_ptr((void**)&_stm_zones.threads[index], zt);
+    return zt;
+}
+
+SOKOL_API_IMPL void stm_zone_begin(const char* name) {
+    _stm_zone_thread_t* zt = _stm_zone_thread;
+    if (0 == zt) {
+        if (_stm_zone_thread_failed) {
+            return;
+        }
+        zt = _stm_zone_thread = _stm_zone_thread_register();
+        if (0 == zt) {
+            _stm_zone_thread_failed = 1;
+            return;
+        }
+    }
+    if (zt->depth < SOKOL_TIME_MAX_ZONE_DEPTH) {
+        zt->names[zt->depth] = name;
+        zt->starts[zt->depth] = stm_now();
+    }
+    zt->depth++;
+}
 
+SOKOL_API_IMPL void stm_zone_end(void) {
+    _stm_zone_thread_t* zt = _stm_zone_thread;
+    if (0 == zt) {
+        return;
+    }
+    SOKOL_ASSERT(zt->depth > 0);
+    zt->depth--;
+    if (zt->depth >= SOKOL_TIME_MAX_ZONE_DEPTH) {
+        _stm_atomic_add(&_stm_zones.num_dropped, 1);
+        return;
+    }
+    /* only the owning thread writes the head position, so a plain read is fine */
+    const uint64_t head = zt->head;
+    stm_zone* zone = &zt->zones[head & (SOKOL_TIME_ZONE_RING_SIZE - 1)];
+    zone->name = zt->names[zt->depth];
+    zone->start = zt->starts[zt->depth];
+    zone->end = stm_now();
+    zone->thread_index = zt->thread_index;
+    zone->depth = zt->depth;
+    _stm_atomic_store(&zt->head, head + 1);
+}
+
+SOKOL_API_IMPL int stm_zones_drain(stm_zone* zones, int max_zones) {
+    SOKOL_ASSERT(zones && (max_zones >= 0));
+    int num_zones = 0;
+    int num_threads = _stm_atomic_load_int(&_stm_zones.num_threads);
+    if (num_threads > SOKOL_TIME_MAX_ZONE_THREADS) {
+        num_threads = SOKOL_TIME_MAX_ZONE_THREADS;
+    }
+    for (int i = 0; (i < num_threads) && (num_zones < max_zones); i++) {
+        _stm_zone_thread_t* zt = (_stm_zone_thread_t*) _stm_atomic_load_ptr((void**)&_stm_zones.threads[i]);
+        if (0 == zt) {
+            /* thread registered but ring buffer not yet published */
+            continue;
+        }
+        const uint64_t head = _stm_atomic_load(&zt->head);
+        uint64_t tail = zt->tail;
+        if ((head - tail) > SOKOL_TIME_ZONE_RING_SIZE) {
+            _stm_atomic_add(&_stm_zones.num_dropped, head - tail - SOKOL_TIME_ZONE_RING_SIZE);
+            tail = head - SOKOL_TIME_ZONE_RING_SIZE;
+        }
+        uint64_t num = head - tail;
+        if (num > (uint64_t)(max_zones - num_zones)) {
+            num = (uint64_t)(max_zones - num_zones);
+        }
+        for (uint64_t k = 0; k < num; k++) {
+            zones[num_zones + (int)k] = zt->zones[(tail + k) & (SOKOL_TIME_ZONE_RING_SIZE - 1)];
+        }
+        /* the owning thread may have overwritten zones while they were copied,
+           the zone at index 'head' might be half-written, discard all zones
+           which are not newer than that
+        */
+        const uint64_t new_head = _stm_atomic_load(&zt->head);
+        uint64_t first_valid = tail;
+        if ((new_head + 1) > (tail + SOKOL_TIME_ZONE_RING_SIZE)) {
+            first_valid = new_head + 1 - SOKOL_TIME_ZONE_RING_SIZE;
+        }
+        uint64_t num_valid = 0;
+        for (uint64_t k = 0; k < num; k++) {
+            if ((tail + k) >= first_valid) {
+                zones[num_zones + (int)num_valid++] = zones[num_zones + (int)k];
+            }
+        }
+        _stm_atomic_add(&_stm_zones.num_dropped, num - num_valid);
+        zt->tail = tail + num;
+        num_zones += (int)num_valid;
+    }
+    return num_zones;
+}
+
+SOKOL_API_IMPL uint64_t stm_zones_num_dropped(void) {
+    return _stm_atomic_load(&_stm_zones.num_dropped);
+}
+#endif /* SOKOL_TIME_IMPL */
@@ -0,0 +1,187 @@
+/* input latency measurement tool
+
+	Opens a window, injects synthetic mouse motion with the XTest extension
+	from a second X connection every frame, and checks the input-to-present
+	latency which sokol-app measures with sapp_desc.input_latency_tracking
+	(see INPUT LATENCY TRACKING in sokol_app.h). It's meant to run against
+	an Xvfb server, which doesn't support GLX_OML_sync_control, so the
+	latency is measured until the swap-buffers call returns.
+
+	NOTE: this tool has not been validated against a real Xvfb server yet,
+	so it's not part of any test target, and the default thresholds are
+	provisional. Build it with 'make latency-tool' (needs libXtst) and run
+	it manually:
+
+		xvfb-run -a -s "-screen 0 1280x720x24" build/sokol_latency [options]
+
+	command line options:
+
+		--frames N          measured frames (default: 300)
+		--warmup N          frames before the statistics are reset (default: 30)
+		--min-samples N     fail if fewer latency samples were taken (default: 100)
+		--max-p99-ms X      fail if the p99 latency is larger (default: 50)
+		--render-thread     run the callbacks on the render thread (sapp_desc.render_thread)
+
+	A summary is printed to stderr, and the process exits with code 1 if the
+	check failed (code 2 if the XTest extension isn't available).
+
+	The window is created at the origin of the root window, Xvfb has no
+	window manager which would move it, so the injected pointer positions
+	are inside the window.
+*/
+#define SOKOL_IMPL
+#define SOKOL_GLCORE
+
+#include "header/sokol_app.h"
+#include "header/sokol_gfx.h"
+#include "header/sokol_glue.h"
+#include "header/sokol_log.h"
+
+#include <X11/Xlib.h>
+#include <X11/extensions/XTest.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static struct {
+	// options
+	int frames;
+	int warmup;
+	int min_samples;
+	double max_p99_ms;
+	bool render_thread;
+
+	// the injecting X connection, separate from the one of sokol-app
+	Display* display;
+	int cur_frame;
+	int exit_code;
+	sg_pass_action pass_action;
+} state;
+
+static bool parse_args(int argc, char* argv[]) {
+	state.frames = 300;
+	state.warmup = 30;
+	state.min_samples = 100;
+	state.max_p99_ms = 50.0;
+	for (int i = 1; i < argc; i++) {
+		const char* arg = argv[i];
+		if (0 == strcmp(arg, "--render-thread")) {
+			state.render_thread = true;
+			continue;
+		}
+		const char* val = (i + 1 < argc) ? argv[i + 1] : 0;
+		if (val == 0) {
+			fprintf(stderr, "missing value for %s\n", arg);
+			return false;
+		}
+		if (0 == strcmp(arg, "--frames")) {
+			state.frames = atoi(val);
+		} else if (0 == strcmp(arg, "--warmup")) {
+			state.warmup = atoi(val);
+		} else if (0 == strcmp(arg, "--min-samples")) {
+			state.min_samples = atoi(val);
+		} else if (0 == strcmp(arg, "--max-p99-ms")) {
+			state.max_p99_ms = atof(val);
+		} else {
+			fprintf(stderr, "unknown option %s\n", arg);
+			return false;
+		}
+		i++;
+	}
+	if ((state.frames <= 0) || (state.warmup < 0) || (state.min_samples < 0) || (state.max_p99_ms <= 0.0)) {
+		fprintf(stderr, "invalid options\n");
+		return false;
+	}
+	return true;
+}
+
+static void init(void) {
+	sg_desc desc = {};
+	desc.environment = sglue_environment();
+	desc.logger.func = slog_func;
+	sg_setup(&desc);
+	state.pass_action.colors[0].load_action = SG_LOADACTION_CLEAR;
+	state.pass_action.colors[0].clear_value = { 0.0f, 0.0f, 0.0f, 1.0f };
+
+	int event_base, error_base, major, minor;
+	state.display = XOpenDisplay(0);
+	if ((state.display == 0) || !XTestQueryExtension(state.display, &event_base, &error_base, &major, &minor)) {
+		fprintf(stderr, "the XTest extension is not available\n");
+		state.exit_code = 2;
+		sapp_request_quit();
+	}
+}
+
+static void report(void) {
+	const sapp_input_latency_stats stats = sapp_query_input_latency_stats();
+	const double p50_ms = stats.p50 * 1000.0;
+	const double p99_ms = stats.p99 * 1000.0;
+	fprintf(stderr, "input latency over %d samples (%s): p50 %.1f ms, p95 %.1f ms, p99 %.1f ms, max %.1f ms\n",
+		stats.num_samples, stats.present_based ? "until present" : "until swap",
+		p50_ms, stats.p95 * 1000.0, p99_ms, stats.max * 1000.0);
+	if (stats.num_samples < state.min_samples) {
+		fprintf(stderr, "FAIL: only %d latency samples, expected at least %d\n", stats.num_samples, state.min_samples);
+		state.exit_code = 1;
+	} else if (p99_ms > state.max_p99_ms) {
+		fprintf(stderr, "FAIL: p99 latency %.1f ms is larger than %.1f ms\n", p99_ms, state.max_p99_ms);
+		state.exit_code = 1;
+	} else {
+		fprintf(stderr, "PASS\n");
+	}
+}
+
+static void frame(void) {
+	if (state.exit_code != 0) {
+		return;
+	}
+	if (state.cur_frame == state.warmup) {
+		sapp_reset_input_latency_stats();
+	}
+	if (state.cur_frame == (state.warmup + state.frames)) {
+		report();
+		sapp_request_quit();
+		return;
+	}
+	// move the pointer between two positions inside the window, so that
+	// every frame has a new motion event
+	const int x = 100 + (state.cur_frame & 1) * 100;
+	XTestFakeMotionEvent(state.display, -1, x, 100, CurrentTime);
+	XFlush(state.display);
+	state.cur_frame++;
+
+	sg_pass pass = {};
+	pass.action = state.pass_action;
+	pass.swapchain = sglue_swapchain();
+	sg_begin_pass(&pass);
+	sg_end_pass();
+	sg_commit();
+}
+
+static void cleanup(void) {
+	if (state.display) {
+		XCloseDisplay(state.display);
+	}
+	sg_shutdown();
+	// the exit code of the test
+	if (state.exit_code != 0) {
+		exit(state.exit_code);
+	}
+}
+
+sapp_desc sokol_main(int argc, char* argv[]) {
+	if (!parse_args(argc, argv)) {
+		exit(10);
+	}
+	sapp_desc desc = {};
+	desc.init_cb = init;
+	desc.frame_cb = frame;
+	desc.cleanup_cb = cleanup;
+	desc.width = 640;
+	desc.height = 480;
+	desc.window_title = "Input latency test";
+	desc.render_thread = state.render_thread;
+	desc.input_latency_tracking = true;
+	desc.logger.func = slog_func;
+	return desc;
+}